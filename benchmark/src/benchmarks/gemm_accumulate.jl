@@ -0,0 +1,34 @@
+# C = α Aᵀ B + β C: exercises the transpose and accumulate paths of gemm.
+Base.@kwdef struct GEMMAccumulate{T} <: AbstractBenchmark{T}
+    N::Int
+    M::Int
+end
+
+name(::GEMMAccumulate) = "gemm_accumulate"
+dims(g::GEMMAccumulate) = (g.N, g.M)
+data(g::GEMMAccumulate{T}) where {T} = "GEMM (C = αAᵀB + βC) with T=$(T), N=$(g.N), M=$(g.M)"
+
+allowed_types(::Type{GEMMAccumulate}) = cuNumeric.SUPPORTED_GEMM_TYPES
+
+total_flops(s::GEMMAccumulate) = s.N * s.N * ((2*s.M) - 1) + 3 * s.N * s.N
+total_space(s::GEMMAccumulate{T}) where {T} = 2 * ((s.N*s.M) * sizeof(T)) + ((s.N*s.N) * sizeof(T))
+
+function initialize(s::GEMMAccumulate{T}; mod=cuNumeric) where {T}
+    A = mod.rand(T, s.M, s.N)
+    B = mod.rand(T, s.M, s.N)
+    C = mod.rand(T, s.N, s.N)
+    GC.gc()
+    return C, A, B
+end
+
+const GEMM_ALPHA = 1.5
+const GEMM_BETA = 0.5
+
+function run!(::GEMMAccumulate{T}, C::NDArray, A, B) where {T}
+    return cuNumeric.gemm!(C, A, B; transA=true, alpha=T(GEMM_ALPHA), beta=T(GEMM_BETA))
+end
+function run!(::GEMMAccumulate{T}, C, A, B) where {T}
+    return mul!(C, transpose(A), B, T(GEMM_ALPHA), T(GEMM_BETA))
+end
+
+register_benchmark("gemm_accumulate", GEMMAccumulate)
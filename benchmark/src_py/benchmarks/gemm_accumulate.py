@@ -0,0 +1,32 @@
+import cupynumeric as np
+
+from core import register_benchmark
+
+ALPHA = 1.5
+BETA = 0.5
+
+
+class GEMMAccumulate:
+    name = "gemm_accumulate"
+
+    def __init__(self, T, N, M):
+        self.T, self.N, self.M = T, N, M
+
+    def dims(self):
+        return self.N, self.M
+
+    def total_flops(self):
+        return self.N * self.N * (2 * self.M - 1) + 3 * self.N * self.N
+
+    def initialize(self):
+        A = np.random.rand(self.M, self.N).astype(self.T)
+        B = np.random.rand(self.M, self.N).astype(self.T)
+        C = np.random.rand(self.N, self.N).astype(self.T)
+        return (C, A, B)
+
+    def run(self, state):
+        C, A, B = state
+        C[...] = ALPHA * (A.T @ B) + BETA * C
+
+
+register_benchmark("gemm_accumulate", GEMMAccumulate)
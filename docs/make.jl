@@ -63,6 +63,8 @@ makedocs(;
             "Unary Operations" => "api_unary.md",
             "Binary Operations" => "api_binary.md",
             "Linear Algebra" => "linalg.md",
+            "FFT" => "api_fft.md",
+            "Convolution" => "api_convolve.md",
             "HDF5" => "api_hdf5.md",
             "NDArray Reference" => "api.md",
             "CUDA.jl Tasking" => "api_cuda.md",
@@ -13,6 +13,8 @@ const FUSE_BROADCAST = @load_preference("FUSE_BROADCAST_EXPRS", true)
 # Set to 1 to fuse every eligible expression (e.g. in tests).
 const FUSE_BROADCAST_MIN_OPS = @load_preference("FUSE_BROADCAST_MIN_OPS", 2)
 const TASK_SCOPE_NAMES = @load_preference("TASK_SCOPE_NAMES", false)
+# Record broadcasts that are not fused on the GPU and launch them as fused host tasks.
+const DEFER_BROADCAST = @load_preference("DEFER_BROADCAST_EXPRS", false)
 
 """
     set_broadcast_fusion!(enabled::Bool; export_prefs=false, force=true)
@@ -56,6 +58,34 @@ function set_broadcast_fusion_min_ops!(n::Integer; export_prefs=false, force=tru
     )
 end
 
+"""
+    set_broadcast_deferral!(enabled::Bool; export_prefs=false, force=true)
+
+Enable or disable deferred broadcasts. When enabled, broadcast trees that are
+not fused into a CUDA kernel (CPU-only builds, or fusion disabled) are recorded
+by the C wrapper and run as fused host tasks instead of one task per op.
+Default is off.
+
+Restart Julia after changing this preference.
+"""
+function set_broadcast_deferral!(enabled::Bool; export_prefs=false, force=true)
+    return set_preferences!(@__MODULE__, "DEFER_BROADCAST_EXPRS" => enabled; export_prefs, force)
+end
+
+"""
+    enable_broadcast_deferral!(; export_prefs=false, force=true)
+
+Enable deferred broadcasts. See [`set_broadcast_deferral!`](@ref).
+"""
+enable_broadcast_deferral!(; kwargs...) = set_broadcast_deferral!(true; kwargs...)
+
+"""
+    disable_broadcast_deferral!(; export_prefs=false, force=true)
+
+Disable deferred broadcasts. This is the default.
+"""
+disable_broadcast_deferral!(; kwargs...) = set_broadcast_deferral!(false; kwargs...)
+
 """
     set_task_scope_names!(enabled::Bool; export_prefs=false, force=true)
 
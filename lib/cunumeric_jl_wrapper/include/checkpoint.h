@@ -0,0 +1,85 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahhal <naderrahhal2026@u.northwestern.edu>
+ */
+
+#pragma once
+
+#include <cupynumeric/ndarray.h>
+
+#include <string>
+#include <vector>
+
+#include "legate.h"
+#include "tasks.h"
+
+namespace tasks {
+
+// Writes the tile of its input as one shard file, optionally byte-shuffled
+// and LZ-compressed in independent chunks. Adds 1 to its Int64 reduction
+// when the shard could not be written.
+class CheckpointTask : public legate::LegateTask<CheckpointTask> {
+ public:
+  static inline const auto TASK_CONFIG =
+      legate::TaskConfig{legate::LocalTaskID{tasks::CHECKPOINT_TASK}};
+
+  static void cpu_variant(legate::TaskContext context);
+#if LEGATE_DEFINED(LEGATE_USE_OPENMP)
+  static void omp_variant(legate::TaskContext context);
+#endif
+};
+
+// Fills the tile of its output from every shard that overlaps it, so the
+// shards may come from a different partition than the one reading them.
+// Adds the number of unreadable or mismatched shards to its Int64
+// reduction.
+class RestoreTask : public legate::LegateTask<RestoreTask> {
+ public:
+  static inline const auto TASK_CONFIG =
+      legate::TaskConfig{legate::LocalTaskID{tasks::RESTORE_TASK}};
+
+  static void cpu_variant(legate::TaskContext context);
+#if LEGATE_DEFINED(LEGATE_USE_OPENMP)
+  static void omp_variant(legate::TaskContext context);
+#endif
+};
+
+// Saves `arrs[i]` under `names[i]` in directory `dir`, one shard per tile,
+// and records them in `dir`/manifest. Waits for the shards and checks that
+// every one was written and that they cover every array. The shards of an
+// earlier checkpoint of the same name are replaced only once the new ones
+// are complete; an array that failed keeps its earlier checkpoint. Names are
+// limited to [A-Za-z0-9_-]. Returns false for bad names, 0-d or
+// non-primitive arrays, or I/O errors.
+bool checkpoint(const std::vector<cupynumeric::NDArray>& arrs,
+                const std::vector<std::string>& names, const std::string& dir,
+                bool compress);
+
+enum class RestoreStatus {
+  OK,
+  MISSING,  // a name is not in the manifest or has no shards
+  CORRUPT,  // shards are missing, unreadable or do not match the manifest
+};
+
+// Reads the arrays saved under `names` in `dir` into `arrs`. Waits for the
+// reads so that damaged shards are reported.
+RestoreStatus restore(const std::vector<std::string>& names,
+                      const std::string& dir,
+                      std::vector<cupynumeric::NDArray>& arrs);
+
+}  // namespace tasks
@@ -0,0 +1,70 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahhal <naderrahhal2026@u.northwestern.edu>
+ */
+
+#pragma once
+
+#include <cupynumeric/ndarray.h>
+
+#include <cstdint>
+#include <optional>
+
+#include "legate.h"
+#include "tasks.h"
+
+// N-d convolution and correlation with a kernel, producing an array of the
+// input's shape. Boundary modes are the PadMode values of pad.h.
+namespace tasks {
+
+// Must match the CN_CONVOLVE_* values in ndarray_c_api.h.
+enum ConvolveMethod : int32_t {
+  CONVOLVE_AUTO = 0,  // direct for small kernels, FFT for large ones
+  CONVOLVE_DIRECT,    // one stencil pass over halo-bloated tiles
+  CONVOLVE_FFT,       // pad, transform, multiply, transform back, crop
+};
+
+// input(0): the array, partitioned like the output with a halo of the
+// kernel's reach. input(1): the kernel, broadcast. scalar(0): PAD_CONSTANT
+// or PAD_EDGE. scalar(1): flip (convolve rather than correlate).
+// scalar(2): the constant fill. scalar(3): int64 extents of the array.
+class ConvolveTask : public legate::LegateTask<ConvolveTask> {
+ public:
+  static inline const auto TASK_CONFIG =
+      legate::TaskConfig{legate::LocalTaskID{tasks::CONVOLVE_TASK}};
+
+  static void cpu_variant(legate::TaskContext context);
+#if LEGATE_DEFINED(LEGATE_USE_OPENMP)
+  static void omp_variant(legate::TaskContext context);
+#endif
+};
+
+// With c = k / 2 per dimension (k the kernel extent), correlation computes
+// out[i] = sum_j w[j] * arr[i + j - c] and convolution the same with `w`
+// reversed along every dimension. A complex `w` is used as given; callers
+// conjugate it for numpy's correlate. Reads outside `arr` follow `mode`, with
+// `value` (of the array's type) for PAD_CONSTANT. Returns nullopt for an
+// unknown mode or method, a 0-d or non-float array, a kernel of another
+// type or rank, or an empty kernel.
+std::optional<cupynumeric::NDArray> convolve(const cupynumeric::NDArray& arr,
+                                             const cupynumeric::NDArray& w,
+                                             int32_t mode, bool flip,
+                                             int32_t method,
+                                             const legate::Scalar& value);
+
+}  // namespace tasks
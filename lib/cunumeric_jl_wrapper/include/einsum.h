@@ -0,0 +1,56 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahhal <naderrahhal2026@u.northwestern.edu>
+ */
+
+#pragma once
+
+#include <cupynumeric/ndarray.h>
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace tasks {
+
+// numpy-style einsum ("ij,jk->ik"; implicit output when "->" is absent).
+// Operands are contracted pairwise in the order that minimizes total FLOPs
+// (exhaustive for up to six operands, greedy beyond), and each pairwise
+// contraction runs as one (batched) gemm. Paths are cached per subscripts
+// and shapes. Multi-operand expressions need a common BLAS element type.
+// Returns nullopt for malformed or unsupported subscripts (ellipses and
+// repeated indices within one operand) or mismatched shapes/types.
+std::optional<cupynumeric::NDArray> einsum(
+    const std::string& subscripts,
+    const std::vector<cupynumeric::NDArray>& operands);
+
+// Contracts a's `a_axes` against b's `b_axes`; the result has a's free axes
+// followed by b's, as numpy.tensordot.
+std::optional<cupynumeric::NDArray> tensordot(
+    const cupynumeric::NDArray& a, const cupynumeric::NDArray& b,
+    const std::vector<int32_t>& a_axes, const std::vector<int32_t>& b_axes);
+
+// The contraction order chosen for `subscripts` and `shapes`: pairs of
+// positions in the operand list, where each step removes both operands and
+// appends their product. Empty if the expression is invalid.
+std::vector<std::pair<int32_t, int32_t>> einsum_path(
+    const std::string& subscripts,
+    const std::vector<std::vector<uint64_t>>& shapes);
+
+}  // namespace tasks
@@ -0,0 +1,90 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahhal <naderrahhal2026@u.northwestern.edu>
+ */
+
+#pragma once
+
+#include <cupynumeric/ndarray.h>
+
+#include <cstdint>
+
+#include "legate.h"
+#include "tasks.h"
+
+namespace tasks {
+
+// Instructions of a fused elementwise program. Each one is five int64
+// words {op, code, dst, src0, src1}; registers hold one block of values.
+enum ExprOp : int64_t {
+  EXPR_LOAD,    // dst <- input src0
+  EXPR_CONST,   // dst <- constant src0, splatted
+  EXPR_UNARY,   // dst <- code(src0)
+  EXPR_BINARY,  // dst <- code(src0, src1)
+  EXPR_STORE,   // output dst <- src0
+};
+
+// Runs one recorded subgraph: loads the aligned inputs a block at a time,
+// evaluates the program with vectorized loops and writes every live result.
+class FusedExprTask : public legate::LegateTask<FusedExprTask> {
+ public:
+  static inline const auto TASK_CONFIG =
+      legate::TaskConfig{legate::LocalTaskID{tasks::FUSED_EXPR_TASK}};
+
+  static void cpu_variant(legate::TaskContext context);
+#if LEGATE_DEFINED(LEGATE_USE_OPENMP)
+  static void omp_variant(legate::TaskContext context);
+#endif
+};
+
+// Whether FusedExprTask evaluates the op for elements of type `code`.
+bool fusible_unary(int32_t op_code, legate::Type::Code code);
+bool fusible_binary(int32_t op_code, legate::Type::Code code);
+
+// Deferred mode. While enabled, elementwise ops on equally shaped arrays
+// are recorded instead of launched. Arrays are identified by `key` (the C
+// API handle) until `forget_deferred` is called for it. Recording drops
+// repeated subexpressions; a flush skips results whose arrays were all
+// destroyed and launches one FusedExprTask per connected subgraph.
+// `enabled` nests: deferral ends, with a flush, when the outermost caller
+// disables it. The functions below are safe to call from several threads;
+// each one runs as a single step on the shared recorder.
+void set_deferred(bool enabled);
+bool deferred();
+
+// Returns false, after flushing, when the op has to run eagerly instead.
+bool record_unary(const void* out_key, const cupynumeric::NDArray& out,
+                  int32_t op_code, const void* in_key,
+                  const cupynumeric::NDArray& in);
+bool record_binary(const void* out_key, const cupynumeric::NDArray& out,
+                   int32_t op_code, const void* lhs_key,
+                   const cupynumeric::NDArray& lhs, const void* rhs_key,
+                   const cupynumeric::NDArray& rhs);
+// Remembers the value of a 0-d array so recorded ops can use it inline.
+void record_constant(const void* key, const legate::Scalar& value);
+// Called when the handle `key` is destroyed.
+void forget_deferred(const void* key);
+// Launches everything recorded so far. Cheap when nothing is pending.
+void flush_deferred();
+// Flushes when `key` is the output or an input of a recorded op, so that
+// any other op sees its contents and its readers see the old ones.
+void flush_deferred_for(const void* key);
+// Number of FusedExprTask launches so far.
+uint64_t fused_expr_launches();
+
+}  // namespace tasks
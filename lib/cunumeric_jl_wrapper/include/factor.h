@@ -0,0 +1,84 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahhal <naderrahhal2026@u.northwestern.edu>
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "legate.h"
+#include "tasks.h"
+
+// Dense factorizations and triangular solves over stacks of matrices. Julia
+// launches these as manual tasks over the batch dimensions (see
+// prepare_manual_task_for_batched_matrices), so each point task owns whole
+// matrices and factors them one after another.
+namespace tasks {
+
+// Bits of TrsmTask's scalar(0). Must match the TRSM_* values in
+// src/ndarray/detail/linalg.jl.
+enum TrsmFlags : int32_t {
+  TRSM_LOWER = 1,    // A is lower (else upper) triangular
+  TRSM_ADJOINT = 2,  // solve A^H X = B (A^T for real types)
+  TRSM_UNIT = 4,     // A has an implicit unit diagonal
+};
+
+// input(0): A (..., n, n). output(0): L with A = L L^H and zeros above the
+// diagonal. output(1): Int32 info (..., 1, 1), 0 or the order of the first
+// leading minor that is not positive definite (as LAPACK potrf).
+class PotrfTask : public legate::LegateTask<PotrfTask> {
+ public:
+  static inline const auto TASK_CONFIG =
+      legate::TaskConfig{legate::LocalTaskID{tasks::POTRF_TASK}};
+
+  static void cpu_variant(legate::TaskContext context);
+#if LEGATE_DEFINED(LEGATE_USE_OPENMP)
+  static void omp_variant(legate::TaskContext context);
+#endif
+};
+
+// input(0): A (..., m, n). output(0): packed LU, unit L below the diagonal.
+// output(1): Int32 1-based row interchanges (..., 1, min(m, n)).
+// output(2): Int32 info (..., 1, 1), 0 or the index of the first zero pivot.
+class GetrfTask : public legate::LegateTask<GetrfTask> {
+ public:
+  static inline const auto TASK_CONFIG =
+      legate::TaskConfig{legate::LocalTaskID{tasks::GETRF_TASK}};
+
+  static void cpu_variant(legate::TaskContext context);
+#if LEGATE_DEFINED(LEGATE_USE_OPENMP)
+  static void omp_variant(legate::TaskContext context);
+#endif
+};
+
+// input(0): triangular A (..., n, n). input(1): B (..., n, k). Optional
+// input(2): GETRF interchanges, applied to B's rows first, which makes an LU
+// solve two launches. output(0): X with op(A) X = B. scalar(0): TrsmFlags.
+class TrsmTask : public legate::LegateTask<TrsmTask> {
+ public:
+  static inline const auto TASK_CONFIG =
+      legate::TaskConfig{legate::LocalTaskID{tasks::TRSM_TASK}};
+
+  static void cpu_variant(legate::TaskContext context);
+#if LEGATE_DEFINED(LEGATE_USE_OPENMP)
+  static void omp_variant(legate::TaskContext context);
+#endif
+};
+
+}  // namespace tasks
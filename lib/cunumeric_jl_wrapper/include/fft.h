@@ -0,0 +1,77 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahhal <naderrahhal2026@u.northwestern.edu>
+ */
+
+#pragma once
+
+#include <cupynumeric/ndarray.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "legate.h"
+#include "tasks.h"
+
+// Host FFTs over chosen axes. cuPyNumeric exposes no C++ entry point for its
+// cuFFT task, so this one runs on CPUs and OpenMP, also on GPU builds. Every
+// launch is tiled along an axis it does not transform, so each point task
+// owns whole lines along the transformed ones.
+namespace tasks {
+
+// Must match the CN_FFT_* values in ndarray_c_api.h.
+enum FftKind : int32_t {
+  FFT_C2C = 0,  // complex (or real) in, complex out, same shape
+  FFT_R2C,      // real in; axes[0] shrinks from n to n / 2 + 1
+  FFT_C2R,      // inverse of FFT_R2C; the output shape gives n
+};
+
+// input(0) -> output(0). scalar(0): FftKind. scalar(1): int32 axes, the
+// first being the halved one for FFT_R2C/FFT_C2R. scalar(2): inverse, which
+// also scales by 1 / (product of the transformed lengths).
+class FftTask : public legate::LegateTask<FftTask> {
+ public:
+  static inline const auto TASK_CONFIG =
+      legate::TaskConfig{legate::LocalTaskID{tasks::FFT_TASK}};
+
+  static void cpu_variant(legate::TaskContext context);
+#if LEGATE_DEFINED(LEGATE_USE_OPENMP)
+  static void omp_variant(legate::TaskContext context);
+#endif
+};
+
+// Returns false for an unknown kind, repeated or out of range axes, or
+// shapes and types that do not match the kind. On the host, a transform over
+// every axis of a multi-dimensional array runs as two launches, so that each
+// has an axis to tile.
+bool fft(const cupynumeric::NDArray& input, const cupynumeric::NDArray& output,
+         int32_t kind, const std::vector<int32_t>& axes, bool inverse);
+
+struct FftPlanCacheStats {
+  uint64_t hits;
+  uint64_t misses;
+  uint64_t evictions;
+  uint64_t size;
+};
+
+// Plans (twiddles, bit reversal, Bluestein chirps) are cached per process,
+// keyed by kind, precision, axes, transformed lengths and direction.
+FftPlanCacheStats fft_plan_cache_stats();
+void clear_fft_plan_cache();
+
+}  // namespace tasks
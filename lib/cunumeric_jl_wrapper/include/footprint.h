@@ -0,0 +1,69 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahhal <naderrahhal2026@u.northwestern.edu>
+ */
+
+#pragma once
+
+#include <cupynumeric/ndarray.h>
+
+#include <cstdint>
+
+#include "legate.h"
+#include "tasks.h"
+
+namespace tasks {
+
+// Bytes by where they live. `scalar` counts future-backed stores, which
+// have no instance.
+struct Footprint {
+  uint64_t sysmem;
+  uint64_t fbmem;
+  uint64_t zcmem;
+  uint64_t socketmem;
+  uint64_t scalar;
+};
+
+// Reports, per point task, the memory kind and byte span of the instance
+// the input was mapped to. It only reads metadata, so the GPU variant runs
+// host code and lets the mapper keep device-resident data where it is.
+class FootprintTask : public legate::LegateTask<FootprintTask> {
+ public:
+  static inline const auto TASK_CONFIG =
+      legate::TaskConfig{legate::LocalTaskID{tasks::FOOTPRINT_TASK}};
+
+  static void cpu_variant(legate::TaskContext context);
+#if LEGATE_DEFINED(LEGATE_USE_OPENMP)
+  static void omp_variant(legate::TaskContext context);
+#endif
+#if LEGATE_DEFINED(LEGATE_USE_CUDA)
+  static void gpu_variant(legate::TaskContext context);
+#endif
+};
+
+// Instance bytes behind `arr` as Legate maps it for a task over the whole
+// array: each tile's span from its first to its last element under the
+// instance strides, so padding and layout count and broadcast dimensions
+// do not. Waits for the probe to finish.
+Footprint physical_footprint(const cupynumeric::NDArray& arr);
+
+// Bytes currently allocated in each memory kind of this process, counting
+// every memory once.
+Footprint allocated_footprint();
+
+}  // namespace tasks
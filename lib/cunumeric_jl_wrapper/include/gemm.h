@@ -0,0 +1,60 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahhal <naderrahhal2026@u.northwestern.edu>
+ */
+
+#pragma once
+
+#include <cupynumeric/ndarray.h>
+
+#include <complex>
+
+#include "legate.h"
+#include "tasks.h"
+
+namespace tasks {
+
+// c = alpha * op(a) * op(b) + beta * c, one BLAS gemm per matrix in the tile.
+// Leading dims are batch dims. When the input or accumulation type differs
+// from c's, operands are widened to the accumulation type first.
+class GemmTask : public legate::LegateTask<GemmTask> {
+ public:
+  static inline const auto TASK_CONFIG =
+      legate::TaskConfig{legate::LocalTaskID{tasks::GEMM_TASK}};
+
+  static void cpu_variant(legate::TaskContext context);
+#if LEGATE_DEFINED(LEGATE_USE_OPENMP)
+  static void omp_variant(legate::TaskContext context);
+#endif
+};
+
+// c[..., :, :] = alpha * op(a[..., :, :]) * op(b[..., :, :]) + beta * c for
+// every batch index, where op transposes when the flag is set. op(a) is
+// (m, k), op(b) is (k, n) and c is (m, n); batch dims and element types must
+// match. Returns false if shapes or types do not fit.
+bool gemm(const cupynumeric::NDArray& a, bool trans_a,
+          const cupynumeric::NDArray& b, bool trans_b, cupynumeric::NDArray& c,
+          std::complex<double> alpha = 1.0, std::complex<double> beta = 0.0);
+
+// c = a * b (batched like gemm) with a and b stored as FLOAT16, FLOAT32 or
+// FLOAT64, products accumulated in `acc` (FLOAT32 or FLOAT64) and rounded
+// once into c's type, which is any of the three. Returns false otherwise.
+bool mixed_gemm(const cupynumeric::NDArray& a, const cupynumeric::NDArray& b,
+                cupynumeric::NDArray& c, legate::Type::Code acc);
+
+}  // namespace tasks
@@ -0,0 +1,122 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahhal <naderrahhal2026@u.northwestern.edu>
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+namespace tasks {
+
+// IEEE binary16 held as raw bits. CPU builds have no __half, so host kernels
+// read FLOAT16 stores through this type and widen to float for arithmetic.
+struct Half {
+  uint16_t bits;
+};
+
+static_assert(sizeof(Half) == 2, "Half must match FLOAT16 storage");
+
+// Compilers with _Float16 convert in hardware where the target has it (F16C
+// on x86, FP16 on ARMv8.2) and vectorize the block conversions below; the
+// bit manipulation is the portable fallback.
+#if defined(__FLT16_MAX__)
+#define CN_NATIVE_HALF 1
+#endif
+
+#if defined(CN_NATIVE_HALF)
+inline float half_to_float(Half h) {
+  _Float16 v;
+  std::memcpy(&v, &h.bits, sizeof(v));
+  return static_cast<float>(v);
+}
+
+// Round to nearest, ties to even.
+inline Half float_to_half(float f) {
+  const _Float16 v = static_cast<_Float16>(f);
+  Half h;
+  std::memcpy(&h.bits, &v, sizeof(v));
+  return h;
+}
+#else
+inline float half_to_float(Half h) {
+  const uint32_t sign = static_cast<uint32_t>(h.bits & 0x8000u) << 16;
+  uint32_t exp = (h.bits >> 10) & 0x1fu;
+  uint32_t mant = h.bits & 0x3ffu;
+  uint32_t bits;
+  if (exp == 0x1fu) {  // inf / nan
+    bits = sign | 0x7f800000u | (mant << 13);
+  } else if (exp != 0) {
+    bits = sign | ((exp + 112) << 23) | (mant << 13);
+  } else if (mant == 0) {
+    bits = sign;
+  } else {  // subnormal half is a normal float
+    exp = 113;
+    while ((mant & 0x400u) == 0) {
+      mant <<= 1;
+      --exp;
+    }
+    bits = sign | (exp << 23) | ((mant & 0x3ffu) << 13);
+  }
+  float f;
+  std::memcpy(&f, &bits, sizeof(f));
+  return f;
+}
+
+// Round to nearest, ties to even.
+inline Half float_to_half(float f) {
+  uint32_t x;
+  std::memcpy(&x, &f, sizeof(x));
+  const uint32_t sign = (x >> 16) & 0x8000u;
+  const uint32_t abs = x & 0x7fffffffu;
+  if (abs >= 0x7f800000u)  // inf / nan, keep nan quiet
+    return Half{static_cast<uint16_t>(sign | 0x7c00u |
+                                      (abs > 0x7f800000u ? 0x200u : 0u))};
+  if (abs >= 0x477ff000u)  // rounds past 65504
+    return Half{static_cast<uint16_t>(sign | 0x7c00u)};
+  if (abs < 0x38800000u) {  // below 2^-14: subnormal half or zero
+    if (abs <= 0x33000000u) return Half{static_cast<uint16_t>(sign)};
+    const uint32_t mant = (abs & 0x7fffffu) | 0x800000u;
+    const uint32_t shift = 126 - (abs >> 23);
+    uint32_t h = mant >> shift;
+    const uint32_t rem = mant & ((1u << shift) - 1);
+    const uint32_t halfway = 1u << (shift - 1);
+    if (rem > halfway || (rem == halfway && (h & 1u))) ++h;
+    return Half{static_cast<uint16_t>(sign | h)};
+  }
+  uint32_t h = (((abs >> 23) - 112) << 10) | ((abs >> 13) & 0x3ffu);
+  const uint32_t rem = abs & 0x1fffu;
+  if (rem > 0x1000u || (rem == 0x1000u && (h & 1u))) ++h;  // may carry to exp
+  return Half{static_cast<uint16_t>(sign | h)};
+}
+#endif
+
+// Block conversions for kernels that keep halves in memory and floats in
+// registers.
+inline void widen(const Half* in, float* out, int64_t n) {
+#pragma omp simd
+  for (int64_t i = 0; i < n; ++i) out[i] = half_to_float(in[i]);
+}
+
+inline void narrow(const float* in, Half* out, int64_t n) {
+#pragma omp simd
+  for (int64_t i = 0; i < n; ++i) out[i] = float_to_half(in[i]);
+}
+
+}  // namespace tasks
@@ -0,0 +1,125 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahhal <naderrahhal2026@u.northwestern.edu>
+ */
+
+#pragma once
+
+#include <cupynumeric/ndarray.h>
+
+#include <cstdint>
+#include <optional>
+
+#include "legate.h"
+#include "tasks.h"
+
+namespace tasks {
+
+// How out-of-range flat indices are handled. Must match the CN_INDEX_*
+// values in ndarray_c_api.h.
+enum IndexMode : int32_t {
+  INDEX_CLIP,  // clamp to [0, size - 1]
+  INDEX_WRAP,  // modulo size, so -1 is the last element
+};
+
+// Turns int64 flat indices into points of the indexed array.
+class IndexPointsTask : public legate::LegateTask<IndexPointsTask> {
+ public:
+  static inline const auto TASK_CONFIG =
+      legate::TaskConfig{legate::LocalTaskID{tasks::INDEX_POINTS_TASK}};
+
+  static void cpu_variant(legate::TaskContext context);
+};
+
+// out[i] = src[points[i]]; src is partitioned by the image of the points.
+class TakeTask : public legate::LegateTask<TakeTask> {
+ public:
+  static inline const auto TASK_CONFIG =
+      legate::TaskConfig{legate::LocalTaskID{tasks::TAKE_TASK}};
+
+  static void cpu_variant(legate::TaskContext context);
+#if LEGATE_DEFINED(LEGATE_USE_OPENMP)
+  static void omp_variant(legate::TaskContext context);
+#endif
+};
+
+// Appends the selected elements (or their flat indices) of one tile to an
+// unbound output; Legate concatenates the tiles in launch order.
+class CompressTask : public legate::LegateTask<CompressTask> {
+ public:
+  static inline const auto TASK_CONFIG =
+      legate::TaskConfig{legate::LocalTaskID{tasks::COMPRESS_TASK}};
+
+  static void cpu_variant(legate::TaskContext context);
+};
+
+// arr[mask] = value for a scalar value.
+class MaskFillTask : public legate::LegateTask<MaskFillTask> {
+ public:
+  static inline const auto TASK_CONFIG =
+      legate::TaskConfig{legate::LocalTaskID{tasks::MASK_FILL_TASK}};
+
+  static void cpu_variant(legate::TaskContext context);
+#if LEGATE_DEFINED(LEGATE_USE_OPENMP)
+  static void omp_variant(legate::TaskContext context);
+#endif
+};
+
+// Flat indices are 0-based and count in row-major order unless
+// `column_major` is set. `indices` must be a 1-D int64 array.
+
+// The elements of `arr` at `indices` as a 1-D array.
+std::optional<cupynumeric::NDArray> take(const cupynumeric::NDArray& arr,
+                                         const cupynumeric::NDArray& indices,
+                                         int32_t mode, bool column_major);
+
+// arr.flat[indices] = values, with one value per index. With repeated
+// indices, one of the values wins.
+bool put(cupynumeric::NDArray& arr, const cupynumeric::NDArray& indices,
+         const cupynumeric::NDArray& values, int32_t mode, bool column_major);
+
+// The elements of `arr` where `mask` (a bool array of the same shape) is
+// true, in flat order.
+std::optional<cupynumeric::NDArray> compress(const cupynumeric::NDArray& arr,
+                                             const cupynumeric::NDArray& mask,
+                                             bool column_major);
+
+// The flat indices (int64) where `mask` is true.
+std::optional<cupynumeric::NDArray> mask_indices(
+    const cupynumeric::NDArray& mask, bool column_major);
+
+// arr[mask] = value, with `value` of the array's type.
+bool mask_fill(cupynumeric::NDArray& arr, const cupynumeric::NDArray& mask,
+               const legate::Scalar& value);
+
+// arr[mask] = values, taking one value per true element in flat order.
+// Waits for the number of true elements to check the size of `values`.
+bool mask_assign(cupynumeric::NDArray& arr, const cupynumeric::NDArray& mask,
+                 const cupynumeric::NDArray& values, bool column_major);
+
+// Batched point access from host coordinate lists: `coords` holds n points
+// of arr.dim() 0-based int64 coordinates each, one point after another.
+// gather_points fills `out` (n elements of arr's type) and waits once for
+// the values; scatter_points writes n values from host memory without
+// waiting. Both return false if a coordinate is out of bounds.
+bool gather_points(const cupynumeric::NDArray& arr, const int64_t* coords,
+                   int64_t n, void* out);
+bool scatter_points(cupynumeric::NDArray& arr, const int64_t* coords,
+                    const void* values, int64_t n);
+
+}  // namespace tasks
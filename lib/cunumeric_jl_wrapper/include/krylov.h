@@ -0,0 +1,80 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahhal <naderrahhal2026@u.northwestern.edu>
+ */
+
+#pragma once
+
+#include <cupynumeric/ndarray.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "legate.h"
+#include "tasks.h"
+
+// Vector updates of the Krylov solvers in src/ndarray/krylov.jl. Each op
+// touches every vector once and accumulates the dot products the next step
+// needs in the same pass, so an iteration costs the operator applications
+// plus one or two launches. Scalar coefficients stay in 0-d Float64 arrays
+// and are only read inside the tasks; nothing here waits on a reduction.
+namespace tasks {
+
+// Must match the CN_KRYLOV_* values in ndarray_c_api.h. Vectors are listed
+// written ones first; "<-" marks the dot products returned.
+enum KrylovOp : int32_t {
+  // u1, v1, u2, v2, ...                       <- u1.v1, u2.v2, ...
+  KRYLOV_DOTS = 0,
+  // x, r | p, q; rr, pq: a = rr / pq, x += a p, r -= a q        <- r.r
+  KRYLOV_CG,
+  // p | r; rr_new, rr: p = r + (rr_new / rr) p
+  KRYLOV_CG_DIRECTION,
+  // x, r, w, p, s, z | q; g, d[, g_old, a_old]: pipelined CG step
+  // (Ghysels and Vanroose), b = 0 without the last two  <- r.r, w.r, a
+  KRYLOV_PIPECG,
+  // s | r, v; rho, rv: s = r - (rho / rv) v
+  KRYLOV_BICG_S,
+  // x, r | p, s, t, rhat; rho, rv, ts, tt: x += a p + w s, r = s - w t
+  //                                                     <- rhat.r, r.r
+  KRYLOV_BICG_X,
+  // p | r, v; rho_new, rho, rv, ts, tt: p = r + b (p - w v)
+  KRYLOV_BICG_P,
+};
+
+// inputs: the op's vectors, then its 0-d Float64 coefficients. outputs: the
+// vectors it writes (also inputs). reductions: 0-d Float64 sums.
+// scalar(0): KrylovOp.
+class KrylovTask : public legate::LegateTask<KrylovTask> {
+ public:
+  static inline const auto TASK_CONFIG =
+      legate::TaskConfig{legate::LocalTaskID{tasks::KRYLOV_TASK}};
+
+  static void cpu_variant(legate::TaskContext context);
+#if LEGATE_DEFINED(LEGATE_USE_OPENMP)
+  static void omp_variant(legate::TaskContext context);
+#endif
+};
+
+// Launches `op` over 1-D Float32/Float64 vectors of one shape and appends
+// its dot products to `dots` as new 0-d Float64 arrays. Returns false for
+// an unknown op or operands that do not fit it.
+bool krylov(int32_t op, const std::vector<cupynumeric::NDArray>& vecs,
+            const std::vector<cupynumeric::NDArray>& coeffs,
+            std::vector<cupynumeric::NDArray>& dots);
+
+}  // namespace tasks
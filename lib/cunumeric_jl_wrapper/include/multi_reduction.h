@@ -0,0 +1,67 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahhal <naderrahhal2026@u.northwestern.edu>
+ */
+
+#pragma once
+
+#include <cupynumeric/ndarray.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "legate.h"
+#include "tasks.h"
+
+namespace tasks {
+
+// Statistics nda_multi_reduction understands on top of
+// CuPyNumericUnaryRedCode. Must match the values in ndarray_c_api.h.
+enum MultiStat : int32_t {
+  STAT_MEAN = 1 << 16,
+  STAT_SAMPLE_VARIANCE,
+};
+
+// Per-tile pass: one row of running statistics per point task.
+class MultiReductionTask : public legate::LegateTask<MultiReductionTask> {
+ public:
+  static inline const auto TASK_CONFIG =
+      legate::TaskConfig{legate::LocalTaskID{tasks::MULTI_REDUCTION_TASK}};
+
+  static void cpu_variant(legate::TaskContext context);
+#if LEGATE_DEFINED(LEGATE_USE_OPENMP)
+  static void omp_variant(legate::TaskContext context);
+#endif
+};
+
+// Folds the per-tile rows and writes one 0-d output per requested statistic.
+class MultiReductionMergeTask
+    : public legate::LegateTask<MultiReductionMergeTask> {
+ public:
+  static inline const auto TASK_CONFIG = legate::TaskConfig{
+      legate::LocalTaskID{tasks::MULTI_REDUCTION_MERGE_TASK}};
+
+  static void cpu_variant(legate::TaskContext context);
+};
+
+// Returns false if a code or the input type is not supported.
+bool multi_reduction(const cupynumeric::NDArray& input,
+                     const std::vector<int32_t>& codes,
+                     std::vector<cupynumeric::NDArray>& outs);
+
+}  // namespace tasks
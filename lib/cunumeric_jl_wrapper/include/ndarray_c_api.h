@@ -22,6 +22,7 @@
 #define NDARRAY_C_API_H
 
 #include <cupynumeric/cupynumeric_c.h>
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -46,11 +47,17 @@ CN_NDArray* nda_store_to_ndarray(CN_Store* st);
 
 uint64_t nda_query_device_memory();
 
+// Registers the wrapper's host tasks (tasks.h). Call once after the runtime
+// has started.
+void nda_register_tasks();
+
 // zeros(shape, type?)
 //   dim        : number of dimensions
 //   shape      : pointer to array[length=dim]
 //   CN_Type    : Legate type of object
 CN_NDArray* nda_zeros_array(int32_t dim, const uint64_t* shape, CN_Type type);
+// Same as zeros without the fill. 0-d results are future-backed.
+CN_NDArray* nda_empty_array(int32_t dim, const uint64_t* shape, CN_Type type);
 
 // full(shape, value)
 //   dim   : number of dimensions
@@ -58,10 +65,56 @@ CN_NDArray* nda_zeros_array(int32_t dim, const uint64_t* shape, CN_Type type);
 //   value : double‐precision scalar
 CN_NDArray* nda_full_array(int32_t dim, const uint64_t* shape, CN_Type type,
                            const void* value);
+// Read-only 0-d array holding `value`. Equal values of the same type share
+// one future-backed store from a bounded LRU cache, so repeated literals do
+// not allocate; never use the result as an output.
+CN_NDArray* nda_from_scalar(CN_Type type, const void* value);
+
+typedef struct {
+  uint64_t hits;
+  uint64_t misses;
+  uint64_t evictions;
+  uint64_t size;
+  uint64_t capacity;
+} CN_ScalarCacheStats;
+void nda_scalar_cache_stats(CN_ScalarCacheStats* out);
+// Default 256 stores; 0 disables sharing. Shrinking evicts immediately.
+void nda_set_scalar_cache_capacity(uint64_t capacity);
+// Drops every cached store; call before the runtime shuts down.
+void nda_clear_scalar_cache();
+
+// Spilling of cold arrays to memory-mapped scratch files under `dir`.
+// Returns false when the run spans several processes. Disabling fills every
+// spilled array back in.
+bool nda_set_spilling(bool enabled, const char* dir);
+// Makes a handle a spill candidate. Only for handles that are the sole
+// owner of their storage; views are never tracked.
+void nda_track_spill(CN_NDArray* arr);
+// Keeps a tracked handle resident from now on, e.g. once its store escaped.
+void nda_pin_spill(CN_NDArray* arr);
+// Spills least recently used candidates until `bytes` were released.
+// Returns the bytes spilled.
+uint64_t nda_spill_cold(uint64_t bytes);
+
+typedef struct {
+  uint64_t spills;
+  uint64_t fills;
+  uint64_t spilled_bytes;
+  uint64_t filled_bytes;
+  uint64_t resident_bytes;
+  uint64_t tracked;
+} CN_SpillStats;
+void nda_spill_stats(CN_SpillStats* out);
 void nda_random(CN_NDArray* arr, int32_t code);
 CN_NDArray* nda_random_array(int32_t dim, const uint64_t* shape);
 CN_NDArray* nda_reshape_array(CN_NDArray* arr, int32_t dim,
                               const uint64_t* shape);
+// Read-only view of `arr` expanded to `shape` (length `dim`). Dimensions
+// are aligned from the front; extent-1 and missing trailing dimensions get
+// stride 0, so no data is copied. Returns NULL if the shapes are
+// incompatible.
+CN_NDArray* nda_broadcast_to(CN_NDArray* arr, int32_t dim,
+                             const uint64_t* shape);
 CN_NDArray* nda_astype(CN_NDArray* arr, CN_Type type);
 void nda_fill_array(CN_NDArray* arr, CN_Type type, const void* value);
 
@@ -72,6 +125,136 @@ CN_NDArray* nda_multiply_scalar(CN_NDArray* rhs1, CN_Type type,
 CN_NDArray* nda_add_scalar(CN_NDArray* rhs1, CN_Type type, const void* value);
 CN_NDArray* nda_dot(CN_NDArray* rhs1, CN_NDArray* rhs2);
 void nda_three_dot_arg(CN_NDArray* rhs1, CN_NDArray* rhs2, CN_NDArray* out);
+// out[..., :, :] = a[..., :, :] * b[..., :, :], one task per tile of batch
+// indices. Returns false on mismatched shapes or non-BLAS element types.
+bool nda_batched_matmul(CN_NDArray* out, CN_NDArray* a, CN_NDArray* b);
+bool nda_gemm(CN_NDArray* out, CN_NDArray* a, bool trans_a, CN_NDArray* b,
+              bool trans_b, const void* alpha, const void* beta);
+bool nda_matmul_mixed(CN_NDArray* out, CN_NDArray* a, CN_NDArray* b,
+                      CN_Type acc_type);
+// einsum/tensordot return NULL for invalid or unsupported expressions.
+// nda_einsum_path writes the chosen contraction order as (i, j) pairs into
+// out_path (2 * (num_operands - 1) entries) and returns the number of steps,
+// or -1; `shapes` holds every operand's extents back to back.
+CN_NDArray* nda_einsum(const char* subscripts, int32_t num_operands,
+                       CN_NDArray** operands);
+CN_NDArray* nda_tensordot(CN_NDArray* a, CN_NDArray* b, int32_t num_axes,
+                          const int32_t* a_axes, const int32_t* b_axes);
+int32_t nda_einsum_path(const char* subscripts, int32_t num_operands,
+                        const int32_t* dims, const uint64_t* shapes,
+                        int32_t* out_path);
+
+// CSR sparse matrices: rowptr (rows + 1), colind (nnz, 0-based) and values
+// (nnz). nda_csr_row_ranges turns rowptr into the per-row ranges the SpMV
+// (y = A x) and SpMM (Y = A X) entry points take; it returns NULL and they
+// return false on bad shapes or types.
+CN_NDArray* nda_csr_row_ranges(CN_NDArray* rowptr);
+bool nda_csr_spmv(CN_NDArray* y, CN_NDArray* row_ranges, CN_NDArray* colind,
+                  CN_NDArray* values, CN_NDArray* x);
+bool nda_csr_spmm(CN_NDArray* y, CN_NDArray* row_ranges, CN_NDArray* colind,
+                  CN_NDArray* values, CN_NDArray* x);
+
+// Sorting along `axis`; a negative `axis` with `flatten` set sorts every
+// element of the flattened array. nullptr on a bad axis or kth.
+CN_NDArray* nda_sort(CN_NDArray* arr, int32_t axis, bool flatten, bool stable,
+                     bool descending);
+CN_NDArray* nda_argsort(CN_NDArray* arr, int32_t axis, bool flatten,
+                        bool stable, bool descending);
+CN_NDArray* nda_partition(CN_NDArray* arr, int64_t kth, int32_t axis);
+CN_NDArray* nda_argpartition(CN_NDArray* arr, int64_t kth, int32_t axis);
+// Writes the k best elements and their row-major flat indices (int64) into
+// the preallocated 1-D `values` and `indices`.
+bool nda_topk(CN_NDArray* arr, int64_t k, bool largest, CN_NDArray* values,
+              CN_NDArray* indices);
+
+// Scan operators for nda_scan. The NaN variants count NaN as the identity.
+enum {
+  CN_SCAN_SUM = 0,
+  CN_SCAN_PROD,
+  CN_SCAN_NANSUM,
+  CN_SCAN_NANPROD,
+};
+// Cumulative `op` of `input` along `axis` into `out`, which must have the
+// input's shape and type (and may be the input). An exclusive scan shifts
+// the result by one, starting every line at the identity. Returns false for
+// a bad op or axis, mismatched operands, or bool, half and 0-d inputs.
+bool nda_scan(CN_NDArray* out, int32_t op, CN_NDArray* input, int32_t axis,
+              bool inclusive);
+
+// Gather/scatter by flat index and boolean-mask selection. Indices are
+// 0-based int64 1-D arrays counting in row-major order, or column-major
+// (Julia's linear indexing) when `column_major` is set. The index arrays
+// stay in Legate stores; the data moves through image-partitioned tasks.
+enum {
+  CN_INDEX_CLIP = 0,  // clamp out-of-range indices
+  CN_INDEX_WRAP,      // indices modulo the size, so -1 is the last element
+};
+CN_NDArray* nda_take(CN_NDArray* arr, CN_NDArray* indices, int32_t mode,
+                     bool column_major);
+// One 1-D value per index, of the array's type.
+bool nda_put(CN_NDArray* arr, CN_NDArray* indices, CN_NDArray* values,
+             int32_t mode, bool column_major);
+// Elements where the bool `mask` (the array's shape) is true, as a 1-D array.
+CN_NDArray* nda_compress(CN_NDArray* arr, CN_NDArray* mask,
+                         bool column_major);
+// Flat int64 indices where `mask` is true.
+CN_NDArray* nda_mask_indices(CN_NDArray* mask, bool column_major);
+bool nda_mask_fill(CN_NDArray* arr, CN_NDArray* mask, CN_Type type,
+                   const void* value);
+// One 1-D value per true element of `mask`; waits on the mask count.
+bool nda_mask_assign(CN_NDArray* arr, CN_NDArray* mask, CN_NDArray* values,
+                     bool column_major);
+// Reads/writes n scattered elements in one task. `coords` holds n points of
+// arr's dim 0-based coordinates each, point after point; `out_buf`/`values`
+// hold n elements of arr's type. Gather waits once for the values. Returns
+// false if a coordinate is out of bounds.
+bool nda_gather_points(CN_NDArray* arr, const int64_t* coords, int64_t n,
+                       void* out_buf);
+bool nda_scatter_points(CN_NDArray* arr, const int64_t* coords,
+                        const void* values, int64_t n);
+
+// Border rules for nda_pad.
+enum {
+  CN_PAD_CONSTANT = 0,  // fill with `value`
+  CN_PAD_EDGE,          // repeat the nearest edge element
+  CN_PAD_WRAP,          // periodic
+};
+// `arr` grown by widths[2 * d] elements before and widths[2 * d + 1] after
+// each dimension d, in one pass that writes every output element once.
+// `value` (of the array's type) is only read for CN_PAD_CONSTANT. Returns
+// NULL for an unknown mode or edge/wrap padding of an empty dimension.
+CN_NDArray* nda_pad(CN_NDArray* arr, const uint64_t* widths, int32_t mode,
+                    CN_Type type, const void* value);
+// Joins arrays of one type along an existing (concatenate) or new (stack)
+// dimension. Each input is copied straight into its slice of the result.
+// Returns NULL on a type, rank or extent mismatch.
+CN_NDArray* nda_concatenate(int32_t num_arrays, CN_NDArray** arrs,
+                            int32_t axis);
+CN_NDArray* nda_stack(int32_t num_arrays, CN_NDArray** arrs, int32_t axis);
+// Inline maps `arr` on the host and reports the descriptor RunPTXTask would
+// pack for it: origin pointer plus per-dimension extents and element
+// strides (0 along broadcast dimensions). Returns false for 0-d arrays.
+bool nda_strided_descriptor(CN_NDArray* arr, void** ptr, uint64_t* dims,
+                            uint64_t* strides);
+// Saves each array under names[i] in `dir` (created if needed): every tile
+// is written concurrently as its own shard file, optionally byte-shuffled
+// and LZ-compressed, and `dir`/manifest indexes the shards. Blocks until
+// the shards are on disk. Names may only use [A-Za-z0-9_-]. Returns false
+// for bad names, 0-d arrays or when any shard or the manifest could not be
+// written; arrays that failed keep their previous checkpoint.
+bool nda_checkpoint(int32_t num_arrays, CN_NDArray** arrs, const char** names,
+                    const char* dir, bool compress);
+enum {
+  CN_RESTORE_OK = 0,
+  CN_RESTORE_MISSING,  // a name is not in the checkpoint
+  CN_RESTORE_CORRUPT,  // its shards are incomplete, unreadable or mismatched
+};
+// Reads the arrays saved under `names` into out[0..num_arrays). Tiles are
+// filled from whichever shards overlap them, so the processor count may
+// differ from the one that wrote the checkpoint. Blocks until the shards are
+// read and returns a CN_RESTORE_* code; `out` is only set on CN_RESTORE_OK.
+int32_t nda_restore(int32_t num_arrays, const char** names, const char* dir,
+                    CN_NDArray** out);
 CN_NDArray* nda_copy(CN_NDArray* arr);
 void nda_assign(CN_NDArray* arr, CN_NDArray* other);
 
@@ -80,17 +263,139 @@ void nda_destroy_array(CN_NDArray* arr);
 // simple queries
 int32_t nda_array_dim(const CN_NDArray* arr);
 uint64_t nda_array_size(const CN_NDArray* arr);
+// Copies the single element of a 0-d array into `out`. Blocks until the
+// producing task finished.
+void nda_read_scalar(const CN_NDArray* arr, void* out);
 int32_t nda_array_type_code(const CN_NDArray* arr);
 CN_Type* nda_array_type(const CN_NDArray* arr);
 void nda_array_shape(const CN_NDArray* arr, uint64_t* out_shape);
+// Predicted size: element size times element count.
 uint64_t nda_nbytes(CN_NDArray* arr);
 
+// Bytes by memory kind. `scalar` counts future-backed stores.
+typedef struct {
+  uint64_t sysmem;
+  uint64_t fbmem;
+  uint64_t zcmem;
+  uint64_t socketmem;
+  uint64_t scalar;
+} CN_Footprint;
+// Instance bytes behind `arr` as Legate maps it, padding and layout
+// included. Launches a probe task and blocks until it finished.
+void nda_physical_footprint(CN_NDArray* arr, CN_Footprint* out);
+// Sum of nda_physical_footprint over every memory kind.
+uint64_t nda_physical_bytes(CN_NDArray* arr);
+// Bytes allocated in each memory kind of this process; `scalar` is 0.
+void nda_allocated_footprint(CN_Footprint* out);
+
 void nda_binary_op(CN_NDArray* out, CuPyNumericBinaryOpCode op_code,
                    const CN_NDArray* rhs1, const CN_NDArray* rhs2);
 void nda_unary_op(CN_NDArray* out, CuPyNumericUnaryOpCode op_code,
                   CN_NDArray* input);
+// Deferred elementwise mode (calls nest; the outermost disable flushes).
+// While enabled, nda_unary_op and nda_binary_op into a fresh output are
+// recorded when every operand has the output's shape and type, or is a 0-d
+// array made by nda_from_scalar/nda_full_array, and the type is Float32,
+// Float64, Int32 or Int64. A flush drops results whose arrays were
+// destroyed and reuses repeated subexpressions, then launches one fused host
+// task per connected subgraph. Anything else runs eagerly after a flush.
+// Every other entry point that is handed a pending array (the output or an
+// input of a recorded op) flushes before using it.
+void nda_set_deferred(bool enabled);
+void nda_flush_deferred();
+// Number of fused tasks launched by deferred mode so far.
+uint64_t nda_fused_expr_launches();
 void nda_unary_reduction(CN_NDArray* out, CuPyNumericUnaryRedCode op_code,
                          CN_NDArray* input);
+
+// Reduction over `axes` (num_axes == 0 reduces over all axes)
+//   dtype   : accumulation/result type (may differ from the input type)
+//   initial : optional pointer to a `dtype` starting value, NULL for identity
+//   where   : optional Bool mask broadcastable to `input`, NULL for none
+// Several axes that are not all of them are reduced one axis at a time, which
+// needs an associative op; returns NULL for ops that are not (ARGMAX, ...).
+CN_NDArray* nda_unary_reduction_axes(CuPyNumericUnaryRedCode op_code,
+                                     CN_NDArray* input, const int32_t* axes,
+                                     int32_t num_axes, bool keepdims,
+                                     CN_Type dtype, const void* initial,
+                                     const CN_NDArray* where);
+// Same as above but reduces into `out`, accumulating in out's type.
+// Returns false when the op cannot be chained over the requested axes.
+bool nda_unary_reduction_axes_out(CN_NDArray* out,
+                                  CuPyNumericUnaryRedCode op_code,
+                                  CN_NDArray* input, const int32_t* axes,
+                                  int32_t num_axes, bool keepdims,
+                                  const void* initial,
+                                  const CN_NDArray* where);
+
+// Statistics nda_multi_reduction accepts besides CuPyNumericUnaryRedCode
+// (MIN, MAX, SUM, SUM_SQUARES, COUNT_NONZERO and VARIANCE).
+enum {
+  CN_STAT_MEAN = 1 << 16,
+  CN_STAT_SAMPLE_VARIANCE,  // m2 / (n - 1)
+};
+// Computes `num_codes` statistics of a Float32/Float64 array in one pass
+// over the data and writes each into the matching 0-d array in `outs`.
+// Mean and variance use a blocked Welford update. Min/max skip NaNs.
+// Returns false for unsupported codes or input types.
+bool nda_multi_reduction(CN_NDArray* input, const int32_t* codes,
+                         int32_t num_codes, CN_NDArray** outs);
+// Transform kinds for nda_fft.
+enum {
+  CN_FFT_C2C = 0,  // real or complex in, complex out
+  CN_FFT_R2C,      // real in, axes[0] shrinks from n to n / 2 + 1
+  CN_FFT_C2R,      // inverse of CN_FFT_R2C, out's shape gives n
+};
+// Discrete Fourier transform of `in` into `out` over the 0-based `axes`, on
+// CPU/OpenMP tasks (also on GPU builds). `inverse` uses exp(+2 pi i jk / n) and scales by
+// 1 / (product of the transformed lengths); CN_FFT_R2C must be forward and
+// CN_FFT_C2R inverse. Both arrays have one precision. Returns false for
+// repeated or out of range axes or shapes and types that do not fit `kind`.
+bool nda_fft(CN_NDArray* in, CN_NDArray* out, int32_t kind,
+             const int32_t* axes, int32_t num_axes, bool inverse);
+typedef struct {
+  uint64_t hits;
+  uint64_t misses;
+  uint64_t evictions;
+  uint64_t size;
+} CN_FFTPlanCacheStats;
+// Plans are cached per process by kind, precision, axes, transformed lengths
+// and direction (at most 64, least recently used dropped first), so repeated
+// transforms of one shape skip planning.
+void nda_fft_plan_cache_stats(CN_FFTPlanCacheStats* out);
+void nda_clear_fft_plan_cache();
+// How nda_convolve evaluates; the boundary mode is a CN_PAD_* value.
+enum {
+  CN_CONVOLVE_AUTO = 0,  // direct for small kernels, FFT for large ones
+  CN_CONVOLVE_DIRECT,    // one stencil pass, tiles exchange a halo
+  CN_CONVOLVE_FFT,       // through nda_fft over the padded array
+};
+// `arr` correlated (or, with `flip`, convolved) with `weights`, a kernel of
+// the same type and rank centred at extent / 2. The result has `arr`'s
+// shape; reads past its border follow `mode`, with `value` (of the array's
+// type) for CN_PAD_CONSTANT. Float32/Float64 and complex arrays only.
+// Returns NULL for an unknown mode or method or mismatched operands.
+CN_NDArray* nda_convolve(CN_NDArray* arr, CN_NDArray* weights, int32_t mode,
+                         bool flip, int32_t method, CN_Type type,
+                         const void* value);
+// Fused vector updates of the Krylov solvers; see include/krylov.h for
+// the operands each op takes.
+enum {
+  CN_KRYLOV_DOTS = 0,
+  CN_KRYLOV_CG,
+  CN_KRYLOV_CG_DIRECTION,
+  CN_KRYLOV_PIPECG,
+  CN_KRYLOV_BICG_S,
+  CN_KRYLOV_BICG_X,
+  CN_KRYLOV_BICG_P,
+};
+// `vecs` are 1-D Float32/Float64 arrays of one shape, written ones first,
+// and `coeffs` 0-d Float64 arrays. Stores the op's dot products as new 0-d
+// Float64 arrays in `dots` (room for four) and their count in `num_dots`.
+// Never waits for the result. Returns false when the operands do not fit.
+bool nda_krylov(int32_t op, int32_t num_vecs, CN_NDArray** vecs,
+                int32_t num_coeffs, CN_NDArray** coeffs, CN_NDArray** dots,
+                int32_t* num_dots);
 CN_NDArray* nda_get_slice(CN_NDArray* arr, const CN_Slice* slices,
                           int32_t ndim);
 CN_NDArray* nda_attach_external(const void* ptr, size_t size, int dim,
@@ -0,0 +1,61 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahhal <naderrahhal2026@u.northwestern.edu>
+ */
+
+#pragma once
+
+#include <cupynumeric/ndarray.h>
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "legate.h"
+
+namespace tasks {
+
+// How the border of a padded array is filled. Must match the CN_PAD_*
+// values in ndarray_c_api.h.
+enum PadMode : int32_t {
+  PAD_CONSTANT,  // a single fill value
+  PAD_EDGE,      // repeat the nearest edge element
+  PAD_WRAP,      // periodic: continue from the opposite side
+};
+
+// `arr` grown by widths[2 * d] elements before and widths[2 * d + 1] after
+// dimension d. `value` is used by PAD_CONSTANT only. Built from Legate
+// copies and fills that write each output element once without handing the
+// whole source to every tile. Returns nullopt for an unknown mode, a 0-d
+// input, or edge/wrap padding of an empty dimension.
+std::optional<cupynumeric::NDArray> pad(const cupynumeric::NDArray& arr,
+                                        const std::vector<uint64_t>& widths,
+                                        int32_t mode,
+                                        const legate::Scalar& value);
+
+// Joins `arrs` along the existing dimension `axis`. Each input is copied
+// straight into its slice of the output. Returns nullopt when the inputs
+// differ in type, rank, or any extent other than `axis`.
+std::optional<cupynumeric::NDArray> concatenate(
+    const std::vector<cupynumeric::NDArray>& arrs, int32_t axis);
+
+// Joins equally shaped `arrs` along a new dimension inserted at `axis`.
+std::optional<cupynumeric::NDArray> stack(
+    const std::vector<cupynumeric::NDArray>& arrs, int32_t axis);
+
+}  // namespace tasks
@@ -0,0 +1,49 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahhal <naderrahhal2026@u.northwestern.edu>
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "legate.h"
+
+namespace tasks {
+
+struct ScalarCacheStats {
+  uint64_t hits;
+  uint64_t misses;
+  uint64_t evictions;
+  uint64_t size;
+  uint64_t capacity;
+};
+
+// Future-backed 0-d store holding `value`, shared by every caller asking for
+// the same type and bytes. Callers must treat it as read-only. Once the
+// cache holds `capacity` stores, the least recently used one is dropped; a
+// capacity of 0 disables sharing.
+legate::LogicalStore interned_scalar_store(const legate::Scalar& value);
+
+ScalarCacheStats scalar_cache_stats();
+// Shrinking evicts immediately.
+void set_scalar_cache_capacity(uint64_t capacity);
+// Releases every cached store. Must run before the runtime shuts down.
+void clear_scalar_cache();
+
+}  // namespace tasks
@@ -0,0 +1,73 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahhal <naderrahhal2026@u.northwestern.edu>
+ */
+
+#pragma once
+
+#include <cupynumeric/ndarray.h>
+
+#include <cstdint>
+
+#include "legate.h"
+#include "tasks.h"
+
+namespace tasks {
+
+// Scan operators. Must match the CN_SCAN_* values in ndarray_c_api.h.
+enum ScanOp : int32_t {
+  SCAN_SUM,
+  SCAN_PROD,
+  SCAN_NANSUM,   // NaN counts as 0
+  SCAN_NANPROD,  // NaN counts as 1
+};
+
+// First pass: scans each line of the tile along the axis and, when the axis
+// itself is tiled, writes the line totals into one slab per tile.
+class ScanTask : public legate::LegateTask<ScanTask> {
+ public:
+  static inline const auto TASK_CONFIG =
+      legate::TaskConfig{legate::LocalTaskID{tasks::SCAN_TASK}};
+
+  static void cpu_variant(legate::TaskContext context);
+#if LEGATE_DEFINED(LEGATE_USE_OPENMP)
+  static void omp_variant(legate::TaskContext context);
+#endif
+};
+
+// Second pass: folds the totals of the preceding tiles into a carry and
+// applies it to every element of the tile.
+class ScanCarryTask : public legate::LegateTask<ScanCarryTask> {
+ public:
+  static inline const auto TASK_CONFIG =
+      legate::TaskConfig{legate::LocalTaskID{tasks::SCAN_CARRY_TASK}};
+
+  static void cpu_variant(legate::TaskContext context);
+#if LEGATE_DEFINED(LEGATE_USE_OPENMP)
+  static void omp_variant(legate::TaskContext context);
+#endif
+};
+
+// Cumulative `op` of `input` along `axis` into `out` (same shape and type).
+// An exclusive scan starts every line at the identity. `out` may be `input`.
+// Half inputs are scanned in float; bool inputs only for products. Returns
+// false for a bad op or axis, mismatched operands, bool sums or 0-d inputs.
+bool scan(cupynumeric::NDArray& out, int32_t op,
+          const cupynumeric::NDArray& input, int32_t axis, bool inclusive);
+
+}  // namespace tasks
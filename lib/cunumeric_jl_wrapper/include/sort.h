@@ -0,0 +1,80 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahhal <naderrahhal2026@u.northwestern.edu>
+ */
+
+#pragma once
+
+#include <cupynumeric/ndarray.h>
+
+#include <cstdint>
+#include <optional>
+
+#include "legate.h"
+#include "tasks.h"
+
+namespace tasks {
+
+// Per-tile pass of top-k: a bounded heap over the tile, written as one row
+// of (value, flat index) candidates padded with index -1.
+class TopKTask : public legate::LegateTask<TopKTask> {
+ public:
+  static inline const auto TASK_CONFIG =
+      legate::TaskConfig{legate::LocalTaskID{tasks::TOPK_TASK}};
+
+  static void cpu_variant(legate::TaskContext context);
+#if LEGATE_DEFINED(LEGATE_USE_OPENMP)
+  static void omp_variant(legate::TaskContext context);
+#endif
+};
+
+// Merges the candidate rows into the final k, best first.
+class TopKMergeTask : public legate::LegateTask<TopKMergeTask> {
+ public:
+  static inline const auto TASK_CONFIG =
+      legate::TaskConfig{legate::LocalTaskID{tasks::TOPK_MERGE_TASK}};
+
+  static void cpu_variant(legate::TaskContext context);
+};
+
+// Sort / argsort along `axis` (every element when nullopt, which flattens).
+// With `descending` and `stable`, equal keys keep their original order.
+std::optional<cupynumeric::NDArray> sort(const cupynumeric::NDArray& input,
+                                         std::optional<int32_t> axis,
+                                         bool stable, bool descending);
+std::optional<cupynumeric::NDArray> argsort(const cupynumeric::NDArray& input,
+                                            std::optional<int32_t> axis,
+                                            bool stable, bool descending);
+
+// numpy partition/argpartition: element `kth` along `axis` lands where a sort
+// would put it, with nothing larger before it and nothing smaller after.
+// Implemented as a full sort along `axis`, not a selection.
+std::optional<cupynumeric::NDArray> partition(
+    const cupynumeric::NDArray& input, int64_t kth, int32_t axis);
+std::optional<cupynumeric::NDArray> argpartition(
+    const cupynumeric::NDArray& input, int64_t kth, int32_t axis);
+
+// The k largest (or smallest) elements of `input` and their column-major
+// (dim 0 fastest) flat indices, best first, without sorting the array. NaN ranks above every
+// number; ties go to the lower index. `values` (k, input's type) and
+// `indices` (k, int64) are written. Returns false for complex/half inputs
+// or k outside [1, size].
+bool topk(const cupynumeric::NDArray& input, int64_t k, bool largest,
+          cupynumeric::NDArray& values, cupynumeric::NDArray& indices);
+
+}  // namespace tasks
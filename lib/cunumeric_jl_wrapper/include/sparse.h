@@ -0,0 +1,87 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahhal <naderrahhal2026@u.northwestern.edu>
+ */
+
+#pragma once
+
+#include <cupynumeric/ndarray.h>
+
+#include <optional>
+
+#include "legate.h"
+#include "tasks.h"
+
+namespace tasks {
+
+// A CSR matrix is three 1-d arrays: row pointers (rows + 1, int64), column
+// indices (nnz, int64, 0-based) and values (nnz). The tasks below take the
+// row pointers in "row range" form, one Rect<1> [start, end] per row, so the
+// rows tile evenly and the index/value arrays follow through an image
+// partition.
+
+// row_ranges[i] = [rowptr[i], rowptr[i + 1] - 1]
+class CSRRowRangesTask : public legate::LegateTask<CSRRowRangesTask> {
+ public:
+  static inline const auto TASK_CONFIG =
+      legate::TaskConfig{legate::LocalTaskID{tasks::CSR_ROW_RANGES_TASK}};
+
+  static void cpu_variant(legate::TaskContext context);
+};
+
+// y = A x, one row block per point task.
+class CSRSpMVTask : public legate::LegateTask<CSRSpMVTask> {
+ public:
+  static inline const auto TASK_CONFIG =
+      legate::TaskConfig{legate::LocalTaskID{tasks::CSR_SPMV_TASK}};
+
+  static void cpu_variant(legate::TaskContext context);
+#if LEGATE_DEFINED(LEGATE_USE_OPENMP)
+  static void omp_variant(legate::TaskContext context);
+#endif
+};
+
+// Y = A X for a dense (cols, k) X, one row block of Y per point task.
+class CSRSpMMTask : public legate::LegateTask<CSRSpMMTask> {
+ public:
+  static inline const auto TASK_CONFIG =
+      legate::TaskConfig{legate::LocalTaskID{tasks::CSR_SPMM_TASK}};
+
+  static void cpu_variant(legate::TaskContext context);
+#if LEGATE_DEFINED(LEGATE_USE_OPENMP)
+  static void omp_variant(legate::TaskContext context);
+#endif
+};
+
+// Row ranges for `rowptr` (1-d int64, at least one entry); nullopt otherwise.
+std::optional<cupynumeric::NDArray> csr_row_ranges(
+    const cupynumeric::NDArray& rowptr);
+
+// y = A x and Y = A X for A given as (row_ranges, colind, values). `x` has
+// `values`' type and the matrix's column count as its leading extent; `y` is
+// (rows) or (rows, k). Returns false on mismatched shapes or types.
+bool csr_spmv(const cupynumeric::NDArray& row_ranges,
+              const cupynumeric::NDArray& colind,
+              const cupynumeric::NDArray& values,
+              const cupynumeric::NDArray& x, cupynumeric::NDArray& y);
+bool csr_spmm(const cupynumeric::NDArray& row_ranges,
+              const cupynumeric::NDArray& colind,
+              const cupynumeric::NDArray& values,
+              const cupynumeric::NDArray& x, cupynumeric::NDArray& y);
+
+}  // namespace tasks
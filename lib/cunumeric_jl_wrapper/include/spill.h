@@ -0,0 +1,68 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahhal <naderrahhal2026@u.northwestern.edu>
+ */
+
+#pragma once
+
+#include <cupynumeric/ndarray.h>
+
+#include <cstdint>
+#include <string>
+
+#include "legate.h"
+
+namespace tasks {
+
+struct SpillStats {
+  uint64_t spills;
+  uint64_t fills;
+  uint64_t spilled_bytes;   // total written to scratch files
+  uint64_t filled_bytes;    // total read back
+  uint64_t resident_bytes;  // currently held in scratch files
+  uint64_t tracked;
+};
+
+// Spill manager. Tracked arrays remember when they were last used; under
+// memory pressure the least recently used ones are copied into unlinked,
+// memory-mapped files under the scratch directory and their handles are
+// rebound to stores attached to those mappings, which releases the Legate
+// instances. Spilled arrays stay valid and are copied back into fresh
+// instances the next time their handle is used. Arrays that share storage
+// with other handles (views, or arrays whose store or pointer was handed
+// out) must be pinned, since rebinding one handle would split them.
+// Single-process runs only; `set_spilling` returns false otherwise.
+bool set_spilling(bool enabled, const std::string& dir);
+bool spilling();
+
+// `arr` is the array owned by the handle `key` and must outlive its entry.
+void track_spill(const void* key, cupynumeric::NDArray* arr);
+void pin_spill(const void* key);
+// Called when the handle `key` is destroyed.
+void forget_spill(const void* key);
+// Records a use of `key`, filling its array back first if it was spilled.
+void touch_spill(const void* key);
+// After `nda_move`: `dst` took over the storage of `src`.
+void move_spill(const void* dst_key, const void* src_key);
+
+// Spills cold arrays, oldest use first, until at least `bytes` left
+// Legate memory or no candidate remains. Returns the bytes spilled.
+uint64_t spill_cold(uint64_t bytes);
+SpillStats spill_stats();
+
+}  // namespace tasks
@@ -0,0 +1,91 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahhal <naderrahhal2026@u.northwestern.edu>
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "legate.h"
+
+namespace ufi {
+
+// Strided — matches Julia cuNumeric.CuStridedDeviceArray. Packed for every
+// array argument of RunPTXTask and RunPTXBroadcastTask.
+template <size_t D>
+struct CuStridedDeviceArray {
+  void *ptr;
+  uint64_t maxsize;
+  std::array<uint64_t, D> dims;
+  std::array<uint64_t, D>
+      strides;  // element strides (byte strides / sizeof(T))
+  uint64_t length;
+};
+
+// Descriptor of the local tile of `store`: origin pointer, extents and
+// element strides. Promoted (broadcast) dimensions have stride 0 and slices
+// keep their parent's strides, so no argument needs to be dense.
+template <typename T, int D>
+CuStridedDeviceArray<D> strided_descriptor(const legate::PhysicalStore &store,
+                                           bool write) {
+  const auto shp = store.shape<D>();
+  const auto extents = shp.hi - shp.lo + legate::Point<D>::ONES();
+  CuStridedDeviceArray<D> desc;
+  auto pack = [&](const auto &acc) {
+    desc.ptr = const_cast<void *>(static_cast<const void *>(acc.ptr(shp.lo)));
+    for (int i = 0; i < D; ++i) {
+      desc.dims[i] = extents[i];
+      /* Legion AffineAccessor::strides are in bytes */
+      desc.strides[i] = acc.accessor.strides[i] / sizeof(T);
+    }
+  };
+  if (write)
+    pack(store.write_accessor<T, D>(shp));
+  else
+    pack(store.read_accessor<T, D>(shp));
+  desc.maxsize = shp.volume() * sizeof(T);
+  desc.length = shp.volume();
+  return desc;
+}
+
+struct StridedDescriptorFn {
+  template <legate::Type::Code CODE, int DIM>
+  void operator()(const legate::PhysicalStore &store, void **ptr,
+                  uint64_t *dims, uint64_t *strides) {
+    const auto desc =
+        strided_descriptor<legate::type_of_t<CODE>, DIM>(store, false);
+    *ptr = desc.ptr;
+    for (int i = 0; i < DIM; ++i) {
+      dims[i] = desc.dims[i];
+      strides[i] = desc.strides[i];
+    }
+  }
+};
+
+// Host-side view of the descriptor a task would receive for `store`, so the
+// packing can be checked without a GPU.
+inline void describe_strided(const legate::PhysicalStore &store, void **ptr,
+                             uint64_t *dims, uint64_t *strides) {
+  legate::double_dispatch(store.dim(), store.type().code(),
+                          StridedDescriptorFn{}, store, ptr, dims, strides);
+}
+
+}  // namespace ufi
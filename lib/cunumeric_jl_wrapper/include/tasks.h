@@ -0,0 +1,58 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahhal <naderrahhal2026@u.northwestern.edu>
+ */
+
+#pragma once
+
+#include "legate.h"
+
+// Host (CPU/OpenMP) tasks the C API launches itself. They live in the
+// cupynumeric library next to the CUDA tasks in ufi.h, so the ids must not
+// collide with ufi::TaskIDs.
+namespace tasks {
+enum TaskIDs {
+  MULTI_REDUCTION_TASK = 143440,
+  MULTI_REDUCTION_MERGE_TASK = 143441,
+  GEMM_TASK = 143442,
+  CSR_ROW_RANGES_TASK = 143443,
+  CSR_SPMV_TASK = 143444,
+  CSR_SPMM_TASK = 143445,
+  TOPK_TASK = 143446,
+  TOPK_MERGE_TASK = 143447,
+  SCAN_TASK = 143448,
+  SCAN_CARRY_TASK = 143449,
+  INDEX_POINTS_TASK = 143450,
+  TAKE_TASK = 143451,
+  COMPRESS_TASK = 143452,
+  MASK_FILL_TASK = 143453,
+  FUSED_EXPR_TASK = 143455,
+  CHECKPOINT_TASK = 143456,
+  RESTORE_TASK = 143457,
+  FOOTPRINT_TASK = 143458,
+  POTRF_TASK = 143459,
+  GETRF_TASK = 143460,
+  TRSM_TASK = 143461,
+  KRYLOV_TASK = 143462,
+  FFT_TASK = 143463,
+  CONVOLVE_TASK = 143464,
+};
+
+// Registers every host task variant with `library`.
+void register_tasks(legate::Library library);
+}  // namespace tasks
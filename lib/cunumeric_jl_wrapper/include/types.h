@@ -44,6 +44,10 @@ DEFINE_CODE_TO_CXX(UINT32, uint32_t)
 DEFINE_CODE_TO_CXX(UINT64, uint64_t)
 #if LEGATE_DEFINED(LEGATE_USE_CUDA)
 DEFINE_CODE_TO_CXX(FLOAT16, __half)
+#elif defined(__FLT16_MAX__)
+// GCC 12+ and Clang provide _Float16 on x86-64 and AArch64 hosts; with F16C
+// (or ARMv8.2 FP16) its conversions compile to single instructions.
+DEFINE_CODE_TO_CXX(FLOAT16, _Float16)
 #else
 struct __dummy {};
 DEFINE_CODE_TO_CXX(FLOAT16, __dummy)
@@ -0,0 +1,656 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahhal <naderrahhal2026@u.northwestern.edu>
+ */
+
+#include "checkpoint.h"
+
+#include <cupynumeric.h>
+#include <cupynumeric/runtime.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <sstream>
+
+namespace tasks {
+namespace {
+
+namespace fs = std::filesystem;
+
+constexpr char MAGIC[4] = {'C', 'N', 'C', 'K'};
+constexpr uint32_t VERSION = 1;
+// Raw bytes per compressed chunk; chunks are coded independently.
+constexpr uint64_t CHUNK_BYTES = uint64_t{1} << 20;
+constexpr char MANIFEST[] = "manifest";
+
+struct ShardHeader {
+  char magic[4];
+  uint32_t version;
+  int32_t dim;
+  int32_t type_code;
+  uint64_t elem_size;
+  int64_t index;  // position of the tile in the launch
+  int64_t count;  // number of tiles in the launch
+  int64_t lo[LEGATE_MAX_DIM];
+  int64_t hi[LEGATE_MAX_DIM];
+  uint64_t num_chunks;
+};
+
+// One per chunk after the header. stored == raw means the chunk was kept
+// as is; otherwise it is byte-shuffled and LZ-coded.
+struct ChunkEntry {
+  uint64_t raw;
+  uint64_t stored;
+};
+
+template <typename F>
+void parallel_for(int64_t count, bool openmp, F&& f) {
+  if (openmp) {
+#pragma omp parallel for schedule(dynamic)
+    for (int64_t i = 0; i < count; ++i) f(i);
+  } else {
+    for (int64_t i = 0; i < count; ++i) f(i);
+  }
+}
+
+// ---------------------------------------------------------------------------
+// Codec: byte shuffle (all first bytes of the elements, then all second
+// bytes, ...) so that slowly varying values produce runs, followed by an LZ77
+// coder. The coded stream is a sequence of
+//   varint literal_count, literals, varint match_length, varint offset
+// ending after the last literal run.
+
+void shuffle(const uint8_t* in, uint8_t* out, uint64_t n, uint64_t size) {
+  for (uint64_t b = 0; b < size; ++b)
+    for (uint64_t k = 0; k < n; ++k) out[b * n + k] = in[k * size + b];
+}
+
+void unshuffle(const uint8_t* in, uint8_t* out, uint64_t n, uint64_t size) {
+  for (uint64_t b = 0; b < size; ++b)
+    for (uint64_t k = 0; k < n; ++k) out[k * size + b] = in[b * n + k];
+}
+
+void put_varint(std::vector<uint8_t>& out, uint64_t v) {
+  while (v >= 0x80) {
+    out.push_back(static_cast<uint8_t>(v | 0x80));
+    v >>= 7;
+  }
+  out.push_back(static_cast<uint8_t>(v));
+}
+
+bool get_varint(const uint8_t*& p, const uint8_t* end, uint64_t& v) {
+  v = 0;
+  for (int shift = 0; shift < 64 && p < end; shift += 7) {
+    const uint8_t byte = *p++;
+    v |= static_cast<uint64_t>(byte & 0x7f) << shift;
+    if (!(byte & 0x80)) return true;
+  }
+  return false;
+}
+
+std::vector<uint8_t> lz_compress(const uint8_t* in, uint64_t n) {
+  constexpr int HASH_BITS = 16;
+  constexpr uint64_t MIN_MATCH = 4;
+  std::vector<int64_t> table(std::size_t{1} << HASH_BITS, -1);
+  std::vector<uint8_t> out;
+  out.reserve(n / 2 + 16);
+  uint64_t anchor = 0, i = 0;
+  while (i + MIN_MATCH <= n) {
+    uint32_t seq;
+    std::memcpy(&seq, in + i, sizeof(seq));
+    const uint32_t h = (seq * 2654435761u) >> (32 - HASH_BITS);
+    const int64_t cand = table[h];
+    table[h] = static_cast<int64_t>(i);
+    if (cand < 0 || std::memcmp(in + cand, in + i, MIN_MATCH) != 0) {
+      ++i;
+      continue;
+    }
+    uint64_t len = MIN_MATCH;
+    while (i + len < n && in[cand + len] == in[i + len]) ++len;
+    put_varint(out, i - anchor);
+    out.insert(out.end(), in + anchor, in + i);
+    put_varint(out, len);
+    put_varint(out, i - static_cast<uint64_t>(cand));
+    i += len;
+    anchor = i;
+  }
+  put_varint(out, n - anchor);
+  out.insert(out.end(), in + anchor, in + n);
+  return out;
+}
+
+bool lz_decompress(const uint8_t* in, uint64_t n, uint8_t* out, uint64_t raw) {
+  const uint8_t* p = in;
+  const uint8_t* end = in + n;
+  uint64_t o = 0;
+  while (true) {
+    uint64_t lit;
+    if (!get_varint(p, end, lit)) return false;
+    if (lit > static_cast<uint64_t>(end - p) || lit > raw - o) return false;
+    std::memcpy(out + o, p, lit);
+    p += lit;
+    o += lit;
+    if (p == end) return o == raw;
+    uint64_t len, off;
+    if (!get_varint(p, end, len) || !get_varint(p, end, off)) return false;
+    if (off == 0 || off > o || len > raw - o) return false;
+    // Byte by byte: the match may overlap the bytes it produces.
+    for (uint64_t k = 0; k < len; ++k) out[o + k] = out[o + k - off];
+    o += len;
+  }
+}
+
+// ---------------------------------------------------------------------------
+// Shard files
+
+std::vector<uint8_t> string_bytes(const std::string& s) {
+  return std::vector<uint8_t>(s.begin(), s.end());
+}
+
+std::string scalar_string(const legate::Scalar& scalar) {
+  const auto bytes = scalar.values<uint8_t>();
+  return std::string(bytes.begin(), bytes.end());
+}
+
+// Position of this point task in its launch, and the launch size.
+std::pair<int64_t, int64_t> launch_position(legate::TaskContext& context) {
+  const auto domain = context.get_launch_domain();
+  const auto point = context.get_task_index();
+  if (domain.get_volume() == 0) return {0, 1};
+  int64_t index = 0;
+  for (int d = 0; d < domain.get_dim(); ++d) {
+    const int64_t extent = domain.hi()[d] - domain.lo()[d] + 1;
+    index = index * extent + (point[d] - domain.lo()[d]);
+  }
+  return {index, static_cast<int64_t>(domain.get_volume())};
+}
+
+template <int DIM>
+std::vector<legate::Point<DIM>> row_major_points(
+    const legate::Rect<DIM>& rect) {
+  std::vector<legate::Point<DIM>> points;
+  points.reserve(rect.volume());
+  for (legate::PointInRectIterator<DIM> it(rect, false); it.valid(); ++it)
+    points.push_back(*it);
+  return points;
+}
+
+// Returns the number of shards it failed to write (0 or 1).
+template <typename T, int DIM>
+int64_t checkpoint_tile(legate::TaskContext& context, bool openmp) {
+  auto input = context.input(0).data();
+  const auto rect = input.shape<DIM>();
+  const auto prefix = scalar_string(context.scalar(0));
+  const bool compress = context.scalar(1).value<bool>();
+  const auto [index, count] = launch_position(context);
+
+  // The tile in row-major order.
+  const uint64_t n = rect.empty() ? 0 : rect.volume();
+  std::vector<T> values(n);
+  if (n > 0) {
+    auto in = input.read_accessor<T, DIM>(rect);
+    if (in.accessor.is_dense_row_major(rect)) {
+      std::copy_n(in.ptr(rect.lo), n, values.data());
+    } else {
+      const auto points = row_major_points(rect);
+      parallel_for(static_cast<int64_t>(n), openmp,
+                   [&](int64_t i) { values[i] = in[points[i]]; });
+    }
+  }
+
+  const auto* bytes = reinterpret_cast<const uint8_t*>(values.data());
+  const uint64_t total = n * sizeof(T);
+  const uint64_t chunk = std::max<uint64_t>(
+      sizeof(T), CHUNK_BYTES / sizeof(T) * sizeof(T));
+  const uint64_t num_chunks = (total + chunk - 1) / chunk;
+  std::vector<ChunkEntry> entries(num_chunks);
+  std::vector<std::vector<uint8_t>> coded(num_chunks);
+  parallel_for(static_cast<int64_t>(num_chunks), openmp, [&](int64_t c) {
+    const uint64_t begin = c * chunk;
+    const uint64_t size = std::min(chunk, total - begin);
+    entries[c] = ChunkEntry{size, size};
+    if (!compress) return;
+    std::vector<uint8_t> shuffled(size);
+    shuffle(bytes + begin, shuffled.data(), size / sizeof(T), sizeof(T));
+    auto packed = lz_compress(shuffled.data(), size);
+    if (packed.size() >= size) return;
+    entries[c].stored = packed.size();
+    coded[c] = std::move(packed);
+  });
+
+  ShardHeader header{};
+  std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.version = VERSION;
+  header.dim = DIM;
+  header.type_code = static_cast<int32_t>(input.type().code());
+  header.elem_size = sizeof(T);
+  header.index = index;
+  header.count = count;
+  for (int d = 0; d < DIM; ++d) {
+    header.lo[d] = rect.lo[d];
+    header.hi[d] = rect.hi[d];
+  }
+  header.num_chunks = num_chunks;
+
+  // Written under a temporary name so that a shard file is either
+  // complete or absent.
+  const auto path = prefix + std::to_string(index) + ".shard";
+  const auto tmp = path + ".tmp";
+  {
+    std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(entries.data()),
+              num_chunks * sizeof(ChunkEntry));
+    for (uint64_t c = 0; c < num_chunks; ++c) {
+      if (entries[c].stored == entries[c].raw) {
+        out.write(reinterpret_cast<const char*>(bytes + c * chunk),
+                  entries[c].raw);
+      } else {
+        out.write(reinterpret_cast<const char*>(coded[c].data()),
+                  entries[c].stored);
+      }
+    }
+    out.close();
+    if (!out) {
+      std::error_code ec;
+      fs::remove(tmp, ec);
+      return 1;
+    }
+  }
+  std::error_code ec;
+  fs::rename(tmp, path, ec);
+  if (!ec) return 0;
+  fs::remove(tmp, ec);
+  return 1;
+}
+
+bool read_header(std::ifstream& in, ShardHeader& header) {
+  in.read(reinterpret_cast<char*>(&header), sizeof(header));
+  return in && std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) == 0 &&
+         header.version == VERSION && header.dim > 0 &&
+         header.dim <= LEGATE_MAX_DIM;
+}
+
+// Decodes the whole shard at `path` into `out` (row-major bytes).
+bool read_shard(const std::string& path, ShardHeader& header,
+                std::vector<uint8_t>& out) {
+  std::ifstream in(path, std::ios::binary);
+  if (!read_header(in, header)) return false;
+  std::vector<ChunkEntry> entries(header.num_chunks);
+  in.read(reinterpret_cast<char*>(entries.data()),
+          entries.size() * sizeof(ChunkEntry));
+  uint64_t total = 0;
+  for (const auto& e : entries) total += e.raw;
+  out.resize(total);
+  std::vector<uint8_t> packed, shuffled;
+  uint64_t offset = 0;
+  for (const auto& e : entries) {
+    if (e.stored == e.raw) {
+      in.read(reinterpret_cast<char*>(out.data() + offset), e.raw);
+    } else {
+      packed.resize(e.stored);
+      shuffled.resize(e.raw);
+      in.read(reinterpret_cast<char*>(packed.data()), e.stored);
+      if (!in || !lz_decompress(packed.data(), e.stored, shuffled.data(),
+                                e.raw))
+        return false;
+      unshuffle(shuffled.data(), out.data() + offset,
+                e.raw / header.elem_size, header.elem_size);
+    }
+    offset += e.raw;
+  }
+  return static_cast<bool>(in);
+}
+
+std::vector<std::string> split_lines(const std::string& s) {
+  std::vector<std::string> lines;
+  std::istringstream stream(s);
+  for (std::string line; std::getline(stream, line);)
+    if (!line.empty()) lines.push_back(line);
+  return lines;
+}
+
+// Returns the number of shards overlapping the tile that could not be read
+// or do not hold this array.
+template <typename T, int DIM>
+int64_t restore_tile(legate::TaskContext& context, bool openmp) {
+  auto output = context.output(0).data();
+  const auto rect = output.shape<DIM>();
+  if (rect.empty()) return 0;
+  auto out = output.write_accessor<T, DIM>(rect);
+  const auto paths = split_lines(scalar_string(context.scalar(0)));
+
+  // Shards cover disjoint parts of the array, so they can be copied in
+  // parallel.
+  std::atomic<int64_t> failures{0};
+  parallel_for(static_cast<int64_t>(paths.size()), openmp, [&](int64_t s) {
+    ShardHeader header;
+    {
+      std::ifstream in(paths[s], std::ios::binary);
+      if (!read_header(in, header) || header.dim != DIM ||
+          header.type_code != static_cast<int32_t>(output.type().code()) ||
+          header.elem_size != sizeof(T)) {
+        ++failures;
+        return;
+      }
+    }
+    legate::Rect<DIM> shard;
+    for (int d = 0; d < DIM; ++d) {
+      shard.lo[d] = header.lo[d];
+      shard.hi[d] = header.hi[d];
+    }
+    const auto overlap = rect.intersection(shard);
+    if (overlap.empty() || shard.empty()) return;
+    std::vector<uint8_t> bytes;
+    if (!read_shard(paths[s], header, bytes) ||
+        bytes.size() != shard.volume() * sizeof(T)) {
+      ++failures;
+      return;
+    }
+    int64_t pitch[DIM];
+    pitch[DIM - 1] = 1;
+    for (int d = DIM - 1; d > 0; --d)
+      pitch[d - 1] = pitch[d] * (shard.hi[d] - shard.lo[d] + 1);
+    for (legate::PointInRectIterator<DIM> it(overlap, false); it.valid();
+         ++it) {
+      int64_t offset = 0;
+      for (int d = 0; d < DIM; ++d)
+        offset += ((*it)[d] - shard.lo[d]) * pitch[d];
+      T value;
+      std::memcpy(&value, bytes.data() + offset * sizeof(T), sizeof(T));
+      out[*it] = value;
+    }
+  });
+  return failures.load();
+}
+
+struct CheckpointFn {
+  template <legate::Type::Code CODE, int DIM>
+  int64_t operator()(legate::TaskContext& context, bool openmp) {
+    return checkpoint_tile<legate::type_of_t<CODE>, DIM>(context, openmp);
+  }
+};
+
+struct RestoreFn {
+  template <legate::Type::Code CODE, int DIM>
+  int64_t operator()(legate::TaskContext& context, bool openmp) {
+    return restore_tile<legate::type_of_t<CODE>, DIM>(context, openmp);
+  }
+};
+
+// Runs `Fn` on the tile of `array` and adds the shards it failed on to the
+// launch's failure count, the task's only reduction.
+template <typename Fn>
+void run_tile(legate::TaskContext& context,
+              const legate::PhysicalStore& array, bool openmp) {
+  const int64_t failures = legate::double_dispatch(
+      array.dim(), array.type().code(), Fn{}, context, openmp);
+  auto acc = context.reduction(0)
+                 .data()
+                 .reduce_accessor<legate::SumReduction<int64_t>, true, 1>();
+  acc.reduce(0, failures);
+}
+
+// Failure count of the launches it is added to.
+legate::LogicalStore failure_count() {
+  return legate::Runtime::get_runtime()->create_store(
+      legate::Scalar{int64_t{0}});
+}
+
+int64_t failures(const legate::LogicalStore& count) {
+  return count.get_physical_store().scalar<int64_t>();
+}
+
+// ---------------------------------------------------------------------------
+// Manifest: one line per array,
+//   name generation type_code dim extent...
+// Shards of generation g of `name` are files `name.g<g>.<index>.shard`.
+
+struct ManifestEntry {
+  uint64_t generation;
+  int32_t type_code;
+  std::vector<uint64_t> shape;
+};
+
+using Manifest = std::map<std::string, ManifestEntry>;
+
+Manifest read_manifest(const fs::path& dir) {
+  Manifest manifest;
+  std::ifstream in(dir / MANIFEST);
+  for (std::string line; std::getline(in, line);) {
+    if (line.empty() || line[0] == '#') continue;
+    std::istringstream fields(line);
+    std::string name;
+    ManifestEntry entry;
+    int32_t dim = 0;
+    if (!(fields >> name >> entry.generation >> entry.type_code >> dim))
+      continue;
+    entry.shape.resize(dim);
+    for (auto& extent : entry.shape) fields >> extent;
+    if (fields) manifest[name] = std::move(entry);
+  }
+  return manifest;
+}
+
+bool write_manifest(const fs::path& dir, const Manifest& manifest) {
+  // Every rank writes the same contents; the rename makes each write atomic.
+  char host[256] = {0};
+  gethostname(host, sizeof(host) - 1);
+  const auto tmp = dir / (std::string(MANIFEST) + "." + host + "." +
+                          std::to_string(getpid()));
+  {
+    std::ofstream out(tmp, std::ios::trunc);
+    out << "# cuNumeric checkpoint manifest v" << VERSION << "\n";
+    for (const auto& [name, entry] : manifest) {
+      out << name << ' ' << entry.generation << ' ' << entry.type_code << ' '
+          << entry.shape.size();
+      for (auto extent : entry.shape) out << ' ' << extent;
+      out << '\n';
+    }
+    if (!out) return false;
+  }
+  std::error_code ec;
+  fs::rename(tmp, dir / MANIFEST, ec);
+  return !ec;
+}
+
+std::string shard_prefix(const std::string& name, uint64_t generation) {
+  return name + ".g" + std::to_string(generation) + ".";
+}
+
+std::vector<fs::path> shard_files(const fs::path& dir,
+                                  const std::string& name,
+                                  uint64_t generation) {
+  const auto prefix = shard_prefix(name, generation);
+  std::vector<fs::path> files;
+  std::error_code ec;
+  for (const auto& entry : fs::directory_iterator(dir, ec)) {
+    const auto file = entry.path().filename().string();
+    if (file.rfind(prefix, 0) == 0 && file.size() > 6 &&
+        file.compare(file.size() - 6, 6, ".shard") == 0)
+      files.push_back(entry.path());
+  }
+  std::sort(files.begin(), files.end());
+  return files;
+}
+
+// True when the shards of a generation form one complete launch covering
+// `volume` elements.
+bool shards_complete(const std::vector<fs::path>& files, uint64_t volume) {
+  if (files.empty()) return false;
+  std::vector<bool> seen;
+  uint64_t covered = 0;
+  for (const auto& file : files) {
+    std::ifstream in(file, std::ios::binary);
+    ShardHeader header;
+    if (!read_header(in, header)) return false;
+    if (seen.empty()) seen.assign(header.count, false);
+    if (header.count != static_cast<int64_t>(seen.size()) ||
+        header.index < 0 || header.index >= header.count ||
+        seen[header.index])
+      return false;
+    seen[header.index] = true;
+    uint64_t v = 1;
+    for (int d = 0; d < header.dim; ++d)
+      v *= header.hi[d] < header.lo[d] ? 0 : header.hi[d] - header.lo[d] + 1;
+    covered += v;
+  }
+  return covered == volume &&
+         std::all_of(seen.begin(), seen.end(), [](bool b) { return b; });
+}
+
+bool valid_name(const std::string& name) {
+  return !name.empty() &&
+         std::all_of(name.begin(), name.end(), [](char c) {
+           return std::isalnum(static_cast<unsigned char>(c)) || c == '_' ||
+                  c == '-';
+         });
+}
+
+}  // namespace
+
+void CheckpointTask::cpu_variant(legate::TaskContext context) {
+  run_tile<CheckpointFn>(context, context.input(0).data(), false);
+}
+
+void RestoreTask::cpu_variant(legate::TaskContext context) {
+  run_tile<RestoreFn>(context, context.output(0).data(), false);
+}
+
+#if LEGATE_DEFINED(LEGATE_USE_OPENMP)
+void CheckpointTask::omp_variant(legate::TaskContext context) {
+  run_tile<CheckpointFn>(context, context.input(0).data(), true);
+}
+
+void RestoreTask::omp_variant(legate::TaskContext context) {
+  run_tile<RestoreFn>(context, context.output(0).data(), true);
+}
+#endif
+
+bool checkpoint(const std::vector<cupynumeric::NDArray>& arrs,
+                const std::vector<std::string>& names, const std::string& dir,
+                bool compress) {
+  if (arrs.size() != names.size()) return false;
+  for (std::size_t i = 0; i < arrs.size(); ++i) {
+    if (!valid_name(names[i]) || arrs[i].dim() == 0 ||
+        !arrs[i].type().is_primitive())
+      return false;
+    for (std::size_t j = 0; j < i; ++j)
+      if (names[j] == names[i]) return false;
+  }
+  const fs::path root(dir);
+  std::error_code ec;
+  fs::create_directories(root, ec);
+  if (ec) return false;
+
+  auto manifest = read_manifest(root);
+  auto cn_runtime = cupynumeric::CuPyNumericRuntime::get_runtime();
+  auto runtime = legate::Runtime::get_runtime();
+  std::vector<uint64_t> generations(arrs.size());
+  std::vector<legate::LogicalStore> counts;
+  for (std::size_t i = 0; i < arrs.size(); ++i) {
+    auto it = manifest.find(names[i]);
+    generations[i] = it == manifest.end() ? 1 : it->second.generation + 1;
+    // Leftovers of an attempt that never made it into the manifest.
+    for (const auto& file : shard_files(root, names[i], generations[i]))
+      fs::remove(file, ec);
+    const auto prefix =
+        (root / shard_prefix(names[i], generations[i])).string();
+    auto task = runtime->create_task(cn_runtime->get_library(),
+                                     legate::LocalTaskID{CHECKPOINT_TASK});
+    task.add_input(arrs[i].get_store());
+    counts.push_back(failure_count());
+    task.add_reduction(counts.back(), legate::ReductionOpKind::ADD);
+    // Each point task appends "<index>.shard".
+    task.add_scalar_arg(legate::Scalar{string_bytes(prefix)});
+    task.add_scalar_arg(legate::Scalar{compress});
+    runtime->submit(std::move(task));
+  }
+  runtime->issue_execution_fence(/*block=*/true);
+
+  bool ok = true;
+  for (std::size_t i = 0; i < arrs.size(); ++i) {
+    const auto files = shard_files(root, names[i], generations[i]);
+    if (failures(counts[i]) != 0 || !shards_complete(files, arrs[i].size())) {
+      // The previous generation stays in the manifest.
+      for (const auto& file : files) fs::remove(file, ec);
+      ok = false;
+      continue;
+    }
+    auto& entry = manifest[names[i]];
+    const auto previous = entry.generation;
+    const auto& shape = arrs[i].shape();
+    entry = ManifestEntry{generations[i],
+                          static_cast<int32_t>(arrs[i].type().code()),
+                          std::vector<uint64_t>(shape.begin(), shape.end())};
+    if (previous > 0)
+      for (const auto& file : shard_files(root, names[i], previous))
+        fs::remove(file, ec);
+  }
+  return write_manifest(root, manifest) && ok;
+}
+
+RestoreStatus restore(const std::vector<std::string>& names,
+                      const std::string& dir,
+                      std::vector<cupynumeric::NDArray>& arrs) {
+  const fs::path root(dir);
+  const auto manifest = read_manifest(root);
+  auto cn_runtime = cupynumeric::CuPyNumericRuntime::get_runtime();
+  auto runtime = legate::Runtime::get_runtime();
+  std::vector<legate::LogicalStore> counts;
+  arrs.clear();
+  for (const auto& name : names) {
+    auto it = manifest.find(name);
+    if (it == manifest.end()) return RestoreStatus::MISSING;
+    const auto& entry = it->second;
+    const auto files = shard_files(root, name, entry.generation);
+    if (files.empty()) return RestoreStatus::MISSING;
+    uint64_t volume = 1;
+    for (auto extent : entry.shape) volume *= extent;
+    if (!shards_complete(files, volume)) return RestoreStatus::CORRUPT;
+    std::string paths;
+    for (const auto& file : files) paths += file.string() + "\n";
+
+    auto type = legate::primitive_type(
+        static_cast<legate::Type::Code>(entry.type_code));
+    auto out = cn_runtime->create_array(entry.shape, type);
+    if (out.size() > 0) {
+      auto task = runtime->create_task(cn_runtime->get_library(),
+                                       legate::LocalTaskID{RESTORE_TASK});
+      task.add_output(out.get_store());
+      counts.push_back(failure_count());
+      task.add_reduction(counts.back(), legate::ReductionOpKind::ADD);
+      task.add_scalar_arg(legate::Scalar{string_bytes(paths)});
+      runtime->submit(std::move(task));
+    }
+    arrs.push_back(std::move(out));
+  }
+  // Waits for the reads.
+  for (const auto& count : counts)
+    if (failures(count) != 0) return RestoreStatus::CORRUPT;
+  return RestoreStatus::OK;
+}
+
+}  // namespace tasks
@@ -0,0 +1,377 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahhal <naderrahhal2026@u.northwestern.edu>
+ */
+
+#include "convolve.h"
+
+#include <cupynumeric.h>
+#include <cupynumeric/runtime.h>
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "fft.h"
+#include "pad.h"
+
+namespace tasks {
+namespace {
+
+template <typename F>
+void parallel_for(int64_t count, bool openmp, F&& f) {
+  if (openmp) {
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < count; ++i) f(i);
+  } else {
+    for (int64_t i = 0; i < count; ++i) f(i);
+  }
+}
+
+template <typename T>
+struct ConvolveFn {
+  template <int DIM>
+  void operator()(legate::TaskContext& context, bool openmp) const {
+    auto output = context.output(0).data();
+    const auto rect = output.shape<DIM>();
+    if (rect.empty()) return;
+    auto input = context.input(0).data();
+    auto weights = context.input(1).data();
+    const auto src = input.shape<DIM>();
+    const auto wrect = weights.shape<DIM>();
+    auto in = input.read_accessor<T, DIM>(src);
+    auto w = weights.read_accessor<T, DIM>(wrect);
+    auto out = output.write_accessor<T, DIM>(rect);
+    const auto mode = context.scalar(0).value<int32_t>();
+    const bool flip = context.scalar(1).value<bool>();
+    const T value = context.scalar(2).value<T>();
+    const auto extent = context.scalar(3).values<int64_t>();
+
+    int64_t width[DIM], center[DIM], stride[DIM];
+    for (int d = 0; d < DIM; ++d) {
+      width[d] = wrect.hi[d] - wrect.lo[d] + 1;
+      center[d] = width[d] / 2;
+      stride[d] = static_cast<int64_t>(in.accessor.strides[d] / sizeof(T));
+    }
+
+    // One entry per tap: its weight, its offset from the output point, and
+    // that offset as an element step through the input tile.
+    std::vector<T> tap_weight;
+    std::vector<legate::Point<DIM>> tap_offset;
+    std::vector<int64_t> tap_step;
+    tap_weight.reserve(wrect.volume());
+    for (legate::PointInRectIterator<DIM> it(wrect, false); it.valid(); ++it) {
+      legate::Point<DIM> offset, source = *it;
+      int64_t step = 0;
+      for (int d = 0; d < DIM; ++d) {
+        const int64_t j = (*it)[d] - wrect.lo[d];
+        if (flip) source[d] = wrect.lo[d] + width[d] - 1 - j;
+        offset[d] = j - center[d];
+        step += offset[d] * stride[d];
+      }
+      tap_weight.push_back(w[source]);
+      tap_offset.push_back(offset);
+      tap_step.push_back(step);
+    }
+    const auto num_taps = static_cast<int64_t>(tap_weight.size());
+
+    // Window for an output point that crosses the array's border: every
+    // tap maps its coordinates through the boundary mode.
+    auto border = [&](const legate::Point<DIM>& p) {
+      T acc{0};
+      for (int64_t t = 0; t < num_taps; ++t) {
+        legate::Point<DIM> q;
+        bool fill = false;
+        for (int d = 0; d < DIM; ++d) {
+          int64_t i = p[d] + tap_offset[t][d];
+          if (i < 0 || i >= extent[d]) {
+            if (mode == PAD_EDGE)
+              i = i < 0 ? 0 : extent[d] - 1;
+            else
+              fill = true;
+          }
+          q[d] = i;
+        }
+        acc += tap_weight[t] * (fill ? value : in[q]);
+      }
+      return acc;
+    };
+
+    // One row per point of the tile with the last dimension collapsed.
+    // Columns [a, b) of a row that is interior in the other dimensions have
+    // their whole window inside the array and take the strided fast path.
+    constexpr int LAST = DIM - 1;
+    legate::Rect<DIM> starts = rect;
+    starts.hi[LAST] = rect.lo[LAST];
+    std::vector<legate::Point<DIM>> rows;
+    rows.reserve(starts.volume());
+    for (legate::PointInRectIterator<DIM> it(starts, false); it.valid(); ++it)
+      rows.push_back(*it);
+
+    const int64_t lo = rect.lo[LAST];
+    const int64_t end = rect.hi[LAST] + 1;
+    const int64_t a = std::max(lo, center[LAST]);
+    const int64_t b =
+        std::min(end, extent[LAST] - (width[LAST] - 1 - center[LAST]));
+
+    parallel_for(static_cast<int64_t>(rows.size()), openmp, [&](int64_t r) {
+      auto p = rows[r];
+      bool interior = true;
+      for (int d = 0; d < LAST; ++d)
+        interior = interior && p[d] >= center[d] &&
+                   p[d] + width[d] - 1 - center[d] < extent[d];
+      for (int64_t x = lo; x < end; ++x) {
+        p[LAST] = x;
+        if (interior && x >= a && x < b) {
+          const T* base = in.ptr(p);
+          T acc{0};
+          for (int64_t t = 0; t < num_taps; ++t)
+            acc += tap_weight[t] * base[tap_step[t]];
+          out[p] = acc;
+        } else {
+          out[p] = border(p);
+        }
+      }
+    });
+  }
+};
+
+void convolve_variant(legate::TaskContext& context, bool openmp) {
+  const auto& output = context.output(0);
+  switch (output.type().code()) {
+    case legate::Type::Code::FLOAT32:
+      legate::dim_dispatch(output.dim(), ConvolveFn<float>{}, context, openmp);
+      break;
+    case legate::Type::Code::FLOAT64:
+      legate::dim_dispatch(output.dim(), ConvolveFn<double>{}, context,
+                           openmp);
+      break;
+    case legate::Type::Code::COMPLEX64:
+      legate::dim_dispatch(output.dim(), ConvolveFn<std::complex<float>>{},
+                           context, openmp);
+      break;
+    case legate::Type::Code::COMPLEX128:
+      legate::dim_dispatch(output.dim(), ConvolveFn<std::complex<double>>{},
+                           context, openmp);
+      break;
+    default:
+      throw std::invalid_argument("convolve: unsupported type");
+  }
+}
+
+bool is_real(legate::Type::Code code) {
+  return code == legate::Type::Code::FLOAT32 ||
+         code == legate::Type::Code::FLOAT64;
+}
+
+bool is_complex(legate::Type::Code code) {
+  return code == legate::Type::Code::COMPLEX64 ||
+         code == legate::Type::Code::COMPLEX128;
+}
+
+legate::Scalar zero_of(legate::Type::Code code) {
+  switch (code) {
+    case legate::Type::Code::FLOAT32:
+      return legate::Scalar{0.0f};
+    case legate::Type::Code::FLOAT64:
+      return legate::Scalar{0.0};
+    case legate::Type::Code::COMPLEX64:
+      return legate::Scalar{std::complex<float>{}};
+    default:
+      return legate::Scalar{std::complex<double>{}};
+  }
+}
+
+// The direct pass costs one multiply-add per tap and element; the FFT path
+// about three transforms of the padded volume, each O(log2 volume) per
+// element in two or more passes over the data. Prefer it only for kernels
+// well past that break-even point.
+bool prefer_fft(uint64_t taps, uint64_t padded_volume) {
+  return static_cast<double>(taps) >
+         8.0 * std::log2(static_cast<double>(padded_volume));
+}
+
+// Copies the block of `full` starting at `start` with the extents `shape`
+// into a new array.
+cupynumeric::NDArray crop(const cupynumeric::NDArray& full,
+                          const std::vector<uint64_t>& start,
+                          const std::vector<uint64_t>& shape) {
+  auto store = full.get_store();
+  for (std::size_t d = 0; d < shape.size(); ++d) {
+    const auto s = static_cast<int64_t>(start[d]);
+    store = store.slice(static_cast<int32_t>(d),
+                        legate::Slice{s, s + static_cast<int64_t>(shape[d])});
+  }
+  auto out = cupynumeric::CuPyNumericRuntime::get_runtime()->create_array(
+      shape, full.type());
+  legate::Runtime::get_runtime()->issue_copy(out.get_store(), store);
+  return out;
+}
+
+void launch_direct(const cupynumeric::NDArray& arr,
+                   const cupynumeric::NDArray& w,
+                   const cupynumeric::NDArray& out, int32_t mode, bool flip,
+                   const legate::Scalar& value) {
+  const int32_t dim = arr.dim();
+  const auto& shape = arr.shape();
+  const auto& reach = w.shape();
+  std::vector<uint64_t> low(dim), high(dim);
+  std::vector<int64_t> extent(dim);
+  for (int32_t d = 0; d < dim; ++d) {
+    low[d] = reach[d] / 2;
+    high[d] = reach[d] - 1 - low[d];
+    extent[d] = static_cast<int64_t>(shape[d]);
+  }
+
+  auto runtime = legate::Runtime::get_runtime();
+  auto task = runtime->create_task(
+      cupynumeric::CuPyNumericRuntime::get_runtime()->get_library(),
+      legate::LocalTaskID{CONVOLVE_TASK});
+  auto out_var = task.add_output(out.get_store());
+  auto in_var = task.add_input(arr.get_store());
+  auto w_var = task.add_input(w.get_store());
+  // Each input tile is the output tile grown by the kernel's reach, so the
+  // runtime exchanges only the halo between neighbouring tiles.
+  task.add_constraint(legate::bloat(out_var, in_var,
+                                    legate::tuple<uint64_t>{std::move(low)},
+                                    legate::tuple<uint64_t>{std::move(high)}));
+  task.add_constraint(legate::broadcast(w_var));
+  task.add_scalar_arg(legate::Scalar{mode});
+  task.add_scalar_arg(legate::Scalar{flip});
+  task.add_scalar_arg(value);
+  task.add_scalar_arg(legate::Scalar{extent});
+  runtime->submit(std::move(task));
+}
+
+// Convolution as a product of spectra. `arr` is padded by the boundary mode
+// so every window lies inside it, and the kernel (reversed to correlate) is
+// zero-padded to the same shape. The circular convolution then holds the
+// result, free of wraparound, from index k - 1 on.
+std::optional<cupynumeric::NDArray> convolve_fft(
+    const cupynumeric::NDArray& arr, const cupynumeric::NDArray& w,
+    int32_t mode, bool flip, const legate::Scalar& value) {
+  const int32_t dim = arr.dim();
+  const auto code = arr.type().code();
+  const auto& shape = arr.shape();
+  const auto& reach = w.shape();
+  std::vector<uint64_t> widths(2 * dim), kernel_widths(2 * dim);
+  std::vector<uint64_t> start(dim), out_shape(shape.begin(), shape.end());
+  for (int32_t d = 0; d < dim; ++d) {
+    widths[2 * d] = reach[d] / 2;
+    widths[2 * d + 1] = reach[d] - 1 - reach[d] / 2;
+    kernel_widths[2 * d] = 0;
+    kernel_widths[2 * d + 1] = shape[d] - 1;
+    start[d] = reach[d] - 1;
+  }
+  std::vector<int32_t> axes(dim);
+  for (int32_t d = 0; d < dim; ++d) axes[d] = d;
+  auto padded = pad(arr, widths, mode, value);
+  if (!padded) return std::nullopt;
+  auto kernel = pad(flip ? w : cupynumeric::flip(w, axes), kernel_widths,
+                    PAD_CONSTANT, zero_of(code));
+  if (!kernel) return std::nullopt;
+
+  const auto& full_shape = padded->shape();
+  const bool real = is_real(code);
+  std::vector<uint64_t> spectrum_shape(full_shape.begin(), full_shape.end());
+  if (real) spectrum_shape[0] = full_shape[0] / 2 + 1;
+  const bool single = code == legate::Type::Code::FLOAT32 ||
+                      code == legate::Type::Code::COMPLEX64;
+  const auto complex_type =
+      legate::primitive_type(single ? legate::Type::Code::COMPLEX64
+                                    : legate::Type::Code::COMPLEX128);
+
+  auto cn_runtime = cupynumeric::CuPyNumericRuntime::get_runtime();
+  auto spectrum = cn_runtime->create_array(spectrum_shape, complex_type);
+  auto kernel_spectrum = cn_runtime->create_array(spectrum_shape, complex_type);
+  const int32_t forward = real ? FFT_R2C : FFT_C2C;
+  if (!fft(padded.value(), spectrum, forward, axes, false) ||
+      !fft(kernel.value(), kernel_spectrum, forward, axes, false))
+    return std::nullopt;
+  cupynumeric::multiply(spectrum, kernel_spectrum, spectrum);
+
+  auto full = cn_runtime->create_array(
+      std::vector<uint64_t>(full_shape.begin(), full_shape.end()), arr.type());
+  if (!fft(spectrum, full, real ? FFT_C2R : FFT_C2C, axes, true))
+    return std::nullopt;
+  return crop(full, start, out_shape);
+}
+
+}  // namespace
+
+/*static*/ void ConvolveTask::cpu_variant(legate::TaskContext context) {
+  convolve_variant(context, false);
+}
+
+#if LEGATE_DEFINED(LEGATE_USE_OPENMP)
+/*static*/ void ConvolveTask::omp_variant(legate::TaskContext context) {
+  convolve_variant(context, true);
+}
+#endif
+
+std::optional<cupynumeric::NDArray> convolve(const cupynumeric::NDArray& arr,
+                                             const cupynumeric::NDArray& w,
+                                             int32_t mode, bool flip,
+                                             int32_t method,
+                                             const legate::Scalar& value) {
+  const int32_t dim = arr.dim();
+  const auto code = arr.type().code();
+  if (mode < PAD_CONSTANT || mode > PAD_WRAP) return std::nullopt;
+  if (method < CONVOLVE_AUTO || method > CONVOLVE_FFT) return std::nullopt;
+  if (dim == 0 || w.dim() != dim || w.type() != arr.type()) return std::nullopt;
+  if (!is_real(code) && !is_complex(code)) return std::nullopt;
+  if (value.type() != arr.type() || w.size() == 0) return std::nullopt;
+
+  const auto& shape = arr.shape();
+  const std::vector<uint64_t> out_shape(shape.begin(), shape.end());
+  auto cn_runtime = cupynumeric::CuPyNumericRuntime::get_runtime();
+  if (arr.size() == 0) return cn_runtime->create_array(out_shape, arr.type());
+
+  const auto& reach = w.shape();
+  uint64_t padded_volume = 1;
+  for (int32_t d = 0; d < dim; ++d) padded_volume *= shape[d] + reach[d] - 1;
+  if (method == CONVOLVE_FFT ||
+      (method == CONVOLVE_AUTO && prefer_fft(w.size(), padded_volume)))
+    return convolve_fft(arr, w, mode, flip, value);
+
+  if (mode != PAD_WRAP) {
+    auto out = cn_runtime->create_array(out_shape, arr.type());
+    launch_direct(arr, w, out, mode, flip, value);
+    return out;
+  }
+  // A periodic halo comes from the far side of the array, which a bloated
+  // tile does not hold: pad first (copying only the far-side slices), then
+  // every window is interior.
+  std::vector<uint64_t> widths(2 * dim), start(dim);
+  for (int32_t d = 0; d < dim; ++d) {
+    widths[2 * d] = start[d] = reach[d] / 2;
+    widths[2 * d + 1] = reach[d] - 1 - reach[d] / 2;
+  }
+  auto padded = pad(arr, widths, PAD_WRAP, value);
+  if (!padded) return std::nullopt;
+  const auto& full_shape = padded->shape();
+  auto full = cn_runtime->create_array(
+      std::vector<uint64_t>(full_shape.begin(), full_shape.end()), arr.type());
+  launch_direct(padded.value(), w, full, PAD_CONSTANT, flip, value);
+  return crop(full, start, out_shape);
+}
+
+}  // namespace tasks
@@ -27,6 +27,7 @@
 #include "legate.h"
 #include "legate/utilities/proc_local_storage.h"
 #include "legion.h"
+#include "strided_descriptor.h"
 #include "types.h"
 #include "ufi.h"
 
@@ -126,118 +127,31 @@ enum class AccessMode {
   WRITE,
 };
 
-// Dense — MUST match CUDA.jl CuDeviceArray bit layout (RunPTXTask /
-// @cuda_task).
-template <size_t D>
-struct CuDeviceArray {
-  void *ptr;                     // Pointer to device memory
-  uint64_t maxsize;              // Total allocated size in bytes
-  std::array<uint64_t, D> dims;  // Fixed-size array of dimension sizes
-  uint64_t length;               // Number of elements (at the end)
-};
-
-// Strided — matches Julia cuNumeric.CuStridedDeviceArray (RunPTXBroadcastTask
-// only).
-template <size_t D>
-struct CuStridedDeviceArray {
-  void *ptr;
-  uint64_t maxsize;
-  std::array<uint64_t, D> dims;
-  std::array<uint64_t, D>
-      strides;  // element strides (byte strides / sizeof(T))
-  uint64_t length;
-};
-
-#define CUDA_DEVICE_ARRAY_ARG(MODE, ACCESSOR_CALL)                             \
-  template <                                                                   \
-      typename T, int D,                                                       \
-      typename std::enable_if<(D >= 1 && D <= REALM_MAX_DIM), int>::type = 0>  \
-  void cuda_device_array_arg_##MODE(char *&p,                                  \
-                                    const legate::PhysicalArray &rf) {         \
-    auto shp = rf.shape<D>();                                                  \
-    auto acc = rf.data().ACCESSOR_CALL<T, D>();                                \
-    CUDA_DEBUG_PRINT(std::cerr << "[RunPTXTask] " #MODE " accessor shape: "    \
-                               << shp.lo << " - " << shp.hi << ", dim: " << D  \
-                               << std::endl;                                   \
-                     std::cerr << "[RunPTXTask] " #MODE " accessor strides: "  \
-                               << acc.accessor.strides << std::endl;);         \
-    void *dev_ptr = const_cast<void *>(/*.lo to ensure multiple GPU support*/  \
-                                       static_cast<const void *>(              \
-                                           acc.ptr(Realm::Point<D>(shp.lo)))); \
-    auto extents = shp.hi - shp.lo + legate::Point<D>::ONES();                 \
-    CuDeviceArray<D> desc;                                                     \
-    desc.ptr = dev_ptr;                                                        \
-    desc.maxsize = shp.volume() * sizeof(T);                                   \
-    for (size_t i = 0; i < D; ++i) {                                           \
-      desc.dims[i] = extents[i];                                               \
-    }                                                                          \
-    desc.length = shp.volume();                                                \
-    memcpy(p, &desc, sizeof(CuDeviceArray<D>));                                \
-    p += sizeof(CuDeviceArray<D>);                                             \
-  }
-
-#define CUDA_STRIDED_DEVICE_ARRAY_ARG(MODE, ACCESSOR_CALL)                     \
-  template <                                                                   \
-      typename T, int D,                                                       \
-      typename std::enable_if<(D >= 1 && D <= REALM_MAX_DIM), int>::type = 0>  \
-  void cuda_strided_device_array_arg_##MODE(char *&p,                          \
-                                            const legate::PhysicalArray &rf) { \
-    auto shp = rf.shape<D>();                                                  \
-    auto acc = rf.data().ACCESSOR_CALL<T, D>();                                \
-    CUDA_DEBUG_PRINT(                                                          \
-        std::cerr << "[RunPTXBroadcastTask] " #MODE " accessor shape: "        \
-                  << shp.lo << " - " << shp.hi << ", dim: " << D << std::endl; \
-        std::cerr << "[RunPTXBroadcastTask] " #MODE                            \
-                  << " accessor byte strides: " << acc.accessor.strides        \
-                  << std::endl;);                                              \
-    void *dev_ptr = const_cast<void *>(                                        \
-        static_cast<const void *>(acc.ptr(Realm::Point<D>(shp.lo))));          \
-    auto extents = shp.hi - shp.lo + legate::Point<D>::ONES();                 \
-    CuStridedDeviceArray<D> desc;                                              \
-    desc.ptr = dev_ptr;                                                        \
-    desc.maxsize = shp.volume() * sizeof(T);                                   \
-    for (size_t i = 0; i < D; ++i) {                                           \
-      desc.dims[i] = extents[i];                                               \
-      /* Legion AffineAccessor::strides are in bytes */                        \
-      desc.strides[i] = acc.accessor.strides[i] / sizeof(T);                   \
-    }                                                                          \
-    desc.length = shp.volume();                                                \
-    CUDA_DEBUG_PRINT(std::cerr << "[RunPTXBroadcastTask] " #MODE               \
-                               << " packed dims=";                             \
-                     for (size_t i = 0; i < D; ++i) std::cerr                  \
-                     << desc.dims[i] << (i + 1 < D ? "," : "");                \
-                     std::cerr << " elem_strides=";                            \
-                     for (size_t i = 0; i < D; ++i) std::cerr                  \
-                     << desc.strides[i] << (i + 1 < D ? "," : "");             \
-                     std::cerr << " length=" << desc.length << std::endl;);    \
-    memcpy(p, &desc, sizeof(CuStridedDeviceArray<D>));                         \
-    p += sizeof(CuStridedDeviceArray<D>);                                      \
-  }
-
-CUDA_DEVICE_ARRAY_ARG(read, read_accessor);    // cuda_device_array_arg_read
-CUDA_DEVICE_ARRAY_ARG(write, write_accessor);  // cuda_device_array_arg_write
-CUDA_STRIDED_DEVICE_ARRAY_ARG(read, read_accessor);
-CUDA_STRIDED_DEVICE_ARRAY_ARG(write, write_accessor);
-
-struct ufiFunctor {
-  template <legate::Type::Code CODE, int DIM>
-  void operator()(AccessMode mode, char *&p, const legate::PhysicalArray &arr) {
-    using CppT = typename legate_util::code_to_cxx<CODE>::type;
-    if (mode == AccessMode::READ)
-      cuda_device_array_arg_read<CppT, DIM>(p, arr);
-    else
-      cuda_device_array_arg_write<CppT, DIM>(p, arr);
-  }
-};
+// Packs the strided descriptor of one array argument into the arg buffer.
+template <typename T, int D>
+void cuda_strided_device_array_arg(char *&p, const legate::PhysicalArray &rf,
+                                   AccessMode mode) {
+  const auto desc =
+      strided_descriptor<T, D>(rf.data(), mode == AccessMode::WRITE);
+  CUDA_DEBUG_PRINT(
+      std::cerr << "[RunPTXTask] "
+                << (mode == AccessMode::WRITE ? "write" : "read")
+                << " packed dims=";
+      for (size_t i = 0; i < D; ++i) std::cerr
+      << desc.dims[i] << (i + 1 < D ? "," : "");
+      std::cerr << " elem_strides=";
+      for (size_t i = 0; i < D; ++i) std::cerr
+      << desc.strides[i] << (i + 1 < D ? "," : "");
+      std::cerr << " length=" << desc.length << std::endl;);
+  memcpy(p, &desc, sizeof(CuStridedDeviceArray<D>));
+  p += sizeof(CuStridedDeviceArray<D>);
+}
 
 struct ufiStridedFunctor {
   template <legate::Type::Code CODE, int DIM>
   void operator()(AccessMode mode, char *&p, const legate::PhysicalArray &arr) {
     using CppT = typename legate_util::code_to_cxx<CODE>::type;
-    if (mode == AccessMode::READ)
-      cuda_strided_device_array_arg_read<CppT, DIM>(p, arr);
-    else
-      cuda_strided_device_array_arg_write<CppT, DIM>(p, arr);
+    cuda_strided_device_array_arg<CppT, DIM>(p, arr, mode);
   }
 };
 
@@ -322,6 +236,8 @@ static inline void align8(char *&ptr) {
 
 // RunPTXTask: user-defined @cuda_task kernels
 // Arg buffer: [kernel_state | inputs... | outputs... | scalars...]
+// Every array is a CuStridedDeviceArray with its own extents and strides, so
+// arguments of different shapes (and slices or broadcast views) run in place.
 // https://github.com/nv-legate/legate.pandas/blob/branch-22.01/src/udf/eval_udf_gpu.cc
 /*static*/ void RunPTXTask::gpu_variant(legate::TaskContext context) {
   auto lp = read_launch_params(context);
@@ -332,7 +248,7 @@ static inline void align8(char *&ptr) {
 
   std::size_t max_buffer_size =
       padded_bytes_kernel_state +
-      (num_inputs + num_outputs) * sizeof(CuDeviceArray<REALM_MAX_DIM>);
+      (num_inputs + num_outputs) * sizeof(CuStridedDeviceArray<REALM_MAX_DIM>);
   for (std::size_t i = ARG_OFFSET; i < num_scalars; ++i)
     max_buffer_size += context.scalar(i).size();
 
@@ -341,12 +257,12 @@ static inline void align8(char *&ptr) {
 
   for (std::size_t i = 0; i < num_inputs; ++i) {
     auto ps = context.input(i);
-    legate::double_dispatch(ps.dim(), ps.type().code(), ufiFunctor{},
+    legate::double_dispatch(ps.dim(), ps.type().code(), ufiStridedFunctor{},
                             ufi::AccessMode::READ, p, ps);
   }
   for (std::size_t i = 0; i < num_outputs; ++i) {
     auto ps = context.output(i);
-    legate::double_dispatch(ps.dim(), ps.type().code(), ufiFunctor{},
+    legate::double_dispatch(ps.dim(), ps.type().code(), ufiStridedFunctor{},
                             ufi::AccessMode::WRITE, p, ps);
   }
   for (std::size_t i = ARG_OFFSET; i < num_scalars; ++i) {
@@ -650,6 +566,13 @@ inline void add_scalar_from_ptr(legate::AutoTask &task, void *ptr,
   task.add_scalar_arg(legate::Scalar(vec));
 }
 
+// Hands `var` whole to every point of `task` (used when @cuda_task
+// arguments differ in shape and cannot be aligned).
+inline void add_broadcast_constraint(legate::AutoTask &task,
+                                     const legate::Variable &var) {
+  task.add_constraint(legate::broadcast(var));
+}
+
 void gpu_sync() {
   cudaStream_t stream_ = nullptr;
   ERROR_CHECK(cudaDeviceSynchronize());
@@ -674,6 +597,7 @@ void register_kernel_state_size(uint64_t st_size) {
 void wrap_cuda_methods(jlcxx::Module &mod) {
   mod.method("add_xyz_scalars", &add_xyz_scalars);
   mod.method("add_scalar_from_ptr", &add_scalar_from_ptr);
+  mod.method("add_broadcast_constraint", &add_broadcast_constraint);
   mod.method("register_kernel_state_size", &register_kernel_state_size);
   mod.method("gpu_sync", &gpu_sync);
   mod.method("extract_kernel_name", &extract_kernel_name);
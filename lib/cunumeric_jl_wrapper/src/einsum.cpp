@@ -0,0 +1,427 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahhal <naderrahhal2026@u.northwestern.edu>
+ */
+
+#include "einsum.h"
+
+#include <cupynumeric.h>
+#include <cupynumeric/runtime.h>
+
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <limits>
+#include <mutex>
+#include <numeric>
+#include <unordered_map>
+#include <utility>
+
+#include "gemm.h"
+
+namespace tasks {
+namespace {
+
+using cupynumeric::NDArray;
+
+// Index letters a-z, A-Z as bits of a mask.
+constexpr int32_t MAX_INDICES = 52;
+using Mask = uint64_t;
+using Path = std::vector<std::pair<int32_t, int32_t>>;
+
+int32_t index_bit(char c) {
+  if (c >= 'a' && c <= 'z') return c - 'a';
+  if (c >= 'A' && c <= 'Z') return 26 + (c - 'A');
+  return -1;
+}
+
+char index_char(int32_t bit) {
+  return static_cast<char>(bit < 26 ? 'a' + bit : 'A' + (bit - 26));
+}
+
+int32_t popcount(Mask m) {
+  return static_cast<int32_t>(std::bitset<64>(m).count());
+}
+
+Mask mask_of(const std::string& idx) {
+  Mask m = 0;
+  for (char c : idx) m |= Mask{1} << index_bit(c);
+  return m;
+}
+
+struct Expression {
+  std::vector<std::string> inputs;
+  std::string output;
+  std::array<double, MAX_INDICES> extent{};
+};
+
+// Parses `subscripts` and checks it against the operand shapes.
+std::optional<Expression> parse(
+    const std::string& subscripts,
+    const std::vector<std::vector<uint64_t>>& shapes) {
+  Expression expr;
+  std::string lhs = subscripts, rhs;
+  const auto arrow = subscripts.find("->");
+  const bool implicit = arrow == std::string::npos;
+  if (!implicit) {
+    lhs = subscripts.substr(0, arrow);
+    rhs = subscripts.substr(arrow + 2);
+  }
+
+  std::string term;
+  auto flush = [&]() {
+    expr.inputs.push_back(std::move(term));
+    term.clear();
+  };
+  for (char c : lhs) {
+    if (c == ',') {
+      flush();
+    } else if (c != ' ') {
+      if (index_bit(c) < 0) return std::nullopt;  // includes ellipses
+      term.push_back(c);
+    }
+  }
+  flush();
+  if (expr.inputs.size() != shapes.size()) return std::nullopt;
+
+  std::array<int32_t, MAX_INDICES> count{};
+  std::array<bool, MAX_INDICES> seen{};
+  for (std::size_t i = 0; i < expr.inputs.size(); ++i) {
+    const auto& idx = expr.inputs[i];
+    if (idx.size() != shapes[i].size()) return std::nullopt;
+    if (popcount(mask_of(idx)) != static_cast<int32_t>(idx.size()))
+      return std::nullopt;  // no diagonals
+    for (std::size_t d = 0; d < idx.size(); ++d) {
+      const int32_t bit = index_bit(idx[d]);
+      const double ext = static_cast<double>(shapes[i][d]);
+      if (seen[bit] && expr.extent[bit] != ext) return std::nullopt;
+      seen[bit] = true;
+      expr.extent[bit] = ext;
+      ++count[bit];
+    }
+  }
+
+  if (implicit) {  // indices used once, alphabetical (numpy)
+    for (char c = 'A'; c <= 'Z'; ++c)
+      if (count[index_bit(c)] == 1) expr.output.push_back(c);
+    for (char c = 'a'; c <= 'z'; ++c)
+      if (count[index_bit(c)] == 1) expr.output.push_back(c);
+  } else {
+    for (char c : rhs) {
+      if (c == ' ') continue;
+      const int32_t bit = index_bit(c);
+      if (bit < 0 || !seen[bit]) return std::nullopt;
+      expr.output.push_back(c);
+    }
+    if (popcount(mask_of(expr.output)) !=
+        static_cast<int32_t>(expr.output.size()))
+      return std::nullopt;
+  }
+  return expr;
+}
+
+double volume(Mask m, const Expression& expr) {
+  double v = 1.0;
+  for (int32_t bit = 0; bit < MAX_INDICES; ++bit)
+    if (m & (Mask{1} << bit)) v *= expr.extent[bit];
+  return v;
+}
+
+// Indices of the pair's product: everything still needed by another
+// operand or by the output.
+Mask product_mask(const std::vector<Mask>& ops, std::size_t i, std::size_t j,
+                  Mask output) {
+  Mask keep = output;
+  for (std::size_t o = 0; o < ops.size(); ++o)
+    if (o != i && o != j) keep |= ops[o];
+  return (ops[i] | ops[j]) & keep;
+}
+
+std::vector<Mask> contract(const std::vector<Mask>& ops, std::size_t i,
+                           std::size_t j, Mask product) {
+  std::vector<Mask> next;
+  for (std::size_t o = 0; o < ops.size(); ++o)
+    if (o != i && o != j) next.push_back(ops[o]);
+  next.push_back(product);
+  return next;
+}
+
+// Exhaustive search; cost is the multiply-add count, ties go to the path
+// with the smaller largest intermediate.
+struct OptimalSearch {
+  const Expression& expr;
+  Mask output;
+  double best_cost = std::numeric_limits<double>::infinity();
+  double best_peak = std::numeric_limits<double>::infinity();
+  Path best, current;
+
+  void run(const std::vector<Mask>& ops, double cost, double peak) {
+    if (ops.size() == 1) {
+      if (cost < best_cost || (cost == best_cost && peak < best_peak)) {
+        best_cost = cost;
+        best_peak = peak;
+        best = current;
+      }
+      return;
+    }
+    for (std::size_t i = 0; i < ops.size(); ++i) {
+      for (std::size_t j = i + 1; j < ops.size(); ++j) {
+        const Mask product = product_mask(ops, i, j, output);
+        const double step_cost = cost + volume(ops[i] | ops[j], expr);
+        if (step_cost > best_cost) continue;
+        const double step_peak = std::max(peak, volume(product, expr));
+        current.emplace_back(i, j);
+        run(contract(ops, i, j, product), step_cost, step_peak);
+        current.pop_back();
+      }
+    }
+  }
+};
+
+// Greedy: repeatedly take the pair whose product shrinks the working set
+// the most, then the cheapest.
+Path greedy_path(std::vector<Mask> ops, Mask output, const Expression& expr) {
+  Path path;
+  while (ops.size() > 1) {
+    std::pair<double, double> best_key{std::numeric_limits<double>::infinity(),
+                                       0.0};
+    std::size_t bi = 0, bj = 1;
+    Mask best_product = 0;
+    for (std::size_t i = 0; i < ops.size(); ++i) {
+      for (std::size_t j = i + 1; j < ops.size(); ++j) {
+        const Mask product = product_mask(ops, i, j, output);
+        const std::pair<double, double> key{
+            volume(product, expr) - volume(ops[i], expr) -
+                volume(ops[j], expr),
+            volume(ops[i] | ops[j], expr)};
+        if (key < best_key) {
+          best_key = key;
+          bi = i;
+          bj = j;
+          best_product = product;
+        }
+      }
+    }
+    path.emplace_back(bi, bj);
+    ops = contract(ops, bi, bj, best_product);
+  }
+  return path;
+}
+
+constexpr std::size_t MAX_OPTIMAL_OPERANDS = 6;
+constexpr std::size_t MAX_CACHED_PLANS = 1024;
+
+Path find_path(const Expression& expr) {
+  std::vector<Mask> ops;
+  for (const auto& idx : expr.inputs) ops.push_back(mask_of(idx));
+  const Mask output = mask_of(expr.output);
+  if (ops.size() > MAX_OPTIMAL_OPERANDS) return greedy_path(ops, output, expr);
+  OptimalSearch search{expr, output};
+  search.run(ops, 0.0, 0.0);
+  return search.best;
+}
+
+std::string cache_key(const std::string& subscripts,
+                      const std::vector<std::vector<uint64_t>>& shapes) {
+  std::string key = subscripts;
+  for (const auto& shape : shapes) {
+    key.push_back('|');
+    for (auto e : shape) key += std::to_string(e) + ",";
+  }
+  return key;
+}
+
+// Parsed expression plus its contraction order, per subscripts and shapes.
+struct Plan {
+  Expression expr;
+  Path path;
+};
+
+std::optional<Plan> lookup_plan(
+    const std::string& subscripts,
+    const std::vector<std::vector<uint64_t>>& shapes) {
+  static std::mutex mutex;
+  static std::unordered_map<std::string, Plan> cache;
+
+  const auto key = cache_key(subscripts, shapes);
+  std::lock_guard<std::mutex> lock(mutex);
+  if (auto it = cache.find(key); it != cache.end()) return it->second;
+
+  auto expr = parse(subscripts, shapes);
+  if (!expr.has_value()) return std::nullopt;
+  Plan plan{std::move(expr.value()), {}};
+  plan.path = find_path(plan.expr);
+  if (cache.size() >= MAX_CACHED_PLANS) cache.clear();
+  return cache.emplace(key, std::move(plan)).first->second;
+}
+
+std::vector<uint64_t> shape_of(const NDArray& arr) {
+  const auto& s = arr.shape();
+  return {s.begin(), s.end()};
+}
+
+// Sums away the axes of `arr` whose index is in `drop`.
+NDArray sum_out(NDArray arr, std::string& idx, Mask drop) {
+  for (int32_t ax = static_cast<int32_t>(idx.size()) - 1; ax >= 0; --ax) {
+    if (!(drop & (Mask{1} << index_bit(idx[ax])))) continue;
+    arr = arr._perform_unary_reduction(
+        static_cast<int32_t>(CUPYNUMERIC_RED_SUM), arr, {ax}, std::nullopt,
+        std::nullopt, std::nullopt, false, {}, std::nullopt, std::nullopt);
+    idx.erase(ax, 1);
+  }
+  return arr;
+}
+
+// Reorders the axes of `arr` from `idx` to `order` (a permutation of it).
+NDArray permute(const NDArray& arr, const std::string& idx,
+                const std::string& order) {
+  if (idx == order) return arr;
+  std::vector<int32_t> axes;
+  for (char c : order) axes.push_back(static_cast<int32_t>(idx.find(c)));
+  return cupynumeric::transpose(arr, axes);
+}
+
+NDArray reshape(const NDArray& arr, std::vector<int64_t> shape) {
+  return cupynumeric::reshape(arr, std::move(shape), "C");
+}
+
+int64_t extent_product(const Expression& expr, const std::string& idx) {
+  int64_t v = 1;
+  for (char c : idx) v *= static_cast<int64_t>(expr.extent[index_bit(c)]);
+  return v;
+}
+
+// x[bl k] * y[b k r] -> out[b l r] as one gemm over (B, M, K) x (B, K, N).
+std::optional<NDArray> contract_pair(NDArray x, std::string x_idx, NDArray y,
+                                     std::string y_idx, Mask keep,
+                                     const Expression& expr,
+                                     std::string& out_idx) {
+  const Mask xm = mask_of(x_idx), ym = mask_of(y_idx);
+  x = sum_out(std::move(x), x_idx, xm & ~ym & ~keep);
+  y = sum_out(std::move(y), y_idx, ym & ~xm & ~keep);
+
+  std::string batch, left, contracted, right;
+  for (char c : x_idx) {
+    const bool in_y = y_idx.find(c) != std::string::npos;
+    const bool kept = keep & (Mask{1} << index_bit(c));
+    (in_y ? (kept ? batch : contracted) : left).push_back(c);
+  }
+  for (char c : y_idx)
+    if (x_idx.find(c) == std::string::npos) right.push_back(c);
+
+  const int64_t B = extent_product(expr, batch);
+  const int64_t M = extent_product(expr, left);
+  const int64_t K = extent_product(expr, contracted);
+  const int64_t N = extent_product(expr, right);
+
+  // Without batch indices use 2-D operands so gemm can split the matrix.
+  std::vector<int64_t> a_shape{M, K}, b_shape{K, N};
+  std::vector<uint64_t> c_shape{static_cast<uint64_t>(M),
+                                static_cast<uint64_t>(N)};
+  if (!batch.empty()) {
+    a_shape.insert(a_shape.begin(), B);
+    b_shape.insert(b_shape.begin(), B);
+    c_shape.insert(c_shape.begin(), static_cast<uint64_t>(B));
+  }
+  auto a = reshape(permute(x, x_idx, batch + left + contracted), a_shape);
+  auto b = reshape(permute(y, y_idx, batch + contracted + right), b_shape);
+  auto runtime = cupynumeric::CuPyNumericRuntime::get_runtime();
+  auto c = runtime->create_array(std::move(c_shape), x.type());
+  if (!gemm(a, false, b, false, c)) return std::nullopt;
+
+  out_idx = batch + left + right;
+  std::vector<int64_t> out_shape;
+  for (char c_ : out_idx)
+    out_shape.push_back(static_cast<int64_t>(expr.extent[index_bit(c_)]));
+  return reshape(c, out_shape);
+}
+
+}  // namespace
+
+std::vector<std::pair<int32_t, int32_t>> einsum_path(
+    const std::string& subscripts,
+    const std::vector<std::vector<uint64_t>>& shapes) {
+  auto plan = lookup_plan(subscripts, shapes);
+  if (!plan.has_value()) return {};
+  return plan->path;
+}
+
+std::optional<NDArray> einsum(const std::string& subscripts,
+                              const std::vector<NDArray>& operands) {
+  if (operands.empty()) return std::nullopt;
+  std::vector<std::vector<uint64_t>> shapes;
+  for (const auto& op : operands) {
+    if (op.type() != operands.front().type()) return std::nullopt;
+    shapes.push_back(shape_of(op));
+  }
+  auto plan = lookup_plan(subscripts, shapes);
+  if (!plan.has_value()) return std::nullopt;
+  const auto& expr = plan->expr;
+  const Mask output = mask_of(expr.output);
+
+  std::vector<NDArray> ops = operands;
+  std::vector<std::string> idx = expr.inputs;
+  for (const auto& [i, j] : plan->path) {
+    Mask keep = output;
+    for (std::size_t o = 0; o < idx.size(); ++o)
+      if (o != static_cast<std::size_t>(i) && o != static_cast<std::size_t>(j))
+        keep |= mask_of(idx[o]);
+    std::string out_idx;
+    auto product = contract_pair(ops[i], idx[i], ops[j], idx[j], keep, expr,
+                                 out_idx);
+    if (!product.has_value()) return std::nullopt;
+    // j > i, so erase j first
+    ops.erase(ops.begin() + j);
+    ops.erase(ops.begin() + i);
+    idx.erase(idx.begin() + j);
+    idx.erase(idx.begin() + i);
+    ops.push_back(std::move(product.value()));
+    idx.push_back(std::move(out_idx));
+  }
+
+  std::string& last = idx.front();
+  NDArray result = sum_out(ops.front(), last, mask_of(last) & ~output);
+  result = permute(result, last, expr.output);
+  // A single-operand expression may be a pure view; einsum returns new data.
+  return operands.size() == 1 ? result.copy() : result;
+}
+
+std::optional<NDArray> tensordot(const NDArray& a, const NDArray& b,
+                                 const std::vector<int32_t>& a_axes,
+                                 const std::vector<int32_t>& b_axes) {
+  const int32_t a_dim = a.dim(), b_dim = b.dim();
+  if (a_axes.size() != b_axes.size() || a_dim + b_dim > MAX_INDICES)
+    return std::nullopt;
+  std::string a_idx, b_idx, out;
+  for (int32_t d = 0; d < a_dim; ++d) a_idx.push_back(index_char(d));
+  for (int32_t d = 0; d < b_dim; ++d) b_idx.push_back(index_char(a_dim + d));
+  for (std::size_t p = 0; p < a_axes.size(); ++p) {
+    const int32_t ax = a_axes[p] < 0 ? a_axes[p] + a_dim : a_axes[p];
+    const int32_t bx = b_axes[p] < 0 ? b_axes[p] + b_dim : b_axes[p];
+    if (ax < 0 || ax >= a_dim || bx < 0 || bx >= b_dim) return std::nullopt;
+    b_idx[bx] = a_idx[ax];
+  }
+  const Mask a_m = mask_of(a_idx), b_m = mask_of(b_idx);
+  for (char c : a_idx)
+    if (!(b_m & (Mask{1} << index_bit(c)))) out.push_back(c);
+  for (char c : b_idx)
+    if (!(a_m & (Mask{1} << index_bit(c)))) out.push_back(c);
+  return einsum(a_idx + "," + b_idx + "->" + out, {a, b});
+}
+
+}  // namespace tasks
@@ -0,0 +1,759 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahhal <naderrahhal2026@u.northwestern.edu>
+ */
+
+#include "expr.h"
+
+#include <cupynumeric.h>
+#include <cupynumeric/cupynumeric_c.h>
+#include <cupynumeric/runtime.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "half.h"
+
+namespace tasks {
+namespace {
+
+// Elements per register. Small enough that a program's registers stay in
+// L1/L2 while it runs over a block.
+constexpr int64_t BLOCK = 256;
+constexpr std::size_t WORDS = 5;  // int64 words per instruction
+
+// Ops every fusible type supports, and the ones only floating point does.
+// apply_unary/apply_binary below implement exactly these.
+constexpr std::array<int32_t, 5> EXACT_UNARY_OPS = {
+    CUPYNUMERIC_UOP_ABSOLUTE, CUPYNUMERIC_UOP_COPY, CUPYNUMERIC_UOP_NEGATIVE,
+    CUPYNUMERIC_UOP_POSITIVE, CUPYNUMERIC_UOP_SQUARE};
+constexpr std::array<int32_t, 24> FLOAT_UNARY_OPS = {
+    CUPYNUMERIC_UOP_ARCCOS, CUPYNUMERIC_UOP_ARCCOSH, CUPYNUMERIC_UOP_ARCSIN,
+    CUPYNUMERIC_UOP_ARCSINH, CUPYNUMERIC_UOP_ARCTAN, CUPYNUMERIC_UOP_ARCTANH,
+    CUPYNUMERIC_UOP_CBRT, CUPYNUMERIC_UOP_CEIL, CUPYNUMERIC_UOP_COS,
+    CUPYNUMERIC_UOP_COSH, CUPYNUMERIC_UOP_EXP, CUPYNUMERIC_UOP_EXP2,
+    CUPYNUMERIC_UOP_EXPM1, CUPYNUMERIC_UOP_FLOOR, CUPYNUMERIC_UOP_LOG,
+    CUPYNUMERIC_UOP_LOG10, CUPYNUMERIC_UOP_LOG1P, CUPYNUMERIC_UOP_LOG2,
+    CUPYNUMERIC_UOP_SIN, CUPYNUMERIC_UOP_SINH, CUPYNUMERIC_UOP_SQRT,
+    CUPYNUMERIC_UOP_TAN, CUPYNUMERIC_UOP_TANH, CUPYNUMERIC_UOP_TRUNC};
+constexpr std::array<int32_t, 5> EXACT_BINARY_OPS = {
+    CUPYNUMERIC_BINOP_ADD, CUPYNUMERIC_BINOP_MAXIMUM, CUPYNUMERIC_BINOP_MINIMUM,
+    CUPYNUMERIC_BINOP_MULTIPLY, CUPYNUMERIC_BINOP_SUBTRACT};
+constexpr std::array<int32_t, 5> FLOAT_BINARY_OPS = {
+    CUPYNUMERIC_BINOP_ARCTAN2, CUPYNUMERIC_BINOP_COPYSIGN,
+    CUPYNUMERIC_BINOP_DIVIDE, CUPYNUMERIC_BINOP_HYPOT, CUPYNUMERIC_BINOP_POWER};
+
+template <std::size_t N>
+bool contains(const std::array<int32_t, N>& ops, int32_t op_code) {
+  return std::find(ops.begin(), ops.end(), op_code) != ops.end();
+}
+
+bool fusible_type(legate::Type::Code code) {
+  return code == legate::Type::Code::FLOAT16 ||
+         code == legate::Type::Code::FLOAT32 ||
+         code == legate::Type::Code::FLOAT64 ||
+         code == legate::Type::Code::INT32 || code == legate::Type::Code::INT64;
+}
+
+bool floating(legate::Type::Code code) {
+  return code == legate::Type::Code::FLOAT16 ||
+         code == legate::Type::Code::FLOAT32 ||
+         code == legate::Type::Code::FLOAT64;
+}
+
+template <legate::Type::Code CODE>
+constexpr bool FUSIBLE_CODE =
+    CODE == legate::Type::Code::FLOAT32 ||
+    CODE == legate::Type::Code::FLOAT64 ||
+    CODE == legate::Type::Code::INT32 || CODE == legate::Type::Code::INT64;
+
+template <typename F>
+void parallel_for(int64_t count, bool openmp, F&& f) {
+  if (openmp) {
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < count; ++i) f(i);
+  } else {
+    for (int64_t i = 0; i < count; ++i) f(i);
+  }
+}
+
+// The op is a template argument of each loop, so every (type, op) pair
+// compiles to its own vectorized loop.
+template <typename T, typename F>
+inline void unary_loop(T* out, const T* a, int64_t n, F f) {
+#pragma omp simd
+  for (int64_t i = 0; i < n; ++i) out[i] = f(a[i]);
+}
+
+template <typename T, typename F>
+inline void binary_loop(T* out, const T* a, const T* b, int64_t n, F f) {
+#pragma omp simd
+  for (int64_t i = 0; i < n; ++i) out[i] = f(a[i], b[i]);
+}
+
+template <typename T>
+void apply_unary(int32_t op_code, T* out, const T* a, int64_t n) {
+#define EXPR_UNARY_CASE(CODE, EXPR)                         \
+  case CODE:                                                \
+    unary_loop(out, a, n, [](T x) -> T { return (EXPR); }); \
+    return;
+  switch (op_code) {
+    EXPR_UNARY_CASE(CUPYNUMERIC_UOP_ABSOLUTE, std::abs(x))
+    EXPR_UNARY_CASE(CUPYNUMERIC_UOP_COPY, x)
+    EXPR_UNARY_CASE(CUPYNUMERIC_UOP_NEGATIVE, -x)
+    EXPR_UNARY_CASE(CUPYNUMERIC_UOP_POSITIVE, x)
+    EXPR_UNARY_CASE(CUPYNUMERIC_UOP_SQUARE, x * x)
+    default:
+      break;
+  }
+  if constexpr (std::is_floating_point_v<T>) {
+    switch (op_code) {
+      EXPR_UNARY_CASE(CUPYNUMERIC_UOP_ARCCOS, std::acos(x))
+      EXPR_UNARY_CASE(CUPYNUMERIC_UOP_ARCCOSH, std::acosh(x))
+      EXPR_UNARY_CASE(CUPYNUMERIC_UOP_ARCSIN, std::asin(x))
+      EXPR_UNARY_CASE(CUPYNUMERIC_UOP_ARCSINH, std::asinh(x))
+      EXPR_UNARY_CASE(CUPYNUMERIC_UOP_ARCTAN, std::atan(x))
+      EXPR_UNARY_CASE(CUPYNUMERIC_UOP_ARCTANH, std::atanh(x))
+      EXPR_UNARY_CASE(CUPYNUMERIC_UOP_CBRT, std::cbrt(x))
+      EXPR_UNARY_CASE(CUPYNUMERIC_UOP_CEIL, std::ceil(x))
+      EXPR_UNARY_CASE(CUPYNUMERIC_UOP_COS, std::cos(x))
+      EXPR_UNARY_CASE(CUPYNUMERIC_UOP_COSH, std::cosh(x))
+      EXPR_UNARY_CASE(CUPYNUMERIC_UOP_EXP, std::exp(x))
+      EXPR_UNARY_CASE(CUPYNUMERIC_UOP_EXP2, std::exp2(x))
+      EXPR_UNARY_CASE(CUPYNUMERIC_UOP_EXPM1, std::expm1(x))
+      EXPR_UNARY_CASE(CUPYNUMERIC_UOP_FLOOR, std::floor(x))
+      EXPR_UNARY_CASE(CUPYNUMERIC_UOP_LOG, std::log(x))
+      EXPR_UNARY_CASE(CUPYNUMERIC_UOP_LOG10, std::log10(x))
+      EXPR_UNARY_CASE(CUPYNUMERIC_UOP_LOG1P, std::log1p(x))
+      EXPR_UNARY_CASE(CUPYNUMERIC_UOP_LOG2, std::log2(x))
+      EXPR_UNARY_CASE(CUPYNUMERIC_UOP_SIN, std::sin(x))
+      EXPR_UNARY_CASE(CUPYNUMERIC_UOP_SINH, std::sinh(x))
+      EXPR_UNARY_CASE(CUPYNUMERIC_UOP_SQRT, std::sqrt(x))
+      EXPR_UNARY_CASE(CUPYNUMERIC_UOP_TAN, std::tan(x))
+      EXPR_UNARY_CASE(CUPYNUMERIC_UOP_TANH, std::tanh(x))
+      EXPR_UNARY_CASE(CUPYNUMERIC_UOP_TRUNC, std::trunc(x))
+      default:
+        break;
+    }
+  }
+#undef EXPR_UNARY_CASE
+}
+
+template <typename T>
+void apply_binary(int32_t op_code, T* out, const T* a, const T* b,
+                  int64_t n) {
+#define EXPR_BINARY_CASE(CODE, EXPR)                                   \
+  case CODE:                                                           \
+    binary_loop(out, a, b, n, [](T x, T y) -> T { return (EXPR); }); \
+    return;
+  switch (op_code) {
+    EXPR_BINARY_CASE(CUPYNUMERIC_BINOP_ADD, x + y)
+    // NaN in either operand propagates, as in NumPy.
+    EXPR_BINARY_CASE(CUPYNUMERIC_BINOP_MAXIMUM, (x != x || x > y) ? x : y)
+    EXPR_BINARY_CASE(CUPYNUMERIC_BINOP_MINIMUM, (x != x || x < y) ? x : y)
+    EXPR_BINARY_CASE(CUPYNUMERIC_BINOP_MULTIPLY, x * y)
+    EXPR_BINARY_CASE(CUPYNUMERIC_BINOP_SUBTRACT, x - y)
+    default:
+      break;
+  }
+  if constexpr (std::is_floating_point_v<T>) {
+    switch (op_code) {
+      EXPR_BINARY_CASE(CUPYNUMERIC_BINOP_ARCTAN2, std::atan2(x, y))
+      EXPR_BINARY_CASE(CUPYNUMERIC_BINOP_COPYSIGN, std::copysign(x, y))
+      EXPR_BINARY_CASE(CUPYNUMERIC_BINOP_DIVIDE, x / y)
+      EXPR_BINARY_CASE(CUPYNUMERIC_BINOP_HYPOT, std::hypot(x, y))
+      EXPR_BINARY_CASE(CUPYNUMERIC_BINOP_POWER, std::pow(x, y))
+      default:
+        break;
+    }
+  }
+#undef EXPR_BINARY_CASE
+}
+
+// Runs `program` over one block of `n` elements. `regs[r]` points at the
+// current contents of register r: its scratch row, or straight at an input
+// when `load` returns the input's own memory.
+template <typename T, typename Load, typename Store>
+void eval_block(const std::vector<int64_t>& program,
+                const std::vector<T>& consts, T* scratch, const T** regs,
+                int64_t n, Load&& load, Store&& store) {
+  for (std::size_t pc = 0; pc < program.size(); pc += WORDS) {
+    const int64_t* ins = program.data() + pc;
+    T* dst = scratch + ins[2] * BLOCK;
+    switch (ins[0]) {
+      case EXPR_LOAD:
+        regs[ins[2]] = load(ins[3], dst);
+        break;
+      case EXPR_CONST:
+        std::fill_n(dst, n, consts[ins[3]]);
+        regs[ins[2]] = dst;
+        break;
+      case EXPR_UNARY:
+        apply_unary<T>(static_cast<int32_t>(ins[1]), dst, regs[ins[3]], n);
+        regs[ins[2]] = dst;
+        break;
+      case EXPR_BINARY:
+        apply_binary<T>(static_cast<int32_t>(ins[1]), dst, regs[ins[3]],
+                        regs[ins[4]], n);
+        regs[ins[2]] = dst;
+        break;
+      case EXPR_STORE:
+        store(ins[2], regs[ins[3]]);
+        break;
+    }
+  }
+}
+
+// S is the element type in memory and T the type registers compute in. They
+// differ only for FLOAT16, whose blocks widen to float on load and narrow on
+// store; both conversions vectorize, so the op loops stay float loops.
+template <typename S, typename T, int DIM>
+void expr_tile(legate::TaskContext& context, bool openmp) {
+  constexpr bool HALF = std::is_same_v<S, Half>;
+  // Legate has no C++ type for FLOAT16 on CPU builds, so Half skips the check.
+  constexpr bool CHECKED = !HALF;
+  const auto rect = context.output(0).data().shape<DIM>();
+  if (rect.empty()) return;
+  const auto program = context.scalar(0).values<int64_t>();
+  const auto bits = context.scalar(1).values<int64_t>();
+  const auto nregs = context.scalar(2).value<int32_t>();
+  const std::vector<int64_t> code(program.begin(), program.end());
+
+  std::vector<T> consts(bits.size());
+  for (std::size_t i = 0; i < bits.size(); ++i) {
+    S value;
+    std::memcpy(&value, &bits[i], sizeof(S));
+    if constexpr (HALF) {
+      consts[i] = half_to_float(value);
+    } else {
+      consts[i] = value;
+    }
+  }
+
+  bool dense = true;
+  std::vector<legate::AccessorRO<S, DIM>> ins;
+  for (std::size_t i = 0; i < context.num_inputs(); ++i) {
+    ins.push_back(
+        context.input(i).data().read_accessor<S, DIM, CHECKED>(rect));
+    dense = dense && ins.back().accessor.is_dense_row_major(rect);
+  }
+  std::vector<legate::AccessorWO<S, DIM>> outs;
+  for (std::size_t i = 0; i < context.num_outputs(); ++i) {
+    outs.push_back(
+        context.output(i).data().write_accessor<S, DIM, CHECKED>(rect));
+    dense = dense && outs.back().accessor.is_dense_row_major(rect);
+  }
+
+  const int64_t volume = static_cast<int64_t>(rect.volume());
+  const int64_t blocks = (volume + BLOCK - 1) / BLOCK;
+  int64_t pitch[DIM];
+  pitch[DIM - 1] = 1;
+  for (int d = DIM - 1; d > 0; --d)
+    pitch[d - 1] = pitch[d] * (rect.hi[d] - rect.lo[d] + 1);
+
+  parallel_for(blocks, openmp, [&](int64_t blk) {
+    thread_local std::vector<T> scratch;
+    thread_local std::vector<const T*> regs;
+    thread_local std::vector<legate::Point<DIM>> points;
+    scratch.resize(static_cast<std::size_t>(nregs) * BLOCK);
+    regs.resize(nregs);
+    const int64_t start = blk * BLOCK;
+    const int64_t n = std::min(BLOCK, volume - start);
+
+    if (dense) {
+      eval_block<T>(
+          code, consts, scratch.data(), regs.data(), n,
+          [&](int64_t slot, T* buf) -> const T* {
+            const S* src = ins[slot].ptr(rect.lo) + start;
+            if constexpr (HALF) {
+              widen(src, buf, n);
+              return buf;
+            } else {
+              return src;
+            }
+          },
+          [&](int64_t slot, const T* values) {
+            S* dst = outs[slot].ptr(rect.lo) + start;
+            if constexpr (HALF) {
+              narrow(values, dst, n);
+            } else {
+              std::copy_n(values, n, dst);
+            }
+          });
+      return;
+    }
+
+    points.resize(n);
+    for (int64_t k = 0; k < n; ++k) {
+      int64_t idx = start + k;
+      for (int d = 0; d < DIM; ++d) {
+        points[k][d] = rect.lo[d] + idx / pitch[d];
+        idx %= pitch[d];
+      }
+    }
+    eval_block<T>(
+        code, consts, scratch.data(), regs.data(), n,
+        [&](int64_t slot, T* buf) -> const T* {
+          if constexpr (HALF) {
+            for (int64_t k = 0; k < n; ++k)
+              buf[k] = half_to_float(ins[slot][points[k]]);
+          } else {
+            for (int64_t k = 0; k < n; ++k) buf[k] = ins[slot][points[k]];
+          }
+          return buf;
+        },
+        [&](int64_t slot, const T* values) {
+          if constexpr (HALF) {
+            for (int64_t k = 0; k < n; ++k)
+              outs[slot][points[k]] = float_to_half(values[k]);
+          } else {
+            for (int64_t k = 0; k < n; ++k) outs[slot][points[k]] = values[k];
+          }
+        });
+  });
+}
+
+struct ExprFn {
+  template <legate::Type::Code CODE, int DIM>
+  void operator()(legate::TaskContext& context, bool openmp) {
+    if constexpr (CODE == legate::Type::Code::FLOAT16) {
+      expr_tile<Half, float, DIM>(context, openmp);
+    } else if constexpr (FUSIBLE_CODE<CODE>) {
+      using T = legate::type_of_t<CODE>;
+      expr_tile<T, T, DIM>(context, openmp);
+    }
+  }
+};
+
+void expr_variant(legate::TaskContext context, bool openmp) {
+  auto out = context.output(0).data();
+  legate::double_dispatch(out.dim(), out.type().code(), ExprFn{}, context,
+                          openmp);
+}
+
+// ---------------------------------------------------------------------------
+// Recorder
+
+enum OperandKind : int32_t { OPERAND_NODE, OPERAND_LEAF, OPERAND_CONST };
+
+struct Operand {
+  int32_t kind;
+  int32_t index;
+};
+
+struct Node {
+  int64_t op;  // EXPR_UNARY or EXPR_BINARY
+  int32_t code;
+  Operand args[2];
+  legate::Type type;
+  std::vector<uint64_t> shape;
+  // Live arrays holding this value, by handle.
+  std::vector<std::pair<const void*, cupynumeric::NDArray>> targets;
+};
+
+using NodeKey = std::tuple<int64_t, int32_t, int32_t, int32_t, int32_t,
+                           int32_t>;
+
+// Entry points from several host threads take `mutex`; it is recursive
+// since recording and disabling flush while holding it.
+struct Recorder {
+  std::recursive_mutex mutex;
+  int32_t depth = 0;
+  uint64_t launches = 0;
+  std::vector<Node> nodes;
+  std::vector<cupynumeric::NDArray> leaves;
+  std::vector<int64_t> const_bits;
+  std::unordered_map<const void*, int32_t> node_of;
+  std::unordered_map<const void*, int32_t> leaf_of;
+  std::map<std::pair<legate::Type::Code, int64_t>, int32_t> const_of;
+  std::map<NodeKey, int32_t> cse;
+  // Values of live 0-d arrays created while deferring. Kept across flushes.
+  std::unordered_map<const void*, std::pair<legate::Type::Code, int64_t>>
+      constants;
+};
+
+Recorder& recorder() {
+  static Recorder r;
+  return r;
+}
+
+std::vector<uint64_t> shape_of(const cupynumeric::NDArray& arr) {
+  const auto& shape = arr.shape();
+  return std::vector<uint64_t>(shape.begin(), shape.end());
+}
+
+bool pending(const void* key) {
+  const auto& r = recorder();
+  return r.node_of.count(key) != 0 || r.leaf_of.count(key) != 0;
+}
+
+// How `arr` enters a node computing `type` values of `shape`, or nullopt
+// when it cannot be fused.
+std::optional<Operand> operand(const void* key,
+                               const cupynumeric::NDArray& arr,
+                               const legate::Type& type,
+                               const std::vector<uint64_t>& shape) {
+  auto& r = recorder();
+  if (auto it = r.constants.find(key); it != r.constants.end()) {
+    if (it->second.first != type.code()) return std::nullopt;
+    auto [slot, added] = r.const_of.emplace(
+        it->second, static_cast<int32_t>(r.const_bits.size()));
+    if (added) r.const_bits.push_back(it->second.second);
+    return Operand{OPERAND_CONST, slot->second};
+  }
+  if (arr.type() != type) return std::nullopt;
+  if (auto it = r.node_of.find(key); it != r.node_of.end()) {
+    if (r.nodes[it->second].shape != shape) return std::nullopt;
+    return Operand{OPERAND_NODE, it->second};
+  }
+  if (shape_of(arr) != shape) return std::nullopt;
+  auto [slot, added] =
+      r.leaf_of.emplace(key, static_cast<int32_t>(r.leaves.size()));
+  if (added) r.leaves.push_back(arr);
+  return Operand{OPERAND_LEAF, slot->second};
+}
+
+bool commutative(int32_t op_code) {
+  return op_code == CUPYNUMERIC_BINOP_ADD ||
+         op_code == CUPYNUMERIC_BINOP_MULTIPLY ||
+         op_code == CUPYNUMERIC_BINOP_MAXIMUM ||
+         op_code == CUPYNUMERIC_BINOP_MINIMUM ||
+         op_code == CUPYNUMERIC_BINOP_HYPOT;
+}
+
+void add_node(const void* out_key, const cupynumeric::NDArray& out,
+              int64_t op, int32_t op_code, Operand a, Operand b) {
+  auto& r = recorder();
+  if (op == EXPR_BINARY && commutative(op_code) &&
+      std::tie(b.kind, b.index) < std::tie(a.kind, a.index))
+    std::swap(a, b);
+  // Operands fix the shape unless they are all constants.
+  const NodeKey key{op, op_code, a.kind, a.index, b.kind, b.index};
+  auto shape = shape_of(out);
+  auto [it, added] =
+      r.cse.emplace(key, static_cast<int32_t>(r.nodes.size()));
+  int32_t index = it->second;
+  if (!added && r.nodes[index].shape != shape) {
+    added = true;
+    index = static_cast<int32_t>(r.nodes.size());
+  }
+  if (added) {
+    r.nodes.push_back(
+        Node{op, op_code, {a, b}, out.type(), std::move(shape), {}});
+  }
+  r.nodes[index].targets.emplace_back(out_key, out);
+  r.node_of[out_key] = index;
+}
+
+// Common checks of record_unary/record_binary. Flushes first when `out` is
+// already part of the graph, since its old contents may still be needed.
+bool can_record(const void* out_key, const cupynumeric::NDArray& out,
+                bool fusible) {
+  if (!fusible || out.dim() == 0 || out.size() == 0) return false;
+  if (pending(out_key)) flush_deferred();
+  return true;
+}
+
+// Gives up on recording: everything pending runs before the eager op, and
+// a 0-d `out` is no longer the constant it was.
+bool run_eagerly(const void* out_key) {
+  flush_deferred();
+  recorder().constants.erase(out_key);
+  return false;
+}
+
+int32_t find(std::vector<int32_t>& parent, int32_t i) {
+  while (parent[i] != i) i = parent[i] = parent[parent[i]];
+  return i;
+}
+
+// Compiles the nodes of one subgraph (in recording order) into a program
+// and launches it.
+void launch(const std::vector<Node>& nodes,
+            const std::vector<cupynumeric::NDArray>& leaves,
+            const std::vector<int64_t>& const_bits,
+            const std::vector<int32_t>& members) {
+  // Straight-line code over SSA values first; registers come after.
+  struct Instr {
+    int64_t op, code, arg, src0, src1;  // arg: slot of a load/const/store
+  };
+  std::vector<Instr> instrs;
+  std::vector<int64_t> defines;  // value defined by each instr, or -1
+  std::vector<cupynumeric::NDArray> inputs, outputs;
+  std::vector<int64_t> consts;
+  std::unordered_map<int32_t, int64_t> node_value, leaf_value, const_value;
+  int64_t values = 0;
+
+  auto value_of = [&](Operand o) -> int64_t {
+    if (o.kind == OPERAND_NODE) return node_value.at(o.index);
+    auto& seen = o.kind == OPERAND_LEAF ? leaf_value : const_value;
+    if (auto it = seen.find(o.index); it != seen.end()) return it->second;
+    int64_t slot;
+    if (o.kind == OPERAND_LEAF) {
+      slot = static_cast<int64_t>(inputs.size());
+      inputs.push_back(leaves[o.index]);
+    } else {
+      slot = static_cast<int64_t>(consts.size());
+      consts.push_back(const_bits[o.index]);
+    }
+    const int64_t op = o.kind == OPERAND_LEAF ? EXPR_LOAD : EXPR_CONST;
+    instrs.push_back(Instr{op, 0, slot, -1, -1});
+    defines.push_back(values);
+    return seen[o.index] = values++;
+  };
+
+  for (int32_t i : members) {
+    const auto& node = nodes[i];
+    const int64_t a = value_of(node.args[0]);
+    const int64_t b = node.op == EXPR_BINARY ? value_of(node.args[1]) : -1;
+    instrs.push_back(Instr{node.op, node.code, 0, a, b});
+    defines.push_back(values);
+    node_value[i] = values++;
+    for (const auto& target : node.targets) {
+      instrs.push_back(Instr{EXPR_STORE, 0,
+                             static_cast<int64_t>(outputs.size()),
+                             node_value[i], -1});
+      defines.push_back(-1);
+      outputs.push_back(target.second);
+    }
+  }
+
+  // Linear-scan register allocation: a value's register is reused once its
+  // last reader ran. An op may write the register of an operand it frees.
+  std::vector<std::size_t> last_use(values, 0);
+  for (std::size_t i = 0; i < instrs.size(); ++i) {
+    if (instrs[i].src0 >= 0) last_use[instrs[i].src0] = i;
+    if (instrs[i].src1 >= 0) last_use[instrs[i].src1] = i;
+  }
+  std::vector<int64_t> reg(values, -1), free_regs;
+  int32_t nregs = 0;
+  std::vector<int64_t> program;
+  program.reserve(instrs.size() * WORDS);
+  for (std::size_t i = 0; i < instrs.size(); ++i) {
+    const auto& in = instrs[i];
+    const int64_t r0 = in.src0 >= 0 ? reg[in.src0] : in.arg;
+    const int64_t r1 = in.src1 >= 0 ? reg[in.src1] : 0;
+    if (in.src0 >= 0 && last_use[in.src0] == i) free_regs.push_back(r0);
+    if (in.src1 >= 0 && in.src1 != in.src0 && last_use[in.src1] == i)
+      free_regs.push_back(r1);
+    if (in.op == EXPR_STORE) {
+      program.insert(program.end(), {EXPR_STORE, 0, in.arg, r0, 0});
+      continue;
+    }
+    int64_t dst;
+    if (free_regs.empty()) {
+      dst = nregs++;
+    } else {
+      dst = free_regs.back();
+      free_regs.pop_back();
+    }
+    reg[defines[i]] = dst;
+    program.insert(program.end(), {in.op, in.code, dst, r0, r1});
+  }
+  if (consts.empty()) consts.push_back(0);
+
+  auto cn_runtime = cupynumeric::CuPyNumericRuntime::get_runtime();
+  auto runtime = legate::Runtime::get_runtime();
+  auto task = runtime->create_task(cn_runtime->get_library(),
+                                   legate::LocalTaskID{FUSED_EXPR_TASK});
+  std::vector<legate::Variable> vars;
+  for (const auto& out : outputs)
+    vars.push_back(task.add_output(out.get_store()));
+  for (const auto& in : inputs) vars.push_back(task.add_input(in.get_store()));
+  for (std::size_t i = 1; i < vars.size(); ++i)
+    task.add_constraint(legate::align(vars[0], vars[i]));
+  task.add_scalar_arg(legate::Scalar{program});
+  task.add_scalar_arg(legate::Scalar{consts});
+  task.add_scalar_arg(legate::Scalar{nregs});
+  runtime->submit(std::move(task));
+  ++recorder().launches;
+}
+
+}  // namespace
+
+void FusedExprTask::cpu_variant(legate::TaskContext context) {
+  expr_variant(context, false);
+}
+
+#if LEGATE_DEFINED(LEGATE_USE_OPENMP)
+void FusedExprTask::omp_variant(legate::TaskContext context) {
+  expr_variant(context, true);
+}
+#endif
+
+bool fusible_unary(int32_t op_code, legate::Type::Code code) {
+  if (!fusible_type(code)) return false;
+  return contains(EXACT_UNARY_OPS, op_code) ||
+         (floating(code) && contains(FLOAT_UNARY_OPS, op_code));
+}
+
+bool fusible_binary(int32_t op_code, legate::Type::Code code) {
+  if (!fusible_type(code)) return false;
+  return contains(EXACT_BINARY_OPS, op_code) ||
+         (floating(code) && contains(FLOAT_BINARY_OPS, op_code));
+}
+
+void set_deferred(bool enabled) {
+  auto& r = recorder();
+  std::lock_guard<std::recursive_mutex> lock(r.mutex);
+  if (enabled) {
+    ++r.depth;
+    return;
+  }
+  if (r.depth == 0) return;
+  if (--r.depth == 0) {
+    flush_deferred();
+    r.constants.clear();
+  }
+}
+
+bool deferred() {
+  auto& r = recorder();
+  std::lock_guard<std::recursive_mutex> lock(r.mutex);
+  return r.depth > 0;
+}
+
+bool record_unary(const void* out_key, const cupynumeric::NDArray& out,
+                  int32_t op_code, const void* in_key,
+                  const cupynumeric::NDArray& in) {
+  std::lock_guard<std::recursive_mutex> lock(recorder().mutex);
+  if (!deferred()) return false;
+  const bool fusible =
+      fusible_unary(op_code, out.type().code()) && out_key != in_key;
+  if (!can_record(out_key, out, fusible)) return run_eagerly(out_key);
+  const auto shape = shape_of(out);
+  auto a = operand(in_key, in, out.type(), shape);
+  if (!a) return run_eagerly(out_key);
+  add_node(out_key, out, EXPR_UNARY, op_code, *a, Operand{OPERAND_NODE, -1});
+  return true;
+}
+
+bool record_binary(const void* out_key, const cupynumeric::NDArray& out,
+                   int32_t op_code, const void* lhs_key,
+                   const cupynumeric::NDArray& lhs, const void* rhs_key,
+                   const cupynumeric::NDArray& rhs) {
+  std::lock_guard<std::recursive_mutex> lock(recorder().mutex);
+  if (!deferred()) return false;
+  const bool fusible = fusible_binary(op_code, out.type().code()) &&
+                       out_key != lhs_key && out_key != rhs_key;
+  if (!can_record(out_key, out, fusible)) return run_eagerly(out_key);
+  const auto shape = shape_of(out);
+  auto a = operand(lhs_key, lhs, out.type(), shape);
+  auto b = operand(rhs_key, rhs, out.type(), shape);
+  if (!a || !b) return run_eagerly(out_key);
+  add_node(out_key, out, EXPR_BINARY, op_code, *a, *b);
+  return true;
+}
+
+void record_constant(const void* key, const legate::Scalar& value) {
+  const auto code = value.type().code();
+  std::lock_guard<std::recursive_mutex> lock(recorder().mutex);
+  if (!deferred() || !fusible_type(code)) return;
+  int64_t bits = 0;
+  std::memcpy(&bits, value.ptr(), value.size());
+  recorder().constants[key] = {code, bits};
+}
+
+void forget_deferred(const void* key) {
+  auto& r = recorder();
+  std::lock_guard<std::recursive_mutex> lock(r.mutex);
+  r.constants.erase(key);
+  r.leaf_of.erase(key);
+  auto it = r.node_of.find(key);
+  if (it == r.node_of.end()) return;
+  auto& targets = r.nodes[it->second].targets;
+  targets.erase(std::remove_if(targets.begin(), targets.end(),
+                               [&](const auto& t) { return t.first == key; }),
+                targets.end());
+  r.node_of.erase(it);
+}
+
+void flush_deferred() {
+  auto& r = recorder();
+  std::lock_guard<std::recursive_mutex> lock(r.mutex);
+  if (r.nodes.empty()) return;
+  const auto nodes = std::move(r.nodes);
+  const auto leaves = std::move(r.leaves);
+  const auto const_bits = std::move(r.const_bits);
+  r.nodes.clear();
+  r.leaves.clear();
+  r.const_bits.clear();
+  r.node_of.clear();
+  r.leaf_of.clear();
+  r.const_of.clear();
+  r.cse.clear();
+
+  // Dead temporaries: a value is computed only if some live array holds it
+  // or a computed value reads it.
+  const auto n = static_cast<int32_t>(nodes.size());
+  std::vector<bool> needed(n, false);
+  for (int32_t i = n - 1; i >= 0; --i) {
+    if (!nodes[i].targets.empty()) needed[i] = true;
+    if (!needed[i]) continue;
+    for (const auto& arg : nodes[i].args)
+      if (arg.kind == OPERAND_NODE && arg.index >= 0) needed[arg.index] = true;
+  }
+
+  // Subgraphs: nodes joined by a value or a leaf they share.
+  std::vector<int32_t> parent(n);
+  for (int32_t i = 0; i < n; ++i) parent[i] = i;
+  std::vector<int32_t> leaf_owner(leaves.size(), -1);
+  for (int32_t i = 0; i < n; ++i) {
+    if (!needed[i]) continue;
+    const int32_t nargs = nodes[i].op == EXPR_BINARY ? 2 : 1;
+    for (int32_t k = 0; k < nargs; ++k) {
+      const auto& arg = nodes[i].args[k];
+      int32_t other = -1;
+      if (arg.kind == OPERAND_NODE) {
+        other = arg.index;
+      } else if (arg.kind == OPERAND_LEAF) {
+        if (leaf_owner[arg.index] < 0) leaf_owner[arg.index] = i;
+        other = leaf_owner[arg.index];
+      }
+      if (other >= 0) parent[find(parent, i)] = find(parent, other);
+    }
+  }
+  std::map<int32_t, std::vector<int32_t>> groups;
+  for (int32_t i = 0; i < n; ++i)
+    if (needed[i]) groups[find(parent, i)].push_back(i);
+  for (const auto& group : groups)
+    launch(nodes, leaves, const_bits, group.second);
+}
+
+void flush_deferred_for(const void* key) {
+  std::lock_guard<std::recursive_mutex> lock(recorder().mutex);
+  if (pending(key)) flush_deferred();
+}
+
+uint64_t fused_expr_launches() {
+  auto& r = recorder();
+  std::lock_guard<std::recursive_mutex> lock(r.mutex);
+  return r.launches;
+}
+
+}  // namespace tasks
@@ -0,0 +1,470 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahhal <naderrahhal2026@u.northwestern.edu>
+ */
+
+#include "factor.h"
+
+#include <cblas.h>
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace tasks {
+namespace {
+
+// Columns per panel. The panel is factored element by element and everything
+// to its right/below is updated with one BLAS-3 call.
+constexpr int64_t NB = 64;
+
+template <typename T>
+struct Blas;
+
+template <>
+struct Blas<float> {
+  static void gemm(CBLAS_TRANSPOSE ta, CBLAS_TRANSPOSE tb, int m, int n, int k,
+                   float alpha, const float* a, int lda, const float* b,
+                   int ldb, float beta, float* c, int ldc) {
+    cblas_sgemm(CblasRowMajor, ta, tb, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                ldc);
+  }
+  static void trsm(CBLAS_SIDE side, CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans,
+                   CBLAS_DIAG diag, int m, int n, const float* a, int lda,
+                   float* b, int ldb) {
+    cblas_strsm(CblasRowMajor, side, uplo, trans, diag, m, n, 1.0f, a, lda, b,
+                ldb);
+  }
+  // c -= a a^T on the lower triangle.
+  static void downdate(int n, int k, const float* a, int lda, float* c,
+                       int ldc) {
+    cblas_ssyrk(CblasRowMajor, CblasLower, CblasNoTrans, n, k, -1.0f, a, lda,
+                1.0f, c, ldc);
+  }
+};
+
+template <>
+struct Blas<double> {
+  static void gemm(CBLAS_TRANSPOSE ta, CBLAS_TRANSPOSE tb, int m, int n, int k,
+                   double alpha, const double* a, int lda, const double* b,
+                   int ldb, double beta, double* c, int ldc) {
+    cblas_dgemm(CblasRowMajor, ta, tb, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                ldc);
+  }
+  static void trsm(CBLAS_SIDE side, CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans,
+                   CBLAS_DIAG diag, int m, int n, const double* a, int lda,
+                   double* b, int ldb) {
+    cblas_dtrsm(CblasRowMajor, side, uplo, trans, diag, m, n, 1.0, a, lda, b,
+                ldb);
+  }
+  static void downdate(int n, int k, const double* a, int lda, double* c,
+                       int ldc) {
+    cblas_dsyrk(CblasRowMajor, CblasLower, CblasNoTrans, n, k, -1.0, a, lda,
+                1.0, c, ldc);
+  }
+};
+
+template <>
+struct Blas<std::complex<float>> {
+  using T = std::complex<float>;
+  static void gemm(CBLAS_TRANSPOSE ta, CBLAS_TRANSPOSE tb, int m, int n, int k,
+                   T alpha, const T* a, int lda, const T* b, int ldb, T beta,
+                   T* c, int ldc) {
+    cblas_cgemm(CblasRowMajor, ta, tb, m, n, k, &alpha, a, lda, b, ldb, &beta,
+                c, ldc);
+  }
+  static void trsm(CBLAS_SIDE side, CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans,
+                   CBLAS_DIAG diag, int m, int n, const T* a, int lda, T* b,
+                   int ldb) {
+    const T one{1.0f, 0.0f};
+    cblas_ctrsm(CblasRowMajor, side, uplo, trans, diag, m, n, &one, a, lda, b,
+                ldb);
+  }
+  // c -= a a^H on the lower triangle.
+  static void downdate(int n, int k, const T* a, int lda, T* c, int ldc) {
+    cblas_cherk(CblasRowMajor, CblasLower, CblasNoTrans, n, k, -1.0f, a, lda,
+                1.0f, c, ldc);
+  }
+};
+
+template <>
+struct Blas<std::complex<double>> {
+  using T = std::complex<double>;
+  static void gemm(CBLAS_TRANSPOSE ta, CBLAS_TRANSPOSE tb, int m, int n, int k,
+                   T alpha, const T* a, int lda, const T* b, int ldb, T beta,
+                   T* c, int ldc) {
+    cblas_zgemm(CblasRowMajor, ta, tb, m, n, k, &alpha, a, lda, b, ldb, &beta,
+                c, ldc);
+  }
+  static void trsm(CBLAS_SIDE side, CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans,
+                   CBLAS_DIAG diag, int m, int n, const T* a, int lda, T* b,
+                   int ldb) {
+    const T one{1.0, 0.0};
+    cblas_ztrsm(CblasRowMajor, side, uplo, trans, diag, m, n, &one, a, lda, b,
+                ldb);
+  }
+  static void downdate(int n, int k, const T* a, int lda, T* c, int ldc) {
+    cblas_zherk(CblasRowMajor, CblasLower, CblasNoTrans, n, k, -1.0, a, lda,
+                1.0, c, ldc);
+  }
+};
+
+template <typename T>
+constexpr bool IS_COMPLEX = !std::is_floating_point_v<T>;
+
+template <typename T>
+T conj_of(T v) {
+  if constexpr (IS_COMPLEX<T>) {
+    return std::conj(v);
+  } else {
+    return v;
+  }
+}
+
+// Lower Cholesky of the row-major n x n matrix `a` in place, A = L L^H; the
+// strict upper triangle is zeroed. Returns 0, or like LAPACK potrf the order
+// of the first leading minor that is not positive definite.
+template <typename T>
+int32_t potrf(T* a, int64_t n) {
+  for (int64_t k0 = 0; k0 < n; k0 += NB) {
+    const int64_t kb = std::min(NB, n - k0);
+    // Earlier panels are already folded into this block by their downdates.
+    for (int64_t j = k0; j < k0 + kb; ++j) {
+      T* rj = a + j * n;
+      auto d = std::real(rj[j]);
+      for (int64_t p = k0; p < j; ++p) d -= std::norm(rj[p]);
+      if (!(d > 0)) return static_cast<int32_t>(j + 1);  // also catches NaN
+      const auto djj = std::sqrt(d);
+      rj[j] = T(djj);
+      for (int64_t i = j + 1; i < k0 + kb; ++i) {
+        T* ri = a + i * n;
+        T s = ri[j];
+        for (int64_t p = k0; p < j; ++p) s -= ri[p] * conj_of(rj[p]);
+        ri[j] = s / djj;
+      }
+    }
+    const int64_t rest = n - k0 - kb;
+    if (rest == 0) break;
+    const T* a11 = a + k0 * n + k0;
+    T* a21 = a + (k0 + kb) * n + k0;
+    T* a22 = a + (k0 + kb) * n + k0 + kb;
+    Blas<T>::trsm(CblasRight, CblasLower, CblasConjTrans, CblasNonUnit,
+                  static_cast<int>(rest), static_cast<int>(kb), a11,
+                  static_cast<int>(n), a21, static_cast<int>(n));
+    Blas<T>::downdate(static_cast<int>(rest), static_cast<int>(kb), a21,
+                      static_cast<int>(n), a22, static_cast<int>(n));
+  }
+  for (int64_t i = 0; i < n; ++i)
+    std::fill(a + i * n + i + 1, a + (i + 1) * n, T(0));
+  return 0;
+}
+
+// LU with partial pivoting of the row-major m x n matrix `a` in place, as
+// LAPACK getrf: piv[j] is the 1-based row swapped with row j. Returns 0 or
+// the 1-based index of the first exactly zero pivot; the factorization is
+// still completed in that case.
+template <typename T>
+int32_t getrf(T* a, int64_t m, int64_t n, int32_t* piv) {
+  const int64_t k = std::min(m, n);
+  int32_t info = 0;
+  for (int64_t k0 = 0; k0 < k; k0 += NB) {
+    const int64_t kb = std::min(NB, k - k0);
+    for (int64_t j = k0; j < k0 + kb; ++j) {
+      int64_t p = j;
+      for (int64_t i = j + 1; i < m; ++i)
+        if (std::abs(a[i * n + j]) > std::abs(a[p * n + j])) p = i;
+      piv[j] = static_cast<int32_t>(p + 1);
+      if (a[p * n + j] == T(0)) {  // the column below is zero already
+        if (info == 0) info = static_cast<int32_t>(j + 1);
+        continue;
+      }
+      // Whole rows are swapped, so the blocks right of the panel are
+      // already permuted when the trailing update reads them.
+      if (p != j) std::swap_ranges(a + j * n, a + (j + 1) * n, a + p * n);
+      const T* rj = a + j * n;
+      for (int64_t i = j + 1; i < m; ++i) {
+        T* ri = a + i * n;
+        ri[j] /= rj[j];
+        for (int64_t c = j + 1; c < k0 + kb; ++c) ri[c] -= ri[j] * rj[c];
+      }
+    }
+    const int64_t right = n - k0 - kb;
+    const int64_t below = m - k0 - kb;
+    if (right == 0) continue;
+    const T* a11 = a + k0 * n + k0;
+    T* a12 = a + k0 * n + k0 + kb;
+    Blas<T>::trsm(CblasLeft, CblasLower, CblasNoTrans, CblasUnit,
+                  static_cast<int>(kb), static_cast<int>(right), a11,
+                  static_cast<int>(n), a12, static_cast<int>(n));
+    if (below == 0) continue;
+    Blas<T>::gemm(CblasNoTrans, CblasNoTrans, static_cast<int>(below),
+                  static_cast<int>(right), static_cast<int>(kb), T(-1),
+                  a + (k0 + kb) * n + k0, static_cast<int>(n), a12,
+                  static_cast<int>(n), T(1), a + (k0 + kb) * n + k0 + kb,
+                  static_cast<int>(n));
+  }
+  return info;
+}
+
+// Solves op(A) X = B in place of the row-major n x k matrix `b`, after
+// applying `piv` (1-based, `npiv` entries) to its rows when given.
+template <typename T>
+void trsm(const T* a, T* b, int64_t n, int64_t k, int32_t flags,
+          const int32_t* piv, int64_t npiv) {
+  for (int64_t j = 0; j < npiv; ++j) {
+    const int64_t p = piv[j] - 1;
+    if (p != j) std::swap_ranges(b + j * k, b + (j + 1) * k, b + p * k);
+  }
+  if (n == 0 || k == 0) return;
+  Blas<T>::trsm(CblasLeft, (flags & TRSM_LOWER) ? CblasLower : CblasUpper,
+                (flags & TRSM_ADJOINT) ? CblasConjTrans : CblasNoTrans,
+                (flags & TRSM_UNIT) ? CblasUnit : CblasNonUnit,
+                static_cast<int>(n), static_cast<int>(k), a,
+                static_cast<int>(n), b, static_cast<int>(k));
+}
+
+template <int DIM>
+int64_t extent(const legate::Rect<DIM>& rect, int d) {
+  return rect.hi[d] - rect.lo[d] + 1;
+}
+
+// One point per matrix of the tile, at the matrix's first element.
+template <int DIM>
+std::vector<legate::Point<DIM>> batch_points(legate::Rect<DIM> rect) {
+  rect.hi[DIM - 2] = rect.lo[DIM - 2];
+  rect.hi[DIM - 1] = rect.lo[DIM - 1];
+  std::vector<legate::Point<DIM>> points;
+  for (legate::PointInRectIterator<DIM> it(rect); it.valid(); ++it)
+    points.push_back(*it);
+  return points;
+}
+
+// `p` moved to the first matrix element of a store tiled like the input.
+template <int DIM>
+legate::Point<DIM> corner(legate::Point<DIM> p, const legate::Rect<DIM>& r) {
+  p[DIM - 2] = r.lo[DIM - 2];
+  p[DIM - 1] = r.lo[DIM - 1];
+  return p;
+}
+
+// Matrices are copied into row-major scratch: factorizations are O(n^3) and
+// the copy makes any tile layout (including transposed views) BLAS-ready.
+template <typename T, int DIM, typename Acc>
+void gather(const Acc& acc, legate::Point<DIM> p, int64_t rows, int64_t cols,
+            T* out) {
+  const auto r0 = p[DIM - 2];
+  const auto c0 = p[DIM - 1];
+  for (int64_t i = 0; i < rows; ++i) {
+    p[DIM - 2] = r0 + i;
+    for (int64_t j = 0; j < cols; ++j) {
+      p[DIM - 1] = c0 + j;
+      out[i * cols + j] = acc[p];
+    }
+  }
+}
+
+template <typename T, int DIM, typename Acc>
+void scatter(const Acc& acc, legate::Point<DIM> p, int64_t rows, int64_t cols,
+             const T* in) {
+  const auto r0 = p[DIM - 2];
+  const auto c0 = p[DIM - 1];
+  for (int64_t i = 0; i < rows; ++i) {
+    p[DIM - 2] = r0 + i;
+    for (int64_t j = 0; j < cols; ++j) {
+      p[DIM - 1] = c0 + j;
+      acc[p] = in[i * cols + j];
+    }
+  }
+}
+
+template <typename F>
+void for_each_matrix(int64_t count, bool openmp, F&& f) {
+  if (openmp) {
+#pragma omp parallel for schedule(dynamic)
+    for (int64_t i = 0; i < count; ++i) f(i);
+  } else {
+    for (int64_t i = 0; i < count; ++i) f(i);
+  }
+}
+
+template <typename T>
+struct PotrfFn {
+  template <int DIM>
+  void operator()(legate::TaskContext& context, bool openmp) {
+    if constexpr (DIM >= 2) {
+      auto a = context.input(0).data();
+      auto l = context.output(0).data();
+      auto info = context.output(1).data();
+      const auto rect = a.shape<DIM>();
+      if (rect.empty()) return;
+      const auto info_rect = info.shape<DIM>();
+      const int64_t n = extent(rect, DIM - 1);
+      auto a_acc = a.read_accessor<T, DIM>(rect);
+      auto l_acc = l.write_accessor<T, DIM>(rect);
+      auto info_acc = info.write_accessor<int32_t, DIM>(info_rect);
+      const auto points = batch_points(rect);
+      for_each_matrix(static_cast<int64_t>(points.size()), openmp,
+                      [&](int64_t i) {
+                        std::vector<T> m(n * n);
+                        gather(a_acc, points[i], n, n, m.data());
+                        const int32_t status = potrf(m.data(), n);
+                        scatter(l_acc, points[i], n, n, m.data());
+                        info_acc[corner(points[i], info_rect)] = status;
+                      });
+    }
+  }
+};
+
+template <typename T>
+struct GetrfFn {
+  template <int DIM>
+  void operator()(legate::TaskContext& context, bool openmp) {
+    if constexpr (DIM >= 2) {
+      auto a = context.input(0).data();
+      auto lu = context.output(0).data();
+      auto piv = context.output(1).data();
+      auto info = context.output(2).data();
+      const auto rect = a.shape<DIM>();
+      if (rect.empty()) return;
+      const auto piv_rect = piv.shape<DIM>();
+      const auto info_rect = info.shape<DIM>();
+      const int64_t rows = extent(rect, DIM - 2);
+      const int64_t cols = extent(rect, DIM - 1);
+      const int64_t k = std::min(rows, cols);
+      auto a_acc = a.read_accessor<T, DIM>(rect);
+      auto lu_acc = lu.write_accessor<T, DIM>(rect);
+      auto piv_acc = piv.write_accessor<int32_t, DIM>(piv_rect);
+      auto info_acc = info.write_accessor<int32_t, DIM>(info_rect);
+      const auto points = batch_points(rect);
+      for_each_matrix(static_cast<int64_t>(points.size()), openmp,
+                      [&](int64_t i) {
+                        std::vector<T> m(rows * cols);
+                        std::vector<int32_t> swaps(k);
+                        gather(a_acc, points[i], rows, cols, m.data());
+                        const int32_t status =
+                            getrf(m.data(), rows, cols, swaps.data());
+                        scatter(lu_acc, points[i], rows, cols, m.data());
+                        scatter(piv_acc, corner(points[i], piv_rect), 1, k,
+                                swaps.data());
+                        info_acc[corner(points[i], info_rect)] = status;
+                      });
+    }
+  }
+};
+
+template <typename T>
+struct TrsmFn {
+  template <int DIM>
+  void operator()(legate::TaskContext& context, bool openmp) {
+    if constexpr (DIM >= 2) {
+      auto a = context.input(0).data();
+      auto b = context.input(1).data();
+      auto x = context.output(0).data();
+      const int32_t flags = context.scalar(0).value<int32_t>();
+      const bool pivoted = context.num_inputs() > 2;
+      const auto rect = x.shape<DIM>();
+      if (rect.empty()) return;
+      const auto a_rect = a.shape<DIM>();
+      const int64_t n = extent(rect, DIM - 2);
+      const int64_t k = extent(rect, DIM - 1);
+      auto a_acc = a.read_accessor<T, DIM>(a_rect);
+      auto b_acc = b.read_accessor<T, DIM>(b.shape<DIM>());
+      auto x_acc = x.write_accessor<T, DIM>(rect);
+      std::optional<legate::AccessorRO<int32_t, DIM>> piv_acc;
+      legate::Rect<DIM> piv_rect;
+      int64_t npiv = 0;
+      if (pivoted) {
+        auto piv = context.input(2).data();
+        piv_rect = piv.shape<DIM>();
+        npiv = extent(piv_rect, DIM - 1);
+        piv_acc = piv.read_accessor<int32_t, DIM>(piv_rect);
+      }
+      const auto points = batch_points(rect);
+      for_each_matrix(
+          static_cast<int64_t>(points.size()), openmp, [&](int64_t i) {
+            std::vector<T> tri(n * n);
+            std::vector<T> rhs(n * k);
+            std::vector<int32_t> swaps(npiv);
+            gather(a_acc, corner(points[i], a_rect), n, n, tri.data());
+            gather(b_acc, points[i], n, k, rhs.data());
+            if (pivoted)
+              gather(*piv_acc, corner(points[i], piv_rect), 1, npiv,
+                     swaps.data());
+            trsm(tri.data(), rhs.data(), n, k, flags, swaps.data(), npiv);
+            scatter(x_acc, points[i], n, k, rhs.data());
+          });
+    }
+  }
+};
+
+template <template <typename> class Fn>
+void solver_variant(legate::TaskContext& context, bool openmp) {
+  const auto& input = context.input(0);
+  const int32_t dim = input.dim();
+  switch (input.type().code()) {
+    case legate::Type::Code::FLOAT32:
+      legate::dim_dispatch(dim, Fn<float>{}, context, openmp);
+      break;
+    case legate::Type::Code::FLOAT64:
+      legate::dim_dispatch(dim, Fn<double>{}, context, openmp);
+      break;
+    case legate::Type::Code::COMPLEX64:
+      legate::dim_dispatch(dim, Fn<std::complex<float>>{}, context, openmp);
+      break;
+    case legate::Type::Code::COMPLEX128:
+      legate::dim_dispatch(dim, Fn<std::complex<double>>{}, context, openmp);
+      break;
+    default:
+      throw std::invalid_argument("linalg: unsupported type");
+  }
+}
+
+}  // namespace
+
+void PotrfTask::cpu_variant(legate::TaskContext context) {
+  solver_variant<PotrfFn>(context, false);
+}
+
+void GetrfTask::cpu_variant(legate::TaskContext context) {
+  solver_variant<GetrfFn>(context, false);
+}
+
+void TrsmTask::cpu_variant(legate::TaskContext context) {
+  solver_variant<TrsmFn>(context, false);
+}
+
+#if LEGATE_DEFINED(LEGATE_USE_OPENMP)
+void PotrfTask::omp_variant(legate::TaskContext context) {
+  solver_variant<PotrfFn>(context, true);
+}
+
+void GetrfTask::omp_variant(legate::TaskContext context) {
+  solver_variant<GetrfFn>(context, true);
+}
+
+void TrsmTask::omp_variant(legate::TaskContext context) {
+  solver_variant<TrsmFn>(context, true);
+}
+#endif
+
+}  // namespace tasks
@@ -0,0 +1,563 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahhal <naderrahhal2026@u.northwestern.edu>
+ */
+
+#include "fft.h"
+
+#include <cupynumeric.h>
+#include <cupynumeric/runtime.h>
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace tasks {
+namespace {
+
+constexpr double PI = 3.14159265358979323846;
+constexpr std::size_t PLAN_CACHE_CAPACITY = 64;
+
+// std::complex's operator* guards against inf/nan combinations, which keeps
+// the butterflies from vectorizing.
+template <typename R>
+std::complex<R> mul(std::complex<R> a, std::complex<R> b) {
+  return {a.real() * b.real() - a.imag() * b.imag(),
+          a.real() * b.imag() + a.imag() * b.real()};
+}
+
+// Transform of one length, forward (exp(-2 pi i jk / n)) or inverse
+// (unscaled). Powers of two use an iterative radix-2 FFT; other lengths go
+// through Bluestein's chirp-z algorithm on a power of two of at least
+// 2n - 1, so every length is O(n log n).
+template <typename R>
+class LinePlan {
+ public:
+  using C = std::complex<R>;
+
+  LinePlan(int64_t n, bool inverse) : n_(n) {
+    if ((n & (n - 1)) == 0) {
+      init_radix2(n, inverse);
+      return;
+    }
+    int64_t m = 1;
+    while (m < 2 * n - 1) m <<= 1;
+    init_radix2(m, false);
+    const double sign = inverse ? 1.0 : -1.0;
+    chirp_.resize(n);
+    for (int64_t k = 0; k < n; ++k) {
+      // k^2 mod 2n keeps the angle accurate for large k.
+      const auto k2 = static_cast<double>((k * k) % (2 * n));
+      const double angle = sign * PI * k2 / static_cast<double>(n);
+      chirp_[k] = C(static_cast<R>(std::cos(angle)),
+                    static_cast<R>(std::sin(angle)));
+    }
+    filter_.assign(m, C(0));
+    filter_[0] = std::conj(chirp_[0]);
+    for (int64_t k = 1; k < n; ++k)
+      filter_[k] = filter_[m - k] = std::conj(chirp_[k]);
+    radix2(filter_.data());
+  }
+
+  int64_t length() const { return n_; }
+  // Elements of scratch `execute` needs besides the line itself.
+  int64_t scratch_size() const { return chirp_.empty() ? 0 : m_; }
+
+  void execute(C* line, C* scratch) const {
+    if (chirp_.empty()) {
+      radix2(line);
+      return;
+    }
+    // X[k] = w[k] sum_j (x[j] w[j]) conj(w[k - j]): a circular convolution
+    // done as two power-of-two FFTs, the second as conj(FFT(conj(.))).
+    for (int64_t j = 0; j < n_; ++j) scratch[j] = mul(line[j], chirp_[j]);
+    std::fill(scratch + n_, scratch + m_, C(0));
+    radix2(scratch);
+    for (int64_t j = 0; j < m_; ++j)
+      scratch[j] = std::conj(mul(scratch[j], filter_[j]));
+    radix2(scratch);
+    const R scale = R(1) / static_cast<R>(m_);
+    for (int64_t k = 0; k < n_; ++k)
+      line[k] = mul(std::conj(scratch[k]) * scale, chirp_[k]);
+  }
+
+ private:
+  void init_radix2(int64_t m, bool inverse) {
+    m_ = m;
+    int bits = 0;
+    while ((int64_t{1} << bits) < m) ++bits;
+    rev_.resize(m);
+    for (int64_t i = 0; i < m; ++i) {
+      int64_t r = 0;
+      for (int b = 0; b < bits; ++b) r |= ((i >> b) & 1) << (bits - 1 - b);
+      rev_[i] = r;
+    }
+    const double sign = inverse ? 1.0 : -1.0;
+    twiddle_.resize(m / 2);
+    for (int64_t k = 0; k < m / 2; ++k) {
+      const double angle = sign * 2.0 * PI * static_cast<double>(k) /
+                           static_cast<double>(m);
+      twiddle_[k] = C(static_cast<R>(std::cos(angle)),
+                      static_cast<R>(std::sin(angle)));
+    }
+  }
+
+  void radix2(C* a) const {
+    for (int64_t i = 0; i < m_; ++i)
+      if (i < rev_[i]) std::swap(a[i], a[rev_[i]]);
+    for (int64_t len = 2; len <= m_; len <<= 1) {
+      const int64_t half = len / 2;
+      const int64_t step = m_ / len;
+      for (int64_t i = 0; i < m_; i += len) {
+        for (int64_t j = 0; j < half; ++j) {
+          const C u = a[i + j];
+          const C v = mul(a[i + j + half], twiddle_[j * step]);
+          a[i + j] = u + v;
+          a[i + j + half] = u - v;
+        }
+      }
+    }
+  }
+
+  int64_t n_;
+  int64_t m_ = 1;
+  std::vector<int64_t> rev_;
+  std::vector<C> twiddle_;
+  std::vector<C> chirp_;   // Bluestein only
+  std::vector<C> filter_;  // FFT of the conjugate chirp, length m_
+};
+
+// One line plan per transformed axis, shared between equal lengths.
+template <typename R>
+struct AxesPlan {
+  std::vector<std::shared_ptr<const LinePlan<R>>> lines;
+};
+
+// kind, precision (sizeof(R)), axes, transformed lengths, inverse.
+using PlanKey = std::tuple<int32_t, int32_t, std::vector<int32_t>,
+                           std::vector<int64_t>, bool>;
+
+struct PlanCache {
+  // The key's precision decides which AxesPlan a value points to.
+  using Entry = std::pair<PlanKey, std::shared_ptr<const void>>;
+  std::mutex mutex;
+  // Most recently used first.
+  std::list<Entry> entries;
+  std::map<PlanKey, std::list<Entry>::iterator> index;
+  FftPlanCacheStats stats{0, 0, 0, 0};
+
+  void insert(const PlanKey& key, std::shared_ptr<const void> plan) {
+    entries.emplace_front(key, std::move(plan));
+    index[key] = entries.begin();
+    while (entries.size() > PLAN_CACHE_CAPACITY) {
+      index.erase(entries.back().first);
+      entries.pop_back();
+      ++stats.evictions;
+    }
+    stats.size = entries.size();
+  }
+};
+
+PlanCache& plan_cache() {
+  static PlanCache c;
+  return c;
+}
+
+template <typename R>
+std::shared_ptr<const AxesPlan<R>> find_plan(
+    FftKind kind, const std::vector<int32_t>& axes,
+    const std::vector<int64_t>& lengths, bool inverse) {
+  PlanKey key{kind, static_cast<int32_t>(sizeof(R)), axes, lengths, inverse};
+  auto& cache = plan_cache();
+  {
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    auto it = cache.index.find(key);
+    if (it != cache.index.end()) {
+      ++cache.stats.hits;
+      cache.entries.splice(cache.entries.begin(), cache.entries, it->second);
+      return std::static_pointer_cast<const AxesPlan<R>>(it->second->second);
+    }
+  }
+
+  // Planning runs outside the lock. Point tasks racing on a new key each
+  // build it; the first one stored wins and counts as the miss.
+  auto plan = std::make_shared<AxesPlan<R>>();
+  for (std::size_t i = 0; i < lengths.size(); ++i) {
+    std::shared_ptr<const LinePlan<R>> line;
+    for (std::size_t j = 0; j < i && !line; ++j)
+      if (lengths[j] == lengths[i]) line = plan->lines[j];
+    if (!line) line = std::make_shared<const LinePlan<R>>(lengths[i], inverse);
+    plan->lines.push_back(std::move(line));
+  }
+
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  auto it = cache.index.find(key);
+  if (it != cache.index.end()) {
+    ++cache.stats.hits;
+    return std::static_pointer_cast<const AxesPlan<R>>(it->second->second);
+  }
+  ++cache.stats.misses;
+  cache.insert(key, plan);
+  return plan;
+}
+
+enum class LineMode {
+  FULL,    // n in, n out
+  HALVE,   // n in, n / 2 + 1 out (real input)
+  EXPAND,  // n / 2 + 1 in, completed by Hermitian symmetry, n out
+};
+
+// Transforms every line of the row-major `src` along `axis`. `dst` has the
+// extents of `src` except along `axis`, and may be `src` for LineMode::FULL.
+template <typename R>
+void transform_axis(const std::complex<R>* src, std::complex<R>* dst,
+                    const std::vector<int64_t>& extents, int32_t axis,
+                    const LinePlan<R>& plan, LineMode mode, bool openmp) {
+  using C = std::complex<R>;
+  const int64_t n = plan.length();
+  const int64_t src_len = extents[axis];
+  const int64_t dst_len = mode == LineMode::HALVE ? n / 2 + 1 : n;
+  int64_t outer = 1;
+  int64_t stride = 1;
+  for (int32_t d = 0; d < axis; ++d) outer *= extents[d];
+  for (std::size_t d = axis + 1; d < extents.size(); ++d) stride *= extents[d];
+  const int64_t count = outer * stride;
+
+#pragma omp parallel if (openmp)
+  {
+    std::vector<C> line(n);
+    std::vector<C> scratch(plan.scratch_size());
+#pragma omp for schedule(static)
+    for (int64_t l = 0; l < count; ++l) {
+      const int64_t o = l / stride;
+      const int64_t i = l % stride;
+      const C* in = src + o * src_len * stride + i;
+      C* out = dst + o * dst_len * stride + i;
+      for (int64_t k = 0; k < src_len; ++k) line[k] = in[k * stride];
+      if (mode == LineMode::EXPAND)
+        for (int64_t k = src_len; k < n; ++k) line[k] = std::conj(line[n - k]);
+      plan.execute(line.data(), scratch.data());
+      for (int64_t k = 0; k < dst_len; ++k) out[k * stride] = line[k];
+    }
+  }
+}
+
+template <typename T, typename C, int DIM>
+void load(const legate::PhysicalStore& store, const legate::Rect<DIM>& rect,
+          C* dst) {
+  auto acc = store.read_accessor<T, DIM>(rect);
+  for (legate::PointInRectIterator<DIM> it(rect, false); it.valid(); ++it)
+    *dst++ = static_cast<C>(acc[*it]);
+}
+
+template <typename R, int DIM>
+void store_real(const legate::PhysicalStore& store,
+                const legate::Rect<DIM>& rect, const std::complex<R>* src,
+                R scale) {
+  auto acc = store.write_accessor<R, DIM>(rect);
+  for (legate::PointInRectIterator<DIM> it(rect, false); it.valid(); ++it)
+    acc[*it] = (src++)->real() * scale;
+}
+
+template <typename R, int DIM>
+void store_complex(const legate::PhysicalStore& store,
+                   const legate::Rect<DIM>& rect, const std::complex<R>* src,
+                   R scale) {
+  auto acc = store.write_accessor<std::complex<R>, DIM>(rect);
+  for (legate::PointInRectIterator<DIM> it(rect, false); it.valid(); ++it)
+    acc[*it] = *src++ * scale;
+}
+
+template <int DIM>
+std::vector<int64_t> extents_of(const legate::Rect<DIM>& rect) {
+  std::vector<int64_t> extents(DIM);
+  for (int d = 0; d < DIM; ++d) extents[d] = rect.hi[d] - rect.lo[d] + 1;
+  return extents;
+}
+
+bool is_real(legate::Type::Code code) {
+  return code == legate::Type::Code::FLOAT32 ||
+         code == legate::Type::Code::FLOAT64;
+}
+
+template <typename R>
+struct FftFn {
+  template <int DIM>
+  void operator()(legate::TaskContext& context, bool openmp) const {
+    using C = std::complex<R>;
+    auto input = context.input(0).data();
+    auto output = context.output(0).data();
+    const auto kind = static_cast<FftKind>(context.scalar(0).value<int32_t>());
+    const auto axes_span = context.scalar(1).values<int32_t>();
+    const std::vector<int32_t> axes(axes_span.begin(), axes_span.end());
+    const bool inverse = context.scalar(2).value<bool>();
+
+    const auto in_rect = input.shape<DIM>();
+    const auto out_rect = output.shape<DIM>();
+    if (in_rect.empty() || out_rect.empty()) return;
+    const auto in_ext = extents_of(in_rect);
+    const auto out_ext = extents_of(out_rect);
+
+    std::vector<int64_t> lengths;
+    double volume = 1.0;
+    for (auto a : axes) {
+      lengths.push_back(kind == FFT_C2R ? out_ext[a] : in_ext[a]);
+      volume *= static_cast<double>(lengths.back());
+    }
+    const auto plan = find_plan<R>(kind, axes, lengths, inverse);
+    const auto& lines = plan->lines;
+
+    std::vector<C> work(in_rect.volume());
+    if (is_real(input.type().code()))
+      load<R>(input, in_rect, work.data());
+    else
+      load<C>(input, in_rect, work.data());
+
+    // The halved axis goes first for R2C, so the other axes see half the
+    // data, and last for C2R, which needs its input complete.
+    std::size_t first = 0, last = axes.size();
+    if (kind == FFT_R2C) {
+      std::vector<C> halved(out_rect.volume());
+      transform_axis(work.data(), halved.data(), in_ext, axes[0], *lines[0],
+                     LineMode::HALVE, openmp);
+      work.swap(halved);
+      first = 1;
+    } else if (kind == FFT_C2R) {
+      first = 1;
+    }
+    for (std::size_t i = first; i < last; ++i)
+      transform_axis(work.data(), work.data(),
+                     kind == FFT_R2C ? out_ext : in_ext, axes[i], *lines[i],
+                     LineMode::FULL, openmp);
+    if (kind == FFT_C2R) {
+      std::vector<C> full(out_rect.volume());
+      transform_axis(work.data(), full.data(), in_ext, axes[0], *lines[0],
+                     LineMode::EXPAND, openmp);
+      work.swap(full);
+    }
+
+    const R scale = inverse ? static_cast<R>(1.0 / volume) : R(1);
+    if (kind == FFT_C2R)
+      store_real(output, out_rect, work.data(), scale);
+    else
+      store_complex(output, out_rect, work.data(), scale);
+  }
+};
+
+void fft_variant(legate::TaskContext& context, bool openmp) {
+  const auto& output = context.output(0);
+  switch (output.type().code()) {
+    case legate::Type::Code::FLOAT32:
+    case legate::Type::Code::COMPLEX64:
+      legate::dim_dispatch(output.dim(), FftFn<float>{}, context, openmp);
+      break;
+    case legate::Type::Code::FLOAT64:
+    case legate::Type::Code::COMPLEX128:
+      legate::dim_dispatch(output.dim(), FftFn<double>{}, context, openmp);
+      break;
+    default:
+      throw std::invalid_argument("fft: unsupported type");
+  }
+}
+
+// Complex type of the same precision as `code`, NIL for non-float types.
+legate::Type::Code complex_of(legate::Type::Code code) {
+  switch (code) {
+    case legate::Type::Code::FLOAT32:
+    case legate::Type::Code::COMPLEX64:
+      return legate::Type::Code::COMPLEX64;
+    case legate::Type::Code::FLOAT64:
+    case legate::Type::Code::COMPLEX128:
+      return legate::Type::Code::COMPLEX128;
+    default:
+      return legate::Type::Code::NIL;
+  }
+}
+
+// Manual launch of `task_id` from `input` to `output`, tiled along the
+// longest axis not in `axes` so that every point task holds whole lines
+// along them. With every axis in `axes` it is a single point task.
+legate::ManualTask tiled_launch(legate::LocalTaskID task_id,
+                                const cupynumeric::NDArray& input,
+                                const cupynumeric::NDArray& output,
+                                const std::vector<int32_t>& axes) {
+  auto runtime = legate::Runtime::get_runtime();
+  auto library = cupynumeric::CuPyNumericRuntime::get_runtime()->get_library();
+  const uint64_t num_procs =
+      std::max<uint64_t>(1, runtime->get_machine().count());
+  const auto& in_shape = input.shape();
+  const auto& out_shape = output.shape();
+  const auto dim = static_cast<int32_t>(in_shape.size());
+
+  std::vector<uint64_t> in_tile(in_shape.begin(), in_shape.end());
+  std::vector<uint64_t> out_tile(out_shape.begin(), out_shape.end());
+  int32_t split = -1;
+  for (int32_t d = 0; d < dim; ++d)
+    if (std::find(axes.begin(), axes.end(), d) == axes.end() &&
+        (split < 0 || in_tile[d] > in_tile[split]))
+      split = d;
+  uint64_t num_tiles = 1;
+  if (split >= 0) {
+    const uint64_t extent = in_tile[split];
+    in_tile[split] = out_tile[split] = (extent + num_procs - 1) / num_procs;
+    num_tiles = (extent + in_tile[split] - 1) / in_tile[split];
+  } else {
+    split = 0;
+  }
+
+  std::vector<legate::SymbolicExpr> proj(dim, legate::constant(0));
+  proj[split] = legate::dimension(0);
+  const legate::SymbolicPoint projection{proj};
+  auto task =
+      runtime->create_task(library, task_id, legate::tuple<uint64_t>{num_tiles});
+  task.add_input(input.get_store().partition_by_tiling(in_tile), projection);
+  task.add_output(output.get_store().partition_by_tiling(out_tile),
+                  projection);
+  return task;
+}
+
+// One FftTask launch over `axes`.
+void host_pass(const cupynumeric::NDArray& input,
+               const cupynumeric::NDArray& output, FftKind kind,
+               const std::vector<int32_t>& axes, bool inverse) {
+  auto task =
+      tiled_launch(legate::LocalTaskID{FFT_TASK}, input, output, axes);
+  task.add_scalar_arg(legate::Scalar{static_cast<int32_t>(kind)});
+  task.add_scalar_arg(legate::Scalar{axes});
+  task.add_scalar_arg(legate::Scalar{inverse});
+  legate::Runtime::get_runtime()->submit(std::move(task));
+}
+
+}  // namespace
+
+/*static*/ void FftTask::cpu_variant(legate::TaskContext context) {
+  fft_variant(context, false);
+}
+
+#if LEGATE_DEFINED(LEGATE_USE_OPENMP)
+/*static*/ void FftTask::omp_variant(legate::TaskContext context) {
+  fft_variant(context, true);
+}
+#endif
+
+bool fft(const cupynumeric::NDArray& input, const cupynumeric::NDArray& output,
+         int32_t kind, const std::vector<int32_t>& axes, bool inverse) {
+  const int32_t dim = input.dim();
+  if (kind < FFT_C2C || kind > FFT_C2R) return false;
+  if (dim == 0 || output.dim() != dim || axes.empty()) return false;
+  std::vector<bool> seen(dim, false);
+  for (auto a : axes) {
+    if (a < 0 || a >= dim || seen[a]) return false;
+    seen[a] = true;
+  }
+
+  const auto in_code = input.type().code();
+  const auto out_code = output.type().code();
+  const auto complex_code = complex_of(in_code);
+  if (complex_code == legate::Type::Code::NIL) return false;
+  switch (kind) {
+    case FFT_C2C:
+      if (out_code != complex_code) return false;
+      break;
+    case FFT_R2C:
+      if (!is_real(in_code) || out_code != complex_code || inverse)
+        return false;
+      break;
+    case FFT_C2R:
+      if (is_real(in_code) || complex_of(out_code) != in_code ||
+          !is_real(out_code) || !inverse)
+        return false;
+      break;
+  }
+
+  const auto& in_shape = input.shape();
+  const auto& out_shape = output.shape();
+  for (int32_t d = 0; d < dim; ++d) {
+    if (kind != FFT_C2C && d == axes[0]) continue;
+    if (in_shape[d] != out_shape[d]) return false;
+  }
+  if (kind == FFT_R2C && out_shape[axes[0]] != in_shape[axes[0]] / 2 + 1)
+    return false;
+  if (kind == FFT_C2R && in_shape[axes[0]] != out_shape[axes[0]] / 2 + 1)
+    return false;
+  if (input.size() == 0 || output.size() == 0) return true;
+
+  // Each launch is tiled along an axis it does not transform. With every
+  // axis transformed, the transform is split into two passes so that both
+  // have one: all axes but the longest other than the halved one, then that
+  // axis on its own. Each pass scales by its own lengths when inverse.
+  std::vector<int32_t> rest;
+  for (int32_t d = 0; d < dim; ++d)
+    if (!seen[d]) rest.push_back(d);
+  if (!rest.empty() || dim == 1) {
+    host_pass(input, output, static_cast<FftKind>(kind), axes, inverse);
+    return true;
+  }
+  const auto& shape = kind == FFT_C2R ? out_shape : in_shape;
+  int32_t alone = -1;
+  for (int32_t d = 0; d < dim; ++d)
+    if ((kind == FFT_C2C || d != axes[0]) &&
+        (alone < 0 || shape[d] > shape[alone]))
+      alone = d;
+  std::vector<int32_t> others;
+  for (auto a : axes)
+    if (a != alone) others.push_back(a);
+
+  auto cn_runtime = cupynumeric::CuPyNumericRuntime::get_runtime();
+  const auto complex_type =
+      legate::primitive_type(kind == FFT_C2R ? in_code : complex_code);
+  if (kind == FFT_C2R) {
+    // The halved axis has to come last.
+    auto mid = cn_runtime->create_array(
+        std::vector<uint64_t>(in_shape.begin(), in_shape.end()), complex_type);
+    host_pass(input, mid, FFT_C2C, {alone}, inverse);
+    host_pass(mid, output, FFT_C2R, others, inverse);
+  } else {
+    auto mid = cn_runtime->create_array(
+        std::vector<uint64_t>(out_shape.begin(), out_shape.end()),
+        complex_type);
+    host_pass(input, mid, static_cast<FftKind>(kind), others, inverse);
+    host_pass(mid, output, FFT_C2C, {alone}, inverse);
+  }
+  return true;
+}
+
+FftPlanCacheStats fft_plan_cache_stats() {
+  auto& cache = plan_cache();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  return cache.stats;
+}
+
+void clear_fft_plan_cache() {
+  auto& cache = plan_cache();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  cache.entries.clear();
+  cache.index.clear();
+  cache.stats.size = 0;
+}
+
+}  // namespace tasks
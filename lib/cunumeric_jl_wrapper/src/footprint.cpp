@@ -0,0 +1,143 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahhal <naderrahhal2026@u.northwestern.edu>
+ */
+
+#include "footprint.h"
+
+#include <cupynumeric.h>
+#include <cupynumeric/runtime.h>
+#include <deps/realm/machine.h>
+#include <deps/realm/machine_impl.h>
+
+namespace tasks {
+namespace {
+
+// Each point task reports one row of spans, indexed by memory kind.
+enum FootprintSlot : uint64_t {
+  SLOT_SYSMEM,
+  SLOT_FBMEM,
+  SLOT_ZCMEM,
+  SLOT_SOCKETMEM,
+  NUM_SLOTS,
+};
+
+uint64_t slot_of(legate::mapping::StoreTarget target) {
+  switch (target) {
+    case legate::mapping::StoreTarget::FBMEM:
+      return SLOT_FBMEM;
+    case legate::mapping::StoreTarget::ZCMEM:
+      return SLOT_ZCMEM;
+    case legate::mapping::StoreTarget::SOCKETMEM:
+      return SLOT_SOCKETMEM;
+    default:
+      return SLOT_SYSMEM;
+  }
+}
+
+void footprint_variant(legate::TaskContext context) {
+  auto store = context.input(0).data();
+  auto out = context.output(0).data();
+  auto spans = out.create_output_buffer<uint64_t, 1>(
+      legate::Point<1>(NUM_SLOTS), true);
+  for (uint64_t i = 0; i < NUM_SLOTS; ++i) spans[i] = 0;
+
+  const auto domain = store.domain();
+  if (domain.get_volume() == 0) return;
+  // Byte span of the tile inside its instance: one element plus the
+  // distance to the last one along every dimension.
+  const auto alloc = store.get_inline_allocation();
+  uint64_t span = store.type().size();
+  for (int32_t d = 0; d < domain.get_dim(); ++d)
+    span += static_cast<uint64_t>(domain.hi()[d] - domain.lo()[d]) *
+            alloc.strides[d];
+  spans[slot_of(store.target())] = span;
+}
+
+uint64_t allocated_in(Realm::Memory::Kind kind) {
+  using Legion::Machine;
+  auto legion_runtime = Legion::Runtime::get_runtime();
+  auto ctx = Legion::Runtime::get_context();
+  Machine::MemoryQuery memories =
+      Machine::MemoryQuery(Machine::get_machine())
+          .only_kind(kind)
+          .local_address_space();
+  uint64_t bytes = 0;
+  for (auto it = memories.begin(); it != memories.end(); ++it)
+    bytes += it->capacity() - legion_runtime->query_available_memory(ctx, *it);
+  return bytes;
+}
+
+}  // namespace
+
+/*static*/ void FootprintTask::cpu_variant(legate::TaskContext context) {
+  footprint_variant(context);
+}
+
+#if LEGATE_DEFINED(LEGATE_USE_OPENMP)
+/*static*/ void FootprintTask::omp_variant(legate::TaskContext context) {
+  footprint_variant(context);
+}
+#endif
+
+#if LEGATE_DEFINED(LEGATE_USE_CUDA)
+/*static*/ void FootprintTask::gpu_variant(legate::TaskContext context) {
+  footprint_variant(context);
+}
+#endif
+
+Footprint physical_footprint(const cupynumeric::NDArray& arr) {
+  Footprint result{0, 0, 0, 0, 0};
+  auto store = arr.get_store();
+  if (store.has_scalar_storage()) {
+    result.scalar = arr.type().size();
+    return result;
+  }
+  if (arr.size() == 0) return result;
+
+  auto runtime = legate::Runtime::get_runtime();
+  auto library = cupynumeric::CuPyNumericRuntime::get_runtime()->get_library();
+  auto spans = runtime->create_store(legate::uint64(), 1);
+  auto task =
+      runtime->create_task(library, legate::LocalTaskID{FOOTPRINT_TASK});
+  task.add_input(store);
+  task.add_output(spans);
+  runtime->submit(std::move(task));
+
+  auto physical = spans.get_physical_store();
+  const auto shape = physical.shape<1>();
+  auto acc = physical.read_accessor<uint64_t, 1>(shape);
+  uint64_t* totals[NUM_SLOTS] = {&result.sysmem, &result.fbmem,
+                                 &result.zcmem, &result.socketmem};
+  for (int64_t i = shape.lo[0]; i <= shape.hi[0]; ++i)
+    *totals[static_cast<uint64_t>(i) % NUM_SLOTS] += acc[i];
+  return result;
+}
+
+Footprint allocated_footprint() {
+  Footprint result{0, 0, 0, 0, 0};
+  result.sysmem = allocated_in(Realm::Memory::SYSTEM_MEM);
+  result.socketmem = allocated_in(Realm::Memory::SOCKET_MEM);
+  result.zcmem = allocated_in(Realm::Memory::Z_COPY_MEM);
+#if LEGATE_DEFINED(LEGATE_USE_CUDA)
+  result.fbmem = allocated_in(Realm::Memory::GPU_FB_MEM);
+#endif
+  return result;
+}
+
+}  // namespace tasks
@@ -0,0 +1,617 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahhal <naderrahhal2026@u.northwestern.edu>
+ */
+
+#include "gemm.h"
+
+#include <cblas.h>
+#include <cupynumeric.h>
+#include <cupynumeric/runtime.h>
+
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "half.h"
+
+namespace tasks {
+namespace {
+
+template <typename T>
+struct Blas;
+
+template <>
+struct Blas<float> {
+  static void gemm(CBLAS_TRANSPOSE ta, CBLAS_TRANSPOSE tb, int m, int n, int k,
+                   float alpha, const float* a, int lda, const float* b,
+                   int ldb, float beta, float* c, int ldc) {
+    cblas_sgemm(CblasRowMajor, ta, tb, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                ldc);
+  }
+};
+
+template <>
+struct Blas<double> {
+  static void gemm(CBLAS_TRANSPOSE ta, CBLAS_TRANSPOSE tb, int m, int n, int k,
+                   double alpha, const double* a, int lda, const double* b,
+                   int ldb, double beta, double* c, int ldc) {
+    cblas_dgemm(CblasRowMajor, ta, tb, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                ldc);
+  }
+};
+
+template <>
+struct Blas<std::complex<float>> {
+  using T = std::complex<float>;
+  static void gemm(CBLAS_TRANSPOSE ta, CBLAS_TRANSPOSE tb, int m, int n, int k,
+                   T alpha, const T* a, int lda, const T* b, int ldb, T beta,
+                   T* c, int ldc) {
+    cblas_cgemm(CblasRowMajor, ta, tb, m, n, k, &alpha, a, lda, b, ldb, &beta,
+                c, ldc);
+  }
+};
+
+template <>
+struct Blas<std::complex<double>> {
+  using T = std::complex<double>;
+  static void gemm(CBLAS_TRANSPOSE ta, CBLAS_TRANSPOSE tb, int m, int n, int k,
+                   T alpha, const T* a, int lda, const T* b, int ldb, T beta,
+                   T* c, int ldc) {
+    cblas_zgemm(CblasRowMajor, ta, tb, m, n, k, &alpha, a, lda, b, ldb, &beta,
+                c, ldc);
+  }
+};
+
+// A (rows x cols) matrix inside a tile, described as a row-major BLAS operand.
+// Column-major slices (e.g. transposed views) are passed with CblasTrans
+// instead of being copied; anything else is packed into `packed`.
+template <typename T>
+struct Operand {
+  const T* ptr;
+  CBLAS_TRANSPOSE trans;
+  int ld;
+  std::vector<T> packed;
+};
+
+template <typename T>
+Operand<T> make_operand(const T* ptr, int64_t row_stride, int64_t col_stride,
+                        int64_t rows, int64_t cols) {
+  Operand<T> op{ptr, CblasNoTrans, 0, {}};
+  if (col_stride == 1 || cols == 1) {
+    op.ld = static_cast<int>(
+        std::max<int64_t>(rows == 1 ? cols : row_stride, 1));
+    if (op.ld >= cols) return op;
+  }
+  if (row_stride == 1 || rows == 1) {
+    op.trans = CblasTrans;
+    op.ld = static_cast<int>(
+        std::max<int64_t>(cols == 1 ? rows : col_stride, 1));
+    if (op.ld >= rows) return op;
+  }
+  op.packed.resize(rows * cols);
+  for (int64_t i = 0; i < rows; ++i)
+    for (int64_t j = 0; j < cols; ++j)
+      op.packed[i * cols + j] = ptr[i * row_stride + j * col_stride];
+  op.ptr = op.packed.data();
+  op.trans = CblasNoTrans;
+  op.ld = static_cast<int>(std::max<int64_t>(cols, 1));
+  return op;
+}
+
+// alpha and beta travel as complex doubles; real types use the real part.
+struct GemmArgs {
+  bool trans_a = false;
+  bool trans_b = false;
+  std::complex<double> alpha{1.0, 0.0};
+  std::complex<double> beta{0.0, 0.0};
+};
+
+template <typename T>
+T from_complex(std::complex<double> v) {
+  if constexpr (std::is_floating_point_v<T>) {
+    return static_cast<T>(v.real());
+  } else {
+    using R = typename T::value_type;
+    return T(static_cast<R>(v.real()), static_cast<R>(v.imag()));
+  }
+}
+
+template <typename T, int DIM, typename CAcc>
+void gemm_tile(const legate::PhysicalStore& a, const legate::PhysicalStore& b,
+               const legate::Rect<DIM>& c_rect, const CAcc& c_acc,
+               const GemmArgs& args, bool openmp) {
+  const auto a_rect = a.shape<DIM>();
+  const auto b_rect = b.shape<DIM>();
+  auto a_acc = a.read_accessor<T, DIM>(a_rect);
+  auto b_acc = b.read_accessor<T, DIM>(b_rect);
+
+  // Where the rows/cols of op(a) and op(b) live in the stored arrays.
+  const int a_row = args.trans_a ? DIM - 1 : DIM - 2;
+  const int a_col = args.trans_a ? DIM - 2 : DIM - 1;
+  const int b_row = args.trans_b ? DIM - 1 : DIM - 2;
+  const int b_col = args.trans_b ? DIM - 2 : DIM - 1;
+
+  const int64_t m = c_rect.hi[DIM - 2] - c_rect.lo[DIM - 2] + 1;
+  const int64_t n = c_rect.hi[DIM - 1] - c_rect.lo[DIM - 1] + 1;
+  const int64_t k = a_rect.hi[a_col] - a_rect.lo[a_col] + 1;
+  const T alpha = from_complex<T>(args.alpha);
+  const T beta = from_complex<T>(args.beta);
+
+  auto stride = [](const auto& acc, int d) {
+    return static_cast<int64_t>(acc.accessor.strides[d] / sizeof(T));
+  };
+
+  // Only the leading (batch) coordinates vary between matrices.
+  legate::Rect<DIM> batch = c_rect;
+  batch.hi[DIM - 2] = batch.lo[DIM - 2];
+  batch.hi[DIM - 1] = batch.lo[DIM - 1];
+  std::vector<legate::Point<DIM>> points;
+  for (legate::PointInRectIterator<DIM> it(batch); it.valid(); ++it)
+    points.push_back(*it);
+
+  // BLAS writes c row-major with unit column stride. Any other layout of the
+  // output (a transposed or strided `out`) goes through a packed scratch
+  // matrix that is copied back afterwards.
+  const int64_t c_row_stride = stride(c_acc, DIM - 2);
+  const int64_t c_col_stride = stride(c_acc, DIM - 1);
+  const bool c_direct = (c_col_stride == 1 || n == 1) &&
+                        (m == 1 || c_row_stride >= std::max<int64_t>(n, 1));
+  const int ld_n = static_cast<int>(std::max<int64_t>(n, 1));
+
+  auto multiply = [&](const legate::Point<DIM>& p) {
+    T* c_ptr = c_acc.ptr(p);
+    std::vector<T> packed_c;
+    int ldc = static_cast<int>(
+        std::max<int64_t>(m == 1 ? n : c_row_stride, 1));
+    if (!c_direct) {
+      packed_c.assign(m * n, T(0));
+      if (beta != T(0))
+        for (int64_t i = 0; i < m; ++i)
+          for (int64_t j = 0; j < n; ++j)
+            packed_c[i * n + j] = c_ptr[i * c_row_stride + j * c_col_stride];
+      ldc = ld_n;
+    }
+    T* c_out = c_direct ? c_ptr : packed_c.data();
+    auto unpack = [&]() {
+      if (c_direct) return;
+      for (int64_t i = 0; i < m; ++i)
+        for (int64_t j = 0; j < n; ++j)
+          c_ptr[i * c_row_stride + j * c_col_stride] = packed_c[i * n + j];
+    };
+
+    if (k == 0) {  // nothing to read from a or b; BLAS only scales c by beta
+      Blas<T>::gemm(CblasNoTrans, CblasNoTrans, m, n, 0, alpha, nullptr, 1,
+                    nullptr, ld_n, beta, c_out, ldc);
+      unpack();
+      return;
+    }
+    legate::Point<DIM> pa = p, pb = p;
+    pa[DIM - 2] = a_rect.lo[DIM - 2];
+    pa[DIM - 1] = a_rect.lo[DIM - 1];
+    pb[DIM - 2] = b_rect.lo[DIM - 2];
+    pb[DIM - 1] = b_rect.lo[DIM - 1];
+
+    // A transposed operand is just the stored matrix with its strides
+    // swapped; make_operand turns that back into a BLAS transpose flag.
+    auto op_a = make_operand(a_acc.ptr(pa), stride(a_acc, a_row),
+                             stride(a_acc, a_col), m, k);
+    auto op_b = make_operand(b_acc.ptr(pb), stride(b_acc, b_row),
+                             stride(b_acc, b_col), k, n);
+    Blas<T>::gemm(op_a.trans, op_b.trans, m, n, k, alpha, op_a.ptr, op_a.ld,
+                  op_b.ptr, op_b.ld, beta, c_out, ldc);
+    unpack();
+  };
+
+  const int64_t num_points = static_cast<int64_t>(points.size());
+  if (openmp) {
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < num_points; ++i) multiply(points[i]);
+  } else {
+    for (int64_t i = 0; i < num_points; ++i) multiply(points[i]);
+  }
+}
+
+template <typename T>
+struct GemmTileFn {
+  template <int DIM>
+  void operator()(legate::TaskContext& context, const GemmArgs& args,
+                  bool openmp) {
+    if constexpr (DIM >= 2) {
+      auto a = context.input(0).data();
+      auto b = context.input(1).data();
+      auto c = context.output(0).data();
+      const auto rect = c.shape<DIM>();
+      if (rect.empty()) return;
+      // With beta == 0 the launcher passes `c` write-only.
+      if (args.beta == 0.0) {
+        auto acc = c.write_accessor<T, DIM>(rect);
+        gemm_tile<T, DIM>(a, b, rect, acc, args, openmp);
+      } else {
+        auto acc = c.read_write_accessor<T, DIM>(rect);
+        gemm_tile<T, DIM>(a, b, rect, acc, args, openmp);
+      }
+    }
+  }
+};
+
+template <typename To, typename From>
+To convert_value(From v) {
+  if constexpr (std::is_same_v<From, Half>) {
+    return static_cast<To>(half_to_float(v));
+  } else if constexpr (std::is_same_v<To, Half>) {
+    return float_to_half(static_cast<float>(v));
+  } else {
+    return static_cast<To>(v);
+  }
+}
+
+template <typename T, typename Acc>
+int64_t elem_stride(const Acc& acc, int d) {
+  return static_cast<int64_t>(acc.accessor.strides[d] / sizeof(T));
+}
+
+// Mixed precision: a and b are stored as S, products are summed in ACC by a
+// BLAS call on widened copies, and the result is rounded once into O.
+template <typename S, typename O, typename ACC, int DIM, typename CAcc>
+void mixed_gemm_tile(const legate::PhysicalStore& a,
+                     const legate::PhysicalStore& b,
+                     const legate::Rect<DIM>& c_rect, const CAcc& c_acc,
+                     const GemmArgs& args, bool openmp) {
+  const auto a_rect = a.shape<DIM>();
+  const auto b_rect = b.shape<DIM>();
+  // Half has no legate type code, so skip the accessor type check.
+  auto a_acc = a.read_accessor<S, DIM, false>(a_rect);
+  auto b_acc = b.read_accessor<S, DIM, false>(b_rect);
+
+  const int a_row = args.trans_a ? DIM - 1 : DIM - 2;
+  const int a_col = args.trans_a ? DIM - 2 : DIM - 1;
+  const int b_row = args.trans_b ? DIM - 1 : DIM - 2;
+  const int b_col = args.trans_b ? DIM - 2 : DIM - 1;
+
+  const int64_t m = c_rect.hi[DIM - 2] - c_rect.lo[DIM - 2] + 1;
+  const int64_t n = c_rect.hi[DIM - 1] - c_rect.lo[DIM - 1] + 1;
+  const int64_t k = a_rect.hi[a_col] - a_rect.lo[a_col] + 1;
+  const ACC alpha = static_cast<ACC>(args.alpha.real());
+  const ACC beta = static_cast<ACC>(args.beta.real());
+  // The output may be any strided view, so address it by both strides.
+  const int64_t c_row_stride = elem_stride<O>(c_acc, DIM - 2);
+  const int64_t c_col_stride = elem_stride<O>(c_acc, DIM - 1);
+
+  legate::Rect<DIM> batch = c_rect;
+  batch.hi[DIM - 2] = batch.lo[DIM - 2];
+  batch.hi[DIM - 1] = batch.lo[DIM - 1];
+  std::vector<legate::Point<DIM>> points;
+  for (legate::PointInRectIterator<DIM> it(batch); it.valid(); ++it)
+    points.push_back(*it);
+
+  auto widen = [](const S* ptr, int64_t row_stride, int64_t col_stride,
+                  int64_t rows, int64_t cols, std::vector<ACC>& out) {
+    out.resize(rows * cols);
+    for (int64_t i = 0; i < rows; ++i)
+      for (int64_t j = 0; j < cols; ++j)
+        out[i * cols + j] =
+            convert_value<ACC>(ptr[i * row_stride + j * col_stride]);
+  };
+
+  auto multiply = [&](const legate::Point<DIM>& p) {
+    std::vector<ACC> wa, wb, wc(m * n);
+    if (k > 0) {
+      legate::Point<DIM> pa = p, pb = p;
+      pa[DIM - 2] = a_rect.lo[DIM - 2];
+      pa[DIM - 1] = a_rect.lo[DIM - 1];
+      pb[DIM - 2] = b_rect.lo[DIM - 2];
+      pb[DIM - 1] = b_rect.lo[DIM - 1];
+      widen(a_acc.ptr(pa), elem_stride<S>(a_acc, a_row),
+            elem_stride<S>(a_acc, a_col), m, k, wa);
+      widen(b_acc.ptr(pb), elem_stride<S>(b_acc, b_row),
+            elem_stride<S>(b_acc, b_col), k, n, wb);
+    }
+    O* c_ptr = c_acc.ptr(p);
+    if (args.beta != 0.0)
+      for (int64_t i = 0; i < m; ++i)
+        for (int64_t j = 0; j < n; ++j)
+          wc[i * n + j] = convert_value<ACC>(
+              c_ptr[i * c_row_stride + j * c_col_stride]);
+    const int ld_k = static_cast<int>(std::max<int64_t>(k, 1));
+    const int ld_n = static_cast<int>(std::max<int64_t>(n, 1));
+    Blas<ACC>::gemm(CblasNoTrans, CblasNoTrans, m, n, k, alpha, wa.data(), ld_k,
+                    wb.data(), ld_n, beta, wc.data(), ld_n);
+    for (int64_t i = 0; i < m; ++i)
+      for (int64_t j = 0; j < n; ++j)
+        c_ptr[i * c_row_stride + j * c_col_stride] =
+            convert_value<O>(wc[i * n + j]);
+  };
+
+  const int64_t num_points = static_cast<int64_t>(points.size());
+  if (openmp) {
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < num_points; ++i) multiply(points[i]);
+  } else {
+    for (int64_t i = 0; i < num_points; ++i) multiply(points[i]);
+  }
+}
+
+template <typename S, typename O, typename ACC>
+struct MixedGemmTileFn {
+  template <int DIM>
+  void operator()(legate::TaskContext& context, const GemmArgs& args,
+                  bool openmp) {
+    if constexpr (DIM >= 2) {
+      auto a = context.input(0).data();
+      auto b = context.input(1).data();
+      auto c = context.output(0).data();
+      const auto rect = c.shape<DIM>();
+      if (rect.empty()) return;
+      if (args.beta == 0.0) {
+        auto acc = c.write_accessor<O, DIM, false>(rect);
+        mixed_gemm_tile<S, O, ACC, DIM>(a, b, rect, acc, args, openmp);
+      } else {
+        auto acc = c.read_write_accessor<O, DIM, false>(rect);
+        mixed_gemm_tile<S, O, ACC, DIM>(a, b, rect, acc, args, openmp);
+      }
+    }
+  }
+};
+
+template <typename T>
+struct TypeTag {
+  using type = T;
+};
+
+// Calls fn(TypeTag<T>{}) for the real storage types of the mixed path.
+template <typename Fn>
+void real_dispatch(legate::Type::Code code, Fn&& fn) {
+  switch (code) {
+    case legate::Type::Code::FLOAT16:
+      fn(TypeTag<Half>{});
+      break;
+    case legate::Type::Code::FLOAT32:
+      fn(TypeTag<float>{});
+      break;
+    case legate::Type::Code::FLOAT64:
+      fn(TypeTag<double>{});
+      break;
+    default:
+      throw std::invalid_argument("gemm: unsupported mixed-precision type");
+  }
+}
+
+void mixed_gemm_variant(legate::TaskContext& context, const GemmArgs& args,
+                        legate::Type::Code acc_code, bool openmp) {
+  const int32_t dim = context.output(0).dim();
+  real_dispatch(context.input(0).type().code(), [&](auto s) {
+    real_dispatch(context.output(0).type().code(), [&](auto o) {
+      using S = typename decltype(s)::type;
+      using O = typename decltype(o)::type;
+      if (acc_code == legate::Type::Code::FLOAT32)
+        legate::dim_dispatch(dim, MixedGemmTileFn<S, O, float>{}, context,
+                             args, openmp);
+      else
+        legate::dim_dispatch(dim, MixedGemmTileFn<S, O, double>{}, context,
+                             args, openmp);
+    });
+  });
+}
+
+void gemm_variant(legate::TaskContext context, bool openmp) {
+  GemmArgs args;
+  args.trans_a = context.scalar(0).value<bool>();
+  args.trans_b = context.scalar(1).value<bool>();
+  args.alpha = {context.scalar(2).value<double>(),
+                context.scalar(3).value<double>()};
+  args.beta = {context.scalar(4).value<double>(),
+               context.scalar(5).value<double>()};
+  const auto acc_code =
+      static_cast<legate::Type::Code>(context.scalar(6).value<int32_t>());
+
+  const auto out_code = context.output(0).type().code();
+  if (context.input(0).type().code() != out_code || acc_code != out_code) {
+    mixed_gemm_variant(context, args, acc_code, openmp);
+    return;
+  }
+
+  const int32_t dim = context.output(0).dim();
+  switch (out_code) {
+    case legate::Type::Code::FLOAT32:
+      legate::dim_dispatch(dim, GemmTileFn<float>{}, context, args, openmp);
+      break;
+    case legate::Type::Code::FLOAT64:
+      legate::dim_dispatch(dim, GemmTileFn<double>{}, context, args, openmp);
+      break;
+    case legate::Type::Code::COMPLEX64:
+      legate::dim_dispatch(dim, GemmTileFn<std::complex<float>>{}, context,
+                           args, openmp);
+      break;
+    case legate::Type::Code::COMPLEX128:
+      legate::dim_dispatch(dim, GemmTileFn<std::complex<double>>{}, context,
+                           args, openmp);
+      break;
+    default:
+      throw std::invalid_argument("gemm: unsupported type");
+  }
+}
+
+bool is_blas_type(const legate::Type& type) {
+  switch (type.code()) {
+    case legate::Type::Code::FLOAT32:
+    case legate::Type::Code::FLOAT64:
+    case legate::Type::Code::COMPLEX64:
+    case legate::Type::Code::COMPLEX128:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Same heuristic as choose_nd_color_shape in src/ndarray/detail/linalg.jl:
+// start with every processor on the first batch dim and move factors of two
+// to heavier batch dims.
+std::vector<uint64_t> batch_color_shape(const std::vector<uint64_t>& shape,
+                                        uint64_t num_procs) {
+  const std::size_t ndim = shape.size();
+  std::vector<uint64_t> colors(ndim, 1);
+  if (ndim <= 2) return colors;
+  colors[0] = num_procs;
+  while (colors[0] % 2 == 0) {
+    std::size_t heaviest = 0;
+    for (std::size_t d = 1; d < ndim - 2; ++d) {
+      if (shape[d] * colors[heaviest] > shape[heaviest] * colors[d])
+        heaviest = d;
+    }
+    // weight(d) > 2 * weight(0)
+    if (heaviest == 0 || shape[heaviest] * colors[0] <=
+                             2 * shape[0] * colors[heaviest])
+      break;
+    colors[0] /= 2;
+    colors[heaviest] *= 2;
+  }
+  return colors;
+}
+
+}  // namespace
+
+void GemmTask::cpu_variant(legate::TaskContext context) {
+  gemm_variant(context, false);
+}
+
+#if LEGATE_DEFINED(LEGATE_USE_OPENMP)
+void GemmTask::omp_variant(legate::TaskContext context) {
+  gemm_variant(context, true);
+}
+#endif
+
+namespace {
+
+bool is_mixed_type(legate::Type::Code code) {
+  return code == legate::Type::Code::FLOAT16 ||
+         code == legate::Type::Code::FLOAT32 ||
+         code == legate::Type::Code::FLOAT64;
+}
+
+// Shape checks, partitioning and launch shared by gemm and mixed_gemm; the
+// callers have already validated the types.
+bool submit_gemm(const cupynumeric::NDArray& a, bool trans_a,
+                 const cupynumeric::NDArray& b, bool trans_b,
+                 cupynumeric::NDArray& c, std::complex<double> alpha,
+                 std::complex<double> beta, legate::Type::Code acc_code) {
+  const int32_t ndim = c.dim();
+  if (ndim < 2 || a.dim() != ndim || b.dim() != ndim) return false;
+
+  const int32_t row = ndim - 2, col = ndim - 1;
+  const auto& a_shape = a.shape();
+  const auto& b_shape = b.shape();
+  const auto& c_shape = c.shape();
+  for (int32_t d = 0; d < row; ++d)
+    if (a_shape[d] != c_shape[d] || b_shape[d] != c_shape[d]) return false;
+  // Stored dims holding the rows of op(a) and the cols of op(b).
+  const int32_t a_m_dim = trans_a ? col : row;
+  const int32_t b_n_dim = trans_b ? row : col;
+  const uint64_t m = c_shape[row], n = c_shape[col];
+  const uint64_t k = a_shape[trans_a ? row : col];
+  if (a_shape[a_m_dim] != m || b_shape[b_n_dim] != n ||
+      b_shape[trans_b ? col : row] != k)
+    return false;
+  if (c.size() == 0) return true;
+
+  auto runtime = legate::Runtime::get_runtime();
+  auto library = cupynumeric::CuPyNumericRuntime::get_runtime()->get_library();
+  const uint64_t num_procs =
+      std::max<uint64_t>(1, runtime->get_machine().count());
+
+  // Batched: tile the batch dims so every point task gets whole matrices.
+  // Single matrix: split the longer side of `c` across processors; the
+  // operand feeding that side is tiled along, the other one is broadcast.
+  std::vector<uint64_t> shape(c_shape.begin(), c_shape.end());
+  const auto initial_colors = batch_color_shape(shape, num_procs);
+  std::vector<uint64_t> colors(ndim, 1), c_tile = shape;
+  for (int32_t d = 0; d < row; ++d) {
+    c_tile[d] = (shape[d] + initial_colors[d] - 1) / initial_colors[d];
+    colors[d] = (shape[d] + c_tile[d] - 1) / c_tile[d];
+  }
+  int32_t split = -1;
+  if (ndim == 2 && num_procs > 1) split = m >= n ? row : col;
+  if (split >= 0) {
+    c_tile[split] = (shape[split] + num_procs - 1) / num_procs;
+    colors[split] = (shape[split] + c_tile[split] - 1) / c_tile[split];
+  }
+
+  std::vector<uint64_t> a_tile(a_shape.begin(), a_shape.end());
+  std::vector<uint64_t> b_tile(b_shape.begin(), b_shape.end());
+  std::vector<legate::SymbolicExpr> a_proj, b_proj;
+  for (int32_t d = 0; d < row; ++d) {
+    a_tile[d] = b_tile[d] = c_tile[d];
+    a_proj.push_back(legate::dimension(d));
+    b_proj.push_back(legate::dimension(d));
+  }
+  a_proj.resize(ndim, legate::constant(0));
+  b_proj.resize(ndim, legate::constant(0));
+  if (split == row) {
+    a_tile[a_m_dim] = c_tile[row];
+    a_proj[a_m_dim] = legate::dimension(row);
+  } else if (split == col) {
+    b_tile[b_n_dim] = c_tile[col];
+    b_proj[b_n_dim] = legate::dimension(col);
+  }
+
+  auto task = runtime->create_task(library, legate::LocalTaskID{GEMM_TASK},
+                                   legate::tuple<std::uint64_t>{colors});
+  task.add_input(a.get_store().partition_by_tiling(a_tile),
+                 legate::SymbolicPoint{std::move(a_proj)});
+  task.add_input(b.get_store().partition_by_tiling(b_tile),
+                 legate::SymbolicPoint{std::move(b_proj)});
+  auto c_part = c.get_store().partition_by_tiling(c_tile);
+  task.add_output(c_part);
+  if (beta != 0.0) task.add_input(c_part);
+  task.add_scalar_arg(legate::Scalar{trans_a});
+  task.add_scalar_arg(legate::Scalar{trans_b});
+  task.add_scalar_arg(legate::Scalar{alpha.real()});
+  task.add_scalar_arg(legate::Scalar{alpha.imag()});
+  task.add_scalar_arg(legate::Scalar{beta.real()});
+  task.add_scalar_arg(legate::Scalar{beta.imag()});
+  task.add_scalar_arg(legate::Scalar{static_cast<int32_t>(acc_code)});
+  runtime->submit(std::move(task));
+  return true;
+}
+
+}  // namespace
+
+bool gemm(const cupynumeric::NDArray& a, bool trans_a,
+          const cupynumeric::NDArray& b, bool trans_b, cupynumeric::NDArray& c,
+          std::complex<double> alpha, std::complex<double> beta) {
+  if (!is_blas_type(c.type()) || a.type() != c.type() || b.type() != c.type())
+    return false;
+  return submit_gemm(a, trans_a, b, trans_b, c, alpha, beta, c.type().code());
+}
+
+bool mixed_gemm(const cupynumeric::NDArray& a, const cupynumeric::NDArray& b,
+                cupynumeric::NDArray& c, legate::Type::Code acc_code) {
+  const auto in_code = a.type().code();
+  if (b.type().code() != in_code || !is_mixed_type(in_code) ||
+      !is_mixed_type(c.type().code()))
+    return false;
+  if (acc_code != legate::Type::Code::FLOAT32 &&
+      acc_code != legate::Type::Code::FLOAT64)
+    return false;
+  return submit_gemm(a, false, b, false, c, 1.0, 0.0, acc_code);
+}
+
+}  // namespace tasks
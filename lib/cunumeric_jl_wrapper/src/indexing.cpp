@@ -0,0 +1,471 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahhal <naderrahhal2026@u.northwestern.edu>
+ */
+
+#include "indexing.h"
+
+#include <cupynumeric.h>
+#include <cupynumeric/runtime.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace tasks {
+namespace {
+
+template <typename T>
+constexpr bool is_complex_v =
+    std::is_same_v<T, legate::type_of_t<legate::Type::Code::COMPLEX64>> ||
+    std::is_same_v<T, legate::type_of_t<legate::Type::Code::COMPLEX128>>;
+
+template <typename T>
+constexpr bool is_element_v = std::is_arithmetic_v<T> || is_complex_v<T>;
+
+template <typename F>
+void parallel_for(int64_t lo, int64_t hi, bool openmp, F&& f) {
+  if (openmp) {
+#pragma omp parallel for schedule(static)
+    for (int64_t i = lo; i <= hi; ++i) f(i);
+  } else {
+    for (int64_t i = lo; i <= hi; ++i) f(i);
+  }
+}
+
+template <int DIM, typename Shape>
+legate::Point<DIM> delinearize(int64_t flat, const Shape& shape,
+                               bool column_major) {
+  legate::Point<DIM> p;
+  for (int k = 0; k < DIM; ++k) {
+    const int d = column_major ? k : DIM - 1 - k;
+    const auto extent = static_cast<int64_t>(shape[d]);
+    p[d] = flat % extent;
+    flat /= extent;
+  }
+  return p;
+}
+
+template <int DIM, typename Shape>
+int64_t linearize(const legate::Point<DIM>& p, const Shape& shape,
+                  bool column_major) {
+  int64_t flat = 0;
+  for (int k = 0; k < DIM; ++k) {
+    const int d = column_major ? DIM - 1 - k : k;
+    flat = flat * static_cast<int64_t>(shape[d]) + p[d];
+  }
+  return flat;
+}
+
+struct IndexPointsFn {
+  template <int DIM>
+  void operator()(legate::TaskContext& context) {
+    auto out = context.output(0).data();
+    const auto rect = out.shape<1>();
+    if (rect.empty()) return;
+    const auto shape = context.scalar(0).values<uint64_t>();
+    const auto mode = context.scalar(1).value<int32_t>();
+    const bool column_major = context.scalar(2).value<bool>();
+    int64_t size = 1;
+    for (int d = 0; d < DIM; ++d) size *= static_cast<int64_t>(shape[d]);
+
+    auto idx = context.input(0).data().read_accessor<int64_t, 1>(rect);
+    // Points have no legate type code of their own; skip the type check.
+    auto points = out.write_accessor<legate::Point<DIM>, 1, false>(rect);
+    for (int64_t i = rect.lo[0]; i <= rect.hi[0]; ++i) {
+      int64_t f = idx[i];
+      f = mode == INDEX_WRAP ? ((f % size) + size) % size
+                             : std::clamp<int64_t>(f, 0, size - 1);
+      points[i] = delinearize<DIM>(f, shape, column_major);
+    }
+  }
+};
+
+struct TakeFn {
+  template <legate::Type::Code CODE, int DIM>
+  void operator()(legate::TaskContext& context, bool openmp) {
+    using T = legate::type_of_t<CODE>;
+    if constexpr (is_element_v<T>) {
+      auto out = context.output(0).data();
+      const auto rect = out.shape<1>();
+      if (rect.empty()) return;
+      auto points =
+          context.input(0).data().read_accessor<legate::Point<DIM>, 1, false>(
+              rect);
+      auto src = context.input(1).data().read_accessor<T, DIM>();
+      auto dst = out.write_accessor<T, 1>(rect);
+      parallel_for(rect.lo[0], rect.hi[0], openmp,
+                   [&](int64_t i) { dst[i] = src[points[i]]; });
+    } else {
+      throw std::invalid_argument("take: unsupported type");
+    }
+  }
+};
+
+// Counts, then copies, the selected entries of the tile in flat order.
+template <typename V, int DIM, typename Emit>
+void compress_tile(legate::TaskContext& context, bool column_major,
+                   Emit&& emit) {
+  auto out = context.output(0).data();
+  const auto rect = context.input(0).data().shape<DIM>();
+  if (rect.empty()) {
+    out.bind_empty_data();
+    return;
+  }
+  auto mask = context.input(0).data().read_accessor<bool, DIM>(rect);
+  int64_t count = 0;
+  for (legate::PointInRectIterator<DIM> it(rect, column_major); it.valid();
+       ++it)
+    count += mask[*it] ? 1 : 0;
+  if (count == 0) {
+    out.bind_empty_data();
+    return;
+  }
+  auto buffer =
+      out.create_output_buffer<V, 1>(legate::Point<1>(count), true);
+  V* ptr = buffer.ptr(legate::Point<1>(0));
+  int64_t j = 0;
+  for (legate::PointInRectIterator<DIM> it(rect, column_major); it.valid();
+       ++it)
+    if (mask[*it]) ptr[j++] = emit(*it);
+}
+
+struct CompressValuesFn {
+  template <legate::Type::Code CODE, int DIM>
+  void operator()(legate::TaskContext& context, bool column_major) {
+    using T = legate::type_of_t<CODE>;
+    if constexpr (is_element_v<T>) {
+      auto arr = context.input(1).data();
+      auto acc = arr.read_accessor<T, DIM>(arr.shape<DIM>());
+      compress_tile<T, DIM>(
+          context, column_major,
+          [&](const legate::Point<DIM>& p) { return acc[p]; });
+    } else {
+      throw std::invalid_argument("compress: unsupported type");
+    }
+  }
+};
+
+struct CompressIndicesFn {
+  template <int DIM>
+  void operator()(legate::TaskContext& context, bool column_major) {
+    const auto shape = context.scalar(2).values<uint64_t>();
+    compress_tile<int64_t, DIM>(
+        context, column_major, [&](const legate::Point<DIM>& p) {
+          return linearize<DIM>(p, shape, column_major);
+        });
+  }
+};
+
+struct MaskFillFn {
+  template <legate::Type::Code CODE, int DIM>
+  void operator()(legate::TaskContext& context, bool openmp) {
+    using T = legate::type_of_t<CODE>;
+    if constexpr (is_element_v<T>) {
+      auto arr = context.output(0).data();
+      const auto rect = arr.shape<DIM>();
+      if (rect.empty()) return;
+      const T value = context.scalar(0).value<T>();
+      auto mask = context.input(0).data().read_accessor<bool, DIM>(rect);
+      auto out = arr.read_write_accessor<T, DIM>(rect);
+      if (mask.accessor.is_dense_row_major(rect) &&
+          out.accessor.is_dense_row_major(rect)) {
+        const bool* m = mask.ptr(rect.lo);
+        T* y = out.ptr(rect.lo);
+        const auto volume = static_cast<int64_t>(rect.volume());
+        parallel_for(0, volume - 1, openmp, [&](int64_t i) {
+          if (m[i]) y[i] = value;
+        });
+        return;
+      }
+      for (legate::PointInRectIterator<DIM> it(rect); it.valid(); ++it)
+        if (mask[*it]) out[*it] = value;
+    } else {
+      throw std::invalid_argument("mask_fill: unsupported type");
+    }
+  }
+};
+
+bool valid_index_args(const cupynumeric::NDArray& arr,
+                      const cupynumeric::NDArray& indices, int32_t mode) {
+  return arr.dim() > 0 && arr.size() > 0 && indices.dim() == 1 &&
+         indices.type() == legate::int64() &&
+         (mode == INDEX_CLIP || mode == INDEX_WRAP);
+}
+
+std::vector<uint64_t> extents_of(const cupynumeric::NDArray& arr) {
+  const auto& shape = arr.shape();
+  return std::vector<uint64_t>(shape.begin(), shape.end());
+}
+
+legate::LogicalStore index_points(const cupynumeric::NDArray& arr,
+                                  const cupynumeric::NDArray& indices,
+                                  int32_t mode, bool column_major) {
+  auto runtime = legate::Runtime::get_runtime();
+  auto library = cupynumeric::CuPyNumericRuntime::get_runtime()->get_library();
+  auto points = runtime->create_store(legate::Shape{indices.shape()[0]},
+                                      legate::point_type(arr.dim()));
+  auto task =
+      runtime->create_task(library, legate::LocalTaskID{INDEX_POINTS_TASK});
+  auto in = task.add_input(indices.get_store());
+  auto out = task.add_output(points);
+  task.add_constraint(legate::align(in, out));
+  task.add_scalar_arg(legate::Scalar{extents_of(arr)});
+  task.add_scalar_arg(legate::Scalar{mode});
+  task.add_scalar_arg(legate::Scalar{column_major});
+  runtime->submit(std::move(task));
+  return points;
+}
+
+// Tiles the slowest-varying axis of the flat order so Legate's
+// concatenation of the per-tile outputs keeps that order.
+legate::LogicalStore launch_compress(const cupynumeric::NDArray& mask,
+                                     const cupynumeric::NDArray* arr,
+                                     bool column_major) {
+  auto runtime = legate::Runtime::get_runtime();
+  auto library = cupynumeric::CuPyNumericRuntime::get_runtime()->get_library();
+  const auto extents = extents_of(mask);
+  const std::size_t split = column_major ? extents.size() - 1 : 0;
+  const uint64_t num_procs =
+      std::max<uint64_t>(1, runtime->get_machine().count());
+  std::vector<uint64_t> tile = extents;
+  tile[split] = (extents[split] + num_procs - 1) / num_procs;
+  const uint64_t num_tiles = (extents[split] + tile[split] - 1) / tile[split];
+
+  std::vector<legate::SymbolicExpr> proj(extents.size(), legate::constant(0));
+  proj[split] = legate::dimension(0);
+  const legate::SymbolicPoint projection{proj};
+
+  auto out = runtime->create_store(arr ? arr->type() : legate::int64(), 1);
+  auto task = runtime->create_task(library, legate::LocalTaskID{COMPRESS_TASK},
+                                   legate::tuple<uint64_t>{num_tiles});
+  task.add_input(mask.get_store().partition_by_tiling(tile), projection);
+  if (arr != nullptr)
+    task.add_input(arr->get_store().partition_by_tiling(tile), projection);
+  task.add_output(out);
+  task.add_scalar_arg(legate::Scalar{arr == nullptr});
+  task.add_scalar_arg(legate::Scalar{column_major});
+  task.add_scalar_arg(legate::Scalar{extents});
+  runtime->submit(std::move(task));
+  return out;
+}
+
+// Each point task gathers from just the part of `arr` its points reach.
+void launch_take(const legate::LogicalStore& points,
+                 const cupynumeric::NDArray& arr,
+                 const legate::LogicalStore& out) {
+  auto runtime = legate::Runtime::get_runtime();
+  auto library = cupynumeric::CuPyNumericRuntime::get_runtime()->get_library();
+  auto task = runtime->create_task(library, legate::LocalTaskID{TAKE_TASK});
+  auto points_var = task.add_input(points);
+  auto src_var = task.add_input(arr.get_store());
+  auto out_var = task.add_output(out);
+  task.add_constraint(legate::align(points_var, out_var));
+  task.add_constraint(legate::image(points_var, src_var));
+  runtime->submit(std::move(task));
+}
+
+// Copies `bytes` of host data into a new store through an inline mapping.
+legate::LogicalStore host_store(const void* data, std::size_t bytes,
+                                uint64_t n, const legate::Type& type) {
+  auto store = legate::Runtime::get_runtime()->create_store(
+      legate::Shape{n}, type);
+  auto physical = store.get_physical_store();
+  std::memcpy(physical.get_inline_allocation().ptr, data, bytes);
+  return store;
+}
+
+// Host coordinates are n > 0 points of arr.dim() int64s each; the layout
+// matches an array of legate::Point, so they go into a point store as they
+// are.
+std::optional<legate::LogicalStore> host_points(
+    const cupynumeric::NDArray& arr, const int64_t* coords, int64_t n) {
+  const int32_t dim = arr.dim();
+  const auto& shape = arr.shape();
+  if (dim == 0 || n < 0) return std::nullopt;
+  for (int64_t i = 0; i < n; ++i)
+    for (int32_t d = 0; d < dim; ++d) {
+      const int64_t c = coords[i * dim + d];
+      if (c < 0 || c >= static_cast<int64_t>(shape[d])) return std::nullopt;
+    }
+  return host_store(coords, sizeof(int64_t) * dim * n,
+                    static_cast<uint64_t>(n), legate::point_type(dim));
+}
+
+bool valid_mask(const cupynumeric::NDArray& arr,
+                const cupynumeric::NDArray& mask) {
+  return arr.dim() > 0 && mask.type() == legate::bool_() &&
+         mask.shape() == arr.shape();
+}
+
+}  // namespace
+
+void IndexPointsTask::cpu_variant(legate::TaskContext context) {
+  const auto ndim = context.scalar(0).values<uint64_t>().size();
+  legate::dim_dispatch(static_cast<int>(ndim), IndexPointsFn{}, context);
+}
+
+void TakeTask::cpu_variant(legate::TaskContext context) {
+  auto src = context.input(1).data();
+  legate::double_dispatch(src.dim(), src.type().code(), TakeFn{}, context,
+                          false);
+}
+
+void CompressTask::cpu_variant(legate::TaskContext context) {
+  auto mask = context.input(0).data();
+  const bool emit_indices = context.scalar(0).value<bool>();
+  const bool column_major = context.scalar(1).value<bool>();
+  if (emit_indices) {
+    legate::dim_dispatch(mask.dim(), CompressIndicesFn{}, context,
+                         column_major);
+    return;
+  }
+  auto arr = context.input(1).data();
+  legate::double_dispatch(arr.dim(), arr.type().code(), CompressValuesFn{},
+                          context, column_major);
+}
+
+void MaskFillTask::cpu_variant(legate::TaskContext context) {
+  auto arr = context.output(0).data();
+  legate::double_dispatch(arr.dim(), arr.type().code(), MaskFillFn{}, context,
+                          false);
+}
+
+#if LEGATE_DEFINED(LEGATE_USE_OPENMP)
+void TakeTask::omp_variant(legate::TaskContext context) {
+  auto src = context.input(1).data();
+  legate::double_dispatch(src.dim(), src.type().code(), TakeFn{}, context,
+                          true);
+}
+
+void MaskFillTask::omp_variant(legate::TaskContext context) {
+  auto arr = context.output(0).data();
+  legate::double_dispatch(arr.dim(), arr.type().code(), MaskFillFn{}, context,
+                          true);
+}
+#endif
+
+std::optional<cupynumeric::NDArray> take(const cupynumeric::NDArray& arr,
+                                         const cupynumeric::NDArray& indices,
+                                         int32_t mode, bool column_major) {
+  if (!valid_index_args(arr, indices, mode)) return std::nullopt;
+  auto cn_runtime = cupynumeric::CuPyNumericRuntime::get_runtime();
+  const uint64_t n = indices.shape()[0];
+  auto out = cn_runtime->create_array({n}, arr.type());
+  if (n == 0) return out;
+
+  launch_take(index_points(arr, indices, mode, column_major), arr,
+              out.get_store());
+  return out;
+}
+
+bool put(cupynumeric::NDArray& arr, const cupynumeric::NDArray& indices,
+         const cupynumeric::NDArray& values, int32_t mode, bool column_major) {
+  if (!valid_index_args(arr, indices, mode)) return false;
+  if (values.dim() != 1 || values.type() != arr.type() ||
+      values.shape()[0] != indices.shape()[0])
+    return false;
+  if (indices.shape()[0] == 0) return true;
+
+  // Legate's scatter copy partitions `arr` by the image of the points.
+  auto points = index_points(arr, indices, mode, column_major);
+  legate::Runtime::get_runtime()->issue_scatter(arr.get_store(), points,
+                                                values.get_store());
+  return true;
+}
+
+std::optional<cupynumeric::NDArray> compress(const cupynumeric::NDArray& arr,
+                                             const cupynumeric::NDArray& mask,
+                                             bool column_major) {
+  if (!valid_mask(arr, mask)) return std::nullopt;
+  if (arr.size() == 0)
+    return cupynumeric::CuPyNumericRuntime::get_runtime()->create_array(
+        {0}, arr.type());
+  return cupynumeric::as_array(launch_compress(mask, &arr, column_major));
+}
+
+std::optional<cupynumeric::NDArray> mask_indices(
+    const cupynumeric::NDArray& mask, bool column_major) {
+  if (mask.dim() == 0 || mask.type() != legate::bool_()) return std::nullopt;
+  if (mask.size() == 0)
+    return cupynumeric::CuPyNumericRuntime::get_runtime()->create_array(
+        {0}, legate::int64());
+  return cupynumeric::as_array(launch_compress(mask, nullptr, column_major));
+}
+
+bool mask_fill(cupynumeric::NDArray& arr, const cupynumeric::NDArray& mask,
+               const legate::Scalar& value) {
+  if (!valid_mask(arr, mask) || value.type() != arr.type()) return false;
+  if (arr.size() == 0) return true;
+  auto runtime = legate::Runtime::get_runtime();
+  auto library = cupynumeric::CuPyNumericRuntime::get_runtime()->get_library();
+  auto task =
+      runtime->create_task(library, legate::LocalTaskID{MASK_FILL_TASK});
+  auto mask_var = task.add_input(mask.get_store());
+  auto in_var = task.add_input(arr.get_store());
+  auto out_var = task.add_output(arr.get_store());
+  task.add_constraint(legate::align(mask_var, out_var));
+  task.add_constraint(legate::align(in_var, out_var));
+  task.add_scalar_arg(value);
+  runtime->submit(std::move(task));
+  return true;
+}
+
+bool mask_assign(cupynumeric::NDArray& arr, const cupynumeric::NDArray& mask,
+                 const cupynumeric::NDArray& values, bool column_major) {
+  if (!valid_mask(arr, mask)) return false;
+  auto indices = mask_indices(mask, column_major);
+  if (!indices.has_value() || values.dim() != 1 ||
+      values.shape()[0] != indices->shape()[0])
+    return false;
+  if (values.shape()[0] == 0) return true;
+  return put(arr, indices.value(), values, INDEX_CLIP, column_major);
+}
+
+bool gather_points(const cupynumeric::NDArray& arr, const int64_t* coords,
+                   int64_t n, void* out) {
+  // An empty batch allocates, maps and launches nothing.
+  if (n == 0) return arr.dim() > 0;
+  auto points = host_points(arr, coords, n);
+  if (!points.has_value()) return false;
+  auto values = legate::Runtime::get_runtime()->create_store(
+      legate::Shape{static_cast<uint64_t>(n)}, arr.type());
+  launch_take(points.value(), arr, values);
+  // The only wait: mapping the gathered values back to the host.
+  auto physical = values.get_physical_store();
+  std::memcpy(out, physical.get_inline_allocation().ptr,
+              arr.type().size() * static_cast<std::size_t>(n));
+  return true;
+}
+
+bool scatter_points(cupynumeric::NDArray& arr, const int64_t* coords,
+                    const void* values, int64_t n) {
+  if (n == 0) return arr.dim() > 0;
+  auto points = host_points(arr, coords, n);
+  if (!points.has_value()) return false;
+  auto source = host_store(values, arr.type().size() * n,
+                           static_cast<uint64_t>(n), arr.type());
+  legate::Runtime::get_runtime()->issue_scatter(arr.get_store(),
+                                                points.value(), source);
+  return true;
+}
+
+}  // namespace tasks
@@ -0,0 +1,304 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahhal <naderrahhal2026@u.northwestern.edu>
+ */
+
+#include "krylov.h"
+
+#include <cupynumeric.h>
+#include <cupynumeric/runtime.h>
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace tasks {
+namespace {
+
+// Dot products a single launch can return; KRYLOV_DOTS takes up to this
+// many pairs.
+constexpr std::size_t MAX_DOTS = 4;
+using Sums = std::array<double, MAX_DOTS>;
+
+struct Layout {
+  int32_t vectors;        // 0: any number of pairs (KRYLOV_DOTS)
+  int32_t written;        // leading vectors the op updates in place
+  uint32_t coeff_counts;  // bit k set: k coefficients are accepted
+  int32_t dots;
+};
+
+// Indexed by KrylovOp.
+constexpr Layout LAYOUTS[] = {
+    {0, 0, 1u << 0, 0},                // KRYLOV_DOTS
+    {4, 2, 1u << 2, 1},                // KRYLOV_CG
+    {2, 1, 1u << 2, 0},                // KRYLOV_CG_DIRECTION
+    {7, 6, (1u << 2) | (1u << 4), 3},  // KRYLOV_PIPECG
+    {3, 1, 1u << 2, 0},                // KRYLOV_BICG_S
+    {6, 2, 1u << 4, 2},                // KRYLOV_BICG_X
+    {3, 1, 1u << 5, 0},                // KRYLOV_BICG_P
+};
+constexpr int32_t NUM_OPS = sizeof(LAYOUTS) / sizeof(LAYOUTS[0]);
+
+template <typename T>
+struct Strided {
+  T* base;
+  int64_t stride;
+  T& operator[](int64_t i) const { return base[i * stride]; }
+};
+
+template <typename Acc>
+auto view(const Acc& acc, const legate::Rect<1>& rect) {
+  using T = std::remove_pointer_t<decltype(acc.ptr(rect.lo))>;
+  if (rect.empty()) return Strided<T>{nullptr, 0};
+  return Strided<T>{acc.ptr(rect.lo), static_cast<int64_t>(
+                                          acc.accessor.strides[0] / sizeof(T))};
+}
+
+// Runs body(i, sums) for i in [0, n) and returns the summed contributions.
+template <typename F>
+Sums sweep(int64_t n, bool openmp, F&& body) {
+  Sums total{};
+  if (!openmp) {
+    for (int64_t i = 0; i < n; ++i) body(i, total);
+    return total;
+  }
+#pragma omp parallel
+  {
+    Sums local{};
+#pragma omp for schedule(static) nowait
+    for (int64_t i = 0; i < n; ++i) body(i, local);
+#pragma omp critical
+    for (std::size_t k = 0; k < MAX_DOTS; ++k) total[k] += local[k];
+  }
+  return total;
+}
+
+template <typename T>
+double dot(T a, T b) {
+  return static_cast<double>(a) * static_cast<double>(b);
+}
+
+// A vanishing denominator means the residual is already exactly zero (or
+// the method broke down); a zero step then keeps x finite until the lagged
+// convergence check on the host catches up.
+double ratio(double num, double den) { return den == 0.0 ? 0.0 : num / den; }
+
+// Values that are not partial sums may only be added by one point task.
+bool first_point(legate::TaskContext& context) {
+  if (context.is_single_task()) return true;
+  return context.get_task_index() == context.get_launch_domain().lo();
+}
+
+template <typename T>
+void krylov_tile(legate::TaskContext& context, KrylovOp op, bool openmp) {
+  const auto& layout = LAYOUTS[op];
+  const int32_t written = layout.written;
+  const int32_t nvecs = op == KRYLOV_DOTS
+                            ? static_cast<int32_t>(context.num_inputs())
+                            : layout.vectors;
+  const auto rect = context.input(0).data().shape<1>();
+  const int64_t n = static_cast<int64_t>(rect.volume());
+
+  std::vector<Strided<T>> w;
+  for (int32_t i = 0; i < written; ++i) {
+    auto store = context.output(i).data();
+    w.push_back(view(store.read_write_accessor<T, 1>(rect), rect));
+  }
+  std::vector<Strided<const T>> r;
+  for (int32_t i = written; i < nvecs; ++i) {
+    auto store = context.input(i).data();
+    r.push_back(view(store.read_accessor<T, 1>(rect), rect));
+  }
+  std::vector<double> c;
+  for (auto i = static_cast<std::size_t>(nvecs); i < context.num_inputs();
+       ++i)
+    c.push_back(context.input(i).data().read_accessor<double, 1>()[0]);
+
+  Sums sums{};
+  switch (op) {
+    case KRYLOV_DOTS: {
+      const std::size_t pairs = r.size() / 2;
+      sums = sweep(n, openmp, [&](int64_t i, Sums& acc) {
+        for (std::size_t k = 0; k < pairs; ++k)
+          acc[k] += dot(r[2 * k][i], r[2 * k + 1][i]);
+      });
+      break;
+    }
+    case KRYLOV_CG: {
+      const auto &x = w[0], &res = w[1];
+      const auto &p = r[0], &q = r[1];
+      const T a = static_cast<T>(ratio(c[0], c[1]));
+      sums = sweep(n, openmp, [&](int64_t i, Sums& acc) {
+        x[i] += a * p[i];
+        res[i] -= a * q[i];
+        acc[0] += dot(res[i], res[i]);
+      });
+      break;
+    }
+    case KRYLOV_CG_DIRECTION: {
+      const auto& p = w[0];
+      const auto& res = r[0];
+      const T b = static_cast<T>(ratio(c[0], c[1]));
+      sweep(n, openmp, [&](int64_t i, Sums&) { p[i] = res[i] + b * p[i]; });
+      break;
+    }
+    case KRYLOV_PIPECG: {
+      const auto &x = w[0], &res = w[1], &u = w[2];
+      const auto &p = w[3], &s = w[4], &z = w[5];
+      const auto& q = r[0];
+      const double gamma = c[0], delta = c[1];
+      double beta = 0.0, alpha = ratio(gamma, delta);
+      if (c.size() == 4) {
+        beta = ratio(gamma, c[2]);
+        alpha = ratio(gamma, delta - beta * ratio(gamma, c[3]));
+      }
+      const T a = static_cast<T>(alpha), b = static_cast<T>(beta);
+      sums = sweep(n, openmp, [&](int64_t i, Sums& acc) {
+        z[i] = q[i] + b * z[i];
+        s[i] = u[i] + b * s[i];
+        p[i] = res[i] + b * p[i];
+        x[i] += a * p[i];
+        res[i] -= a * s[i];
+        u[i] -= a * z[i];
+        acc[0] += dot(res[i], res[i]);
+        acc[1] += dot(u[i], res[i]);
+      });
+      // The next step's alpha_old travels as a reduction so it never has to
+      // be read back on the host.
+      if (first_point(context)) sums[2] = alpha;
+      break;
+    }
+    case KRYLOV_BICG_S: {
+      const auto& s = w[0];
+      const auto &res = r[0], &v = r[1];
+      const T a = static_cast<T>(ratio(c[0], c[1]));
+      sweep(n, openmp, [&](int64_t i, Sums&) { s[i] = res[i] - a * v[i]; });
+      break;
+    }
+    case KRYLOV_BICG_X: {
+      const auto &x = w[0], &res = w[1];
+      const auto &p = r[0], &s = r[1], &t = r[2], &rhat = r[3];
+      const T a = static_cast<T>(ratio(c[0], c[1]));
+      const T om = static_cast<T>(ratio(c[2], c[3]));
+      sums = sweep(n, openmp, [&](int64_t i, Sums& acc) {
+        x[i] += a * p[i] + om * s[i];
+        res[i] = s[i] - om * t[i];
+        acc[0] += dot(rhat[i], res[i]);
+        acc[1] += dot(res[i], res[i]);
+      });
+      break;
+    }
+    case KRYLOV_BICG_P: {
+      const auto& p = w[0];
+      const auto &res = r[0], &v = r[1];
+      const double alpha = ratio(c[1], c[2]), omega = ratio(c[3], c[4]);
+      const T b = static_cast<T>(ratio(c[0], c[1]) * ratio(alpha, omega));
+      const T om = static_cast<T>(omega);
+      sweep(n, openmp,
+            [&](int64_t i, Sums&) { p[i] = res[i] + b * (p[i] - om * v[i]); });
+      break;
+    }
+  }
+
+  for (std::size_t k = 0; k < context.num_reductions(); ++k) {
+    auto acc = context.reduction(k)
+                   .data()
+                   .reduce_accessor<legate::SumReduction<double>, true, 1>();
+    acc.reduce(0, sums[k]);
+  }
+}
+
+void krylov_variant(legate::TaskContext& context, bool openmp) {
+  const auto op = static_cast<KrylovOp>(context.scalar(0).value<int32_t>());
+  switch (context.input(0).type().code()) {
+    case legate::Type::Code::FLOAT32:
+      krylov_tile<float>(context, op, openmp);
+      break;
+    case legate::Type::Code::FLOAT64:
+      krylov_tile<double>(context, op, openmp);
+      break;
+    default:
+      throw std::invalid_argument("krylov: unsupported vector type");
+  }
+}
+
+}  // namespace
+
+/*static*/ void KrylovTask::cpu_variant(legate::TaskContext context) {
+  krylov_variant(context, false);
+}
+
+#if LEGATE_DEFINED(LEGATE_USE_OPENMP)
+/*static*/ void KrylovTask::omp_variant(legate::TaskContext context) {
+  krylov_variant(context, true);
+}
+#endif
+
+bool krylov(int32_t op, const std::vector<cupynumeric::NDArray>& vecs,
+            const std::vector<cupynumeric::NDArray>& coeffs,
+            std::vector<cupynumeric::NDArray>& dots) {
+  if (op < 0 || op >= NUM_OPS) return false;
+  const auto& layout = LAYOUTS[op];
+  const auto nvecs = static_cast<int32_t>(vecs.size());
+  int32_t num_dots = layout.dots;
+  if (op == KRYLOV_DOTS) {
+    if (nvecs == 0 || nvecs % 2 != 0 ||
+        static_cast<std::size_t>(nvecs / 2) > MAX_DOTS)
+      return false;
+    num_dots = nvecs / 2;
+  } else if (nvecs != layout.vectors) {
+    return false;
+  }
+  if (coeffs.size() >= 32 || !(layout.coeff_counts >> coeffs.size() & 1u))
+    return false;
+
+  const auto code = vecs[0].type().code();
+  if (code != legate::Type::Code::FLOAT32 &&
+      code != legate::Type::Code::FLOAT64)
+    return false;
+  for (const auto& v : vecs)
+    if (v.dim() != 1 || v.type().code() != code || v.shape() != vecs[0].shape())
+      return false;
+  for (const auto& c : coeffs)
+    if (c.dim() != 0 || c.type().code() != legate::Type::Code::FLOAT64)
+      return false;
+
+  auto runtime = legate::Runtime::get_runtime();
+  auto library = cupynumeric::CuPyNumericRuntime::get_runtime()->get_library();
+  auto task = runtime->create_task(library, legate::LocalTaskID{KRYLOV_TASK});
+  std::vector<legate::Variable> vars;
+  for (const auto& v : vecs) vars.push_back(task.add_input(v.get_store()));
+  for (int32_t i = 0; i < layout.written; ++i)
+    vars.push_back(task.add_output(vecs[i].get_store()));
+  for (std::size_t i = 1; i < vars.size(); ++i)
+    task.add_constraint(legate::align(vars[0], vars[i]));
+  for (const auto& c : coeffs)
+    task.add_constraint(legate::broadcast(task.add_input(c.get_store())));
+  for (int32_t k = 0; k < num_dots; ++k) {
+    auto sum = runtime->create_store(legate::Scalar{0.0});
+    task.add_reduction(sum, legate::ReductionOpKind::ADD);
+    dots.push_back(cupynumeric::as_array(sum));
+  }
+  task.add_scalar_arg(legate::Scalar{op});
+  runtime->submit(std::move(task));
+  return true;
+}
+
+}  // namespace tasks
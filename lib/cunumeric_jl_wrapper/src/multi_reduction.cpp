@@ -0,0 +1,375 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahhal <naderrahhal2026@u.northwestern.edu>
+ */
+
+#include "multi_reduction.h"
+
+#include <cupynumeric.h>
+#include <cupynumeric/runtime.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#if LEGATE_DEFINED(LEGATE_USE_OPENMP)
+#include <omp.h>
+#endif
+
+#include "half.h"
+
+namespace tasks {
+namespace {
+
+// Column layout of the per-tile partials store.
+enum Stat : int32_t {
+  COUNT,
+  MIN,
+  MAX,
+  SUM,
+  SUM_SQUARES,
+  NONZERO,
+  MEAN,
+  M2,
+};
+constexpr std::uint64_t NUM_STATS = 8;
+
+// Elements folded per vectorized block. A block stays in L1, so the centered
+// second pass for the variance costs no extra memory traffic.
+constexpr std::size_t BLOCK = 1024;
+
+struct RunningStats {
+  double count = 0;
+  double min = std::numeric_limits<double>::infinity();
+  double max = -std::numeric_limits<double>::infinity();
+  double sum = 0;
+  double sum_squares = 0;
+  double nonzero = 0;
+  double mean = 0;
+  double m2 = 0;
+
+  // Chan et al. pairwise update of (count, mean, m2).
+  void merge(const RunningStats& other) {
+    if (other.count == 0) return;
+    if (count == 0) {
+      *this = other;
+      return;
+    }
+    const double n = count + other.count;
+    const double delta = other.mean - mean;
+    mean += delta * other.count / n;
+    m2 += other.m2 + delta * delta * count * other.count / n;
+    count = n;
+    min = std::min(min, other.min);
+    max = std::max(max, other.max);
+    sum += other.sum;
+    sum_squares += other.sum_squares;
+    nonzero += other.nonzero;
+  }
+};
+
+template <typename T>
+RunningStats block_stats(const T* x, std::size_t n) {
+  T lo = std::numeric_limits<T>::infinity();
+  T hi = -std::numeric_limits<T>::infinity();
+  double sum = 0, sum_squares = 0, nonzero = 0;
+#pragma omp simd reduction(min : lo) reduction(max : hi) \
+    reduction(+ : sum, sum_squares, nonzero)
+  for (std::size_t i = 0; i < n; ++i) {
+    const double v = static_cast<double>(x[i]);
+    lo = x[i] < lo ? x[i] : lo;
+    hi = x[i] > hi ? x[i] : hi;
+    sum += v;
+    sum_squares += v * v;
+    nonzero += x[i] != T{0} ? 1.0 : 0.0;
+  }
+
+  const double mean = sum / static_cast<double>(n);
+  double m2 = 0;
+#pragma omp simd reduction(+ : m2)
+  for (std::size_t i = 0; i < n; ++i) {
+    const double d = static_cast<double>(x[i]) - mean;
+    m2 += d * d;
+  }
+
+  RunningStats stats;
+  stats.count = static_cast<double>(n);
+  stats.min = lo;
+  stats.max = hi;
+  stats.sum = sum;
+  stats.sum_squares = sum_squares;
+  stats.nonzero = nonzero;
+  stats.mean = mean;
+  stats.m2 = m2;
+  return stats;
+}
+
+// FLOAT16 tiles are read as Half and widened to float one block at a time,
+// so block_stats runs its float loop over L1-resident data.
+template <typename T, int DIM, bool OPENMP>
+RunningStats tile_stats(const legate::PhysicalStore& store) {
+  constexpr bool HALF = std::is_same_v<T, Half>;
+  using V = std::conditional_t<HALF, float, T>;
+  RunningStats stats;
+  const auto rect = store.shape<DIM>();
+  if (rect.empty()) return stats;
+
+  auto acc = store.read_accessor<T, DIM, !HALF>(rect);
+  const std::size_t volume = rect.volume();
+
+  if (acc.accessor.is_dense_row_major(rect)) {
+    const T* x = acc.ptr(rect.lo);
+    const std::size_t num_blocks = (volume + BLOCK - 1) / BLOCK;
+    auto block = [&](std::size_t b) {
+      const std::size_t n = std::min(BLOCK, volume - b * BLOCK);
+      if constexpr (HALF) {
+        thread_local std::vector<float> wide(BLOCK);
+        widen(x + b * BLOCK, wide.data(), static_cast<int64_t>(n));
+        return block_stats(wide.data(), n);
+      } else {
+        return block_stats(x + b * BLOCK, n);
+      }
+    };
+#if LEGATE_DEFINED(LEGATE_USE_OPENMP)
+    if constexpr (OPENMP) {
+      // Merge per-thread results in thread order so the answer does not
+      // depend on scheduling.
+      std::vector<RunningStats> partial(omp_get_max_threads());
+#pragma omp parallel
+      {
+        RunningStats local;
+#pragma omp for schedule(static)
+        for (std::size_t b = 0; b < num_blocks; ++b) local.merge(block(b));
+        partial[omp_get_thread_num()] = local;
+      }
+      for (const auto& p : partial) stats.merge(p);
+      return stats;
+    }
+#endif
+    for (std::size_t b = 0; b < num_blocks; ++b) stats.merge(block(b));
+    return stats;
+  }
+
+  // Strided views: gather each block into a contiguous buffer first.
+  std::vector<V> buffer;
+  buffer.reserve(BLOCK);
+  for (legate::PointInRectIterator<DIM> it(rect); it.valid(); ++it) {
+    if constexpr (HALF) {
+      buffer.push_back(half_to_float(acc[*it]));
+    } else {
+      buffer.push_back(acc[*it]);
+    }
+    if (buffer.size() == BLOCK) {
+      stats.merge(block_stats(buffer.data(), buffer.size()));
+      buffer.clear();
+    }
+  }
+  if (!buffer.empty()) stats.merge(block_stats(buffer.data(), buffer.size()));
+  return stats;
+}
+
+template <bool OPENMP>
+struct TileStatsFn {
+  template <int DIM>
+  RunningStats operator()(const legate::PhysicalStore& store) {
+    switch (store.type().code()) {
+      case legate::Type::Code::FLOAT16:
+        return tile_stats<Half, DIM, OPENMP>(store);
+      case legate::Type::Code::FLOAT32:
+        return tile_stats<float, DIM, OPENMP>(store);
+      default:
+        return tile_stats<double, DIM, OPENMP>(store);
+    }
+  }
+};
+
+template <bool OPENMP>
+void multi_reduction_tile(legate::TaskContext context) {
+  auto input = context.input(0).data();
+  auto partials = context.output(0).data();
+
+  const RunningStats s =
+      legate::dim_dispatch(input.dim(), TileStatsFn<OPENMP>{}, input);
+
+  const auto rect = partials.shape<2>();
+  auto acc = partials.write_accessor<double, 2>(rect);
+  const double row[NUM_STATS] = {s.count,       s.min,     s.max,  s.sum,
+                                 s.sum_squares, s.nonzero, s.mean, s.m2};
+  for (std::uint64_t k = 0; k < NUM_STATS; ++k)
+    acc[legate::Point<2>{rect.lo[0], static_cast<legate::coord_t>(k)}] = row[k];
+}
+
+double statistic(const RunningStats& s, int32_t code) {
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  switch (code) {
+    case CUPYNUMERIC_RED_MIN:
+      return s.min;
+    case CUPYNUMERIC_RED_MAX:
+      return s.max;
+    case CUPYNUMERIC_RED_SUM:
+      return s.sum;
+    case CUPYNUMERIC_RED_SUM_SQUARES:
+      return s.sum_squares;
+    case CUPYNUMERIC_RED_COUNT_NONZERO:
+      return s.nonzero;
+    case CUPYNUMERIC_RED_VARIANCE:
+      return s.count > 0 ? s.m2 / s.count : nan;
+    case STAT_MEAN:
+      return s.count > 0 ? s.mean : nan;
+    case STAT_SAMPLE_VARIANCE:
+      return s.count > 1 ? s.m2 / (s.count - 1) : nan;
+    default:
+      return nan;
+  }
+}
+
+bool is_supported_code(int32_t code) {
+  switch (code) {
+    case CUPYNUMERIC_RED_MIN:
+    case CUPYNUMERIC_RED_MAX:
+    case CUPYNUMERIC_RED_SUM:
+    case CUPYNUMERIC_RED_SUM_SQUARES:
+    case CUPYNUMERIC_RED_COUNT_NONZERO:
+    case CUPYNUMERIC_RED_VARIANCE:
+    case STAT_MEAN:
+    case STAT_SAMPLE_VARIANCE:
+      return true;
+    default:
+      return false;
+  }
+}
+
+struct WriteScalarFn {
+  template <legate::Type::Code CODE>
+  void operator()(const legate::PhysicalStore& out, double value) {
+    using VAL = legate::type_of_t<CODE>;
+    if constexpr (CODE == legate::Type::Code::FLOAT16) {
+      auto acc = out.write_accessor<Half, 1, false>();
+      acc[0] = float_to_half(static_cast<float>(value));
+    } else if constexpr (std::is_arithmetic_v<VAL>) {
+      auto acc = out.write_accessor<VAL, 1>();
+      acc[0] = static_cast<VAL>(value);
+    } else {
+      throw std::invalid_argument("multi_reduction: unsupported output type");
+    }
+  }
+};
+
+}  // namespace
+
+void MultiReductionTask::cpu_variant(legate::TaskContext context) {
+  multi_reduction_tile<false>(context);
+}
+
+#if LEGATE_DEFINED(LEGATE_USE_OPENMP)
+void MultiReductionTask::omp_variant(legate::TaskContext context) {
+  multi_reduction_tile<true>(context);
+}
+#endif
+
+void MultiReductionMergeTask::cpu_variant(legate::TaskContext context) {
+  auto partials = context.input(0).data();
+  const auto codes = context.scalar(0).values<int32_t>();
+
+  const auto rect = partials.shape<2>();
+  auto acc = partials.read_accessor<double, 2>(rect);
+
+  RunningStats stats;
+  for (legate::coord_t row = rect.lo[0]; row <= rect.hi[0]; ++row) {
+    RunningStats s;
+    s.count = acc[{row, COUNT}];
+    s.min = acc[{row, MIN}];
+    s.max = acc[{row, MAX}];
+    s.sum = acc[{row, SUM}];
+    s.sum_squares = acc[{row, SUM_SQUARES}];
+    s.nonzero = acc[{row, NONZERO}];
+    s.mean = acc[{row, MEAN}];
+    s.m2 = acc[{row, M2}];
+    stats.merge(s);
+  }
+
+  for (std::size_t i = 0; i < codes.size(); ++i) {
+    auto out = context.output(i).data();
+    legate::type_dispatch(out.type().code(), WriteScalarFn{}, out,
+                          statistic(stats, codes[i]));
+  }
+}
+
+bool multi_reduction(const cupynumeric::NDArray& input,
+                     const std::vector<int32_t>& codes,
+                     std::vector<cupynumeric::NDArray>& outs) {
+  const auto code = input.type().code();
+  if (code != legate::Type::Code::FLOAT16 &&
+      code != legate::Type::Code::FLOAT32 &&
+      code != legate::Type::Code::FLOAT64)
+    return false;
+  if (input.dim() == 0 || input.size() == 0) return false;
+  if (codes.empty() || codes.size() != outs.size()) return false;
+  if (!std::all_of(codes.begin(), codes.end(), is_supported_code)) return false;
+  for (const auto& out : outs)
+    if (out.dim() != 0) return false;
+
+  auto runtime = legate::Runtime::get_runtime();
+  auto library = cupynumeric::CuPyNumericRuntime::get_runtime()->get_library();
+
+  // Tile the longest axis, one tile per processor. Each point task writes one
+  // row of partials, so the input is read exactly once.
+  const auto& shape = input.shape();
+  std::vector<std::uint64_t> extents(shape.begin(), shape.end());
+  const std::size_t split = static_cast<std::size_t>(std::distance(
+      extents.begin(), std::max_element(extents.begin(), extents.end())));
+  const std::uint64_t num_procs =
+      std::max<std::uint64_t>(1, runtime->get_machine().count());
+
+  std::vector<std::uint64_t> tile = extents;
+  tile[split] = (extents[split] + num_procs - 1) / num_procs;
+  const std::uint64_t num_tiles =
+      (extents[split] + tile[split] - 1) / tile[split];
+
+  auto partials = runtime->create_store(legate::Shape{num_tiles, NUM_STATS},
+                                        legate::float64());
+
+  std::vector<legate::SymbolicExpr> input_proj(extents.size(),
+                                               legate::constant(0));
+  input_proj[split] = legate::dimension(0);
+
+  auto task = runtime->create_task(library,
+                                   legate::LocalTaskID{MULTI_REDUCTION_TASK},
+                                   legate::tuple<std::uint64_t>{num_tiles});
+  task.add_input(input.get_store().partition_by_tiling(tile),
+                 legate::SymbolicPoint{std::move(input_proj)});
+  task.add_output(partials.partition_by_tiling({1, NUM_STATS}),
+                  legate::SymbolicPoint{legate::dimension(0),
+                                        legate::constant(0)});
+  runtime->submit(std::move(task));
+
+  auto merge = runtime->create_task(
+      library, legate::LocalTaskID{MULTI_REDUCTION_MERGE_TASK});
+  auto part = merge.add_input(partials);
+  merge.add_constraint(legate::broadcast(part));
+  for (auto& out : outs) merge.add_output(out.get_store());
+  merge.add_scalar_arg(legate::Scalar{codes});
+  runtime->submit(std::move(merge));
+  return true;
+}
+
+}  // namespace tasks
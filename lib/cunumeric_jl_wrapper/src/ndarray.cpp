@@ -26,15 +26,35 @@
 #include <deps/realm/machine_impl.h>
 #include <legate.h>
 
+#include <algorithm>
 #include <atomic>
+#include <complex>
 #include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <optional>
+#include <string>
 #include <string_view>
 #include <vector>
 
+#include "checkpoint.h"
+#include "convolve.h"
+#include "einsum.h"
+#include "expr.h"
+#include "fft.h"
+#include "footprint.h"
+#include "gemm.h"
+#include "indexing.h"
+#include "krylov.h"
+#include "multi_reduction.h"
 #include "ndarray_c_api.h"
+#include "pad.h"
+#include "scalar_cache.h"
+#include "scan.h"
+#include "sort.h"
+#include "sparse.h"
+#include "spill.h"
+#include "strided_descriptor.h"
 
 extern "C" {
 
@@ -57,21 +77,55 @@ struct CN_Store {
   legate::LogicalStore obj;
 };
 
+}  // extern "C"
+
+namespace {
+
+// The array behind a handle, for ops that may be recorded in deferred
+// mode. Counts as a use for the spill manager, which fills a spilled array
+// back in before handing it out.
+NDArray& peek(const CN_NDArray* arr) {
+  auto* handle = const_cast<CN_NDArray*>(arr);
+  tasks::touch_spill(handle);
+  return handle->obj;
+}
+
+// The array behind a handle, for ops that run now. Recorded ops that write
+// or read it are launched first.
+NDArray& use(const CN_NDArray* arr) {
+  tasks::flush_deferred_for(arr);
+  return peek(arr);
+}
+
+}  // namespace
+
+extern "C" {
+
 CN_NDArray* nda_zeros_array(int32_t dim, const uint64_t* shape, CN_Type type) {
   std::vector<uint64_t> shp(shape, shape + dim);
   NDArray result = zeros(shp, type.obj);
   return new CN_NDArray{NDArray(std::move(result))};
 }
 
+// Uninitialized array. With a 0-d shape this is a future-backed scalar store,
+// so reducing into it neither fills nor maps a region.
+CN_NDArray* nda_empty_array(int32_t dim, const uint64_t* shape, CN_Type type) {
+  std::vector<uint64_t> shp(shape, shape + dim);
+  auto runtime = cupynumeric::CuPyNumericRuntime::get_runtime();
+  return new CN_NDArray{runtime->create_array(std::move(shp), type.obj)};
+}
+
 CN_NDArray* nda_full_array(int32_t dim, const uint64_t* shape, CN_Type type,
                            const void* value) {
   std::vector<uint64_t> shp(shape, shape + dim);
   Scalar s(type.obj, value, true);
   NDArray result = full(shp, s);
-  return new CN_NDArray{NDArray(std::move(result))};
+  auto arr = new CN_NDArray{NDArray(std::move(result))};
+  if (dim == 0) tasks::record_constant(arr, s);
+  return arr;
 }
 
-void nda_random(CN_NDArray* arr, int32_t code) { arr->obj.random(code); }
+void nda_random(CN_NDArray* arr, int32_t code) { use(arr).random(code); }
 
 CN_NDArray* nda_random_array(int32_t dim, const uint64_t* shape) {
   std::vector<uint64_t> shp(shape, shape + dim);
@@ -82,15 +136,37 @@ CN_NDArray* nda_random_array(int32_t dim, const uint64_t* shape) {
 CN_NDArray* nda_reshape_array(CN_NDArray* arr, int32_t dim,
                               const uint64_t* shape) {
   std::vector<int64_t> shp(shape, shape + dim);
-  NDArray result = cupynumeric::reshape(arr->obj, shp, "C");
+  tasks::pin_spill(arr);
+  NDArray result = cupynumeric::reshape(use(arr), shp, "C");
   return new CN_NDArray{NDArray(std::move(result))};
 }
 
+CN_NDArray* nda_broadcast_to(CN_NDArray* arr, int32_t dim,
+                             const uint64_t* shape) {
+  tasks::flush_deferred();
+  tasks::pin_spill(arr);
+  auto store = use(arr).get_store();
+  const int32_t src_dim = static_cast<int32_t>(store.dim());
+  if (src_dim > dim) return nullptr;
+  const auto extents = store.extents();
+  // Leading dimensions line up (Julia's rule, not NumPy's trailing one).
+  // Extent-1 dimensions are projected away and re-added as stride-0
+  // promotions, so the view never copies data.
+  for (int32_t d = 0; d < src_dim; ++d) {
+    if (extents[d] == shape[d]) continue;
+    if (extents[d] != 1) return nullptr;
+    store = store.project(d, 0).promote(d, shape[d]);
+  }
+  for (int32_t d = src_dim; d < dim; ++d) store = store.promote(d, shape[d]);
+  return new CN_NDArray{cupynumeric::as_array(store)};
+}
+
 CN_NDArray* nda_from_scalar(CN_Type type, const void* value) {
   Scalar s(type.obj, value, true);
-  auto runtime = cupynumeric::CuPyNumericRuntime::get_runtime();
-  auto scalar_store = runtime->create_scalar_store(s);
-  return new CN_NDArray{cupynumeric::as_array(scalar_store)};
+  auto scalar_store = tasks::interned_scalar_store(s);
+  auto arr = new CN_NDArray{cupynumeric::as_array(scalar_store)};
+  tasks::record_constant(arr, s);
+  return arr;
   // return new CN_NDArray{NDArray(std::move(scalar_store))};
 }
 
@@ -101,38 +177,42 @@ CN_NDArray* nda_from_scalar(CN_Type type, const void* value) {
 // }
 
 CN_NDArray* nda_astype(CN_NDArray* arr, CN_Type type) {
-  NDArray result = arr->obj.as_type(type.obj);
+  tasks::flush_deferred();
+  NDArray result = use(arr).as_type(type.obj);
   return new CN_NDArray{NDArray(std::move(result))};
 }
 
 void nda_fill_array(CN_NDArray* arr, CN_Type type, const void* value) {
+  tasks::flush_deferred();
+  tasks::forget_deferred(arr);
   Scalar s(type.obj, value, true);
-  arr->obj.fill(s);
+  use(arr).fill(s);
 }
 
 void nda_multiply(CN_NDArray* rhs1, CN_NDArray* rhs2, CN_NDArray* out) {
-  cupynumeric::multiply(rhs1->obj, rhs2->obj, out->obj);
+  cupynumeric::multiply(use(rhs1), use(rhs2), use(out));
 }
 
 void nda_add(CN_NDArray* rhs1, CN_NDArray* rhs2, CN_NDArray* out) {
-  cupynumeric::add(rhs1->obj, rhs2->obj, out->obj);
+  cupynumeric::add(use(rhs1), use(rhs2), use(out));
 }
 
 // NEW
 
 CN_NDArray* nda_unique(CN_NDArray* arr) {
-  NDArray result = cupynumeric::unique(arr->obj);
+  NDArray result = cupynumeric::unique(use(arr));
   return new CN_NDArray{NDArray(std::move(result))};
 }
 
 CN_NDArray* nda_ravel(CN_NDArray* arr) {
-  NDArray result = cupynumeric::ravel(arr->obj, "C");
+  tasks::pin_spill(arr);
+  NDArray result = cupynumeric::ravel(use(arr), "C");
   return new CN_NDArray{NDArray(std::move(result))};
 }
 
 CN_NDArray* nda_trace(CN_NDArray* arr, int32_t offset, int32_t a1, int32_t a2,
                       CN_Type type) {
-  NDArray result = cupynumeric::trace(arr->obj, offset, a1, a2, type.obj);
+  NDArray result = cupynumeric::trace(use(arr), offset, a1, a2, type.obj);
   return new CN_NDArray{NDArray(std::move(result))};
 }
 
@@ -142,52 +222,289 @@ CN_NDArray* nda_eye(int32_t rows, CN_Type type) {
 }
 
 CN_NDArray* nda_diag(CN_NDArray* arr, int32_t k) {
-  NDArray result = cupynumeric::diag(arr->obj, k);
+  NDArray result = cupynumeric::diag(use(arr), k);
   return new CN_NDArray{NDArray(std::move(result))};
 }
 
 CN_NDArray* nda_transpose(CN_NDArray* arr) {
-  NDArray result = cupynumeric::transpose(arr->obj);
+  tasks::pin_spill(arr);
+  NDArray result = cupynumeric::transpose(use(arr));
   return new CN_NDArray{NDArray(std::move(result))};
 }
 
 CN_NDArray* nda_multiply_scalar(CN_NDArray* rhs1, CN_Type type,
                                 const void* value) {
   Scalar s(type.obj, value, true);
-  NDArray result = rhs1->obj * s;
+  NDArray result = use(rhs1) * s;
   return new CN_NDArray{NDArray(std::move(result))};
 }
 
 CN_NDArray* nda_add_scalar(CN_NDArray* rhs1, CN_Type type, const void* value) {
   Scalar s(type.obj, value, true);
-  NDArray result = rhs1->obj + s;
+  NDArray result = use(rhs1) + s;
   return new CN_NDArray{NDArray(std::move(result))};
 }
 
 CN_NDArray* nda_dot(CN_NDArray* rhs1, CN_NDArray* rhs2) {
-  NDArray result = cupynumeric::dot(rhs1->obj, rhs2->obj);
+  NDArray result = cupynumeric::dot(use(rhs1), use(rhs2));
   return new CN_NDArray{NDArray(std::move(result))};
 }
 
 void nda_three_dot_arg(CN_NDArray* rhs1, CN_NDArray* rhs2, CN_NDArray* out) {
-  out->obj.dot(rhs1->obj, rhs2->obj);
+  use(out).dot(use(rhs1), use(rhs2));
+}
+
+bool nda_batched_matmul(CN_NDArray* out, CN_NDArray* a, CN_NDArray* b) {
+  return tasks::gemm(use(a), false, use(b), false, use(out));
+}
+
+// alpha/beta point at values of out's element type.
+bool nda_gemm(CN_NDArray* out, CN_NDArray* a, bool trans_a, CN_NDArray* b,
+              bool trans_b, const void* alpha, const void* beta) {
+  auto load = [&](const void* v) -> std::complex<double> {
+    switch (out->obj.type().code()) {
+      case legate::Type::Code::FLOAT32:
+        return *static_cast<const float*>(v);
+      case legate::Type::Code::FLOAT64:
+        return *static_cast<const double*>(v);
+      case legate::Type::Code::COMPLEX64:
+        return *static_cast<const std::complex<float>*>(v);
+      case legate::Type::Code::COMPLEX128:
+        return *static_cast<const std::complex<double>*>(v);
+      default:
+        return 0.0;
+    }
+  };
+  return tasks::gemm(use(a), trans_a, use(b), trans_b, use(out), load(alpha),
+                     load(beta));
+}
+
+bool nda_matmul_mixed(CN_NDArray* out, CN_NDArray* a, CN_NDArray* b,
+                      CN_Type acc_type) {
+  return tasks::mixed_gemm(use(a), use(b), use(out), acc_type.obj.code());
+}
+
+CN_NDArray* nda_einsum(const char* subscripts, int32_t num_operands,
+                       CN_NDArray** operands) {
+  std::vector<NDArray> ops;
+  for (int32_t i = 0; i < num_operands; ++i) ops.push_back(use(operands[i]));
+  auto result = tasks::einsum(subscripts, ops);
+  if (!result.has_value()) return nullptr;
+  return new CN_NDArray{NDArray(std::move(result.value()))};
+}
+
+CN_NDArray* nda_tensordot(CN_NDArray* a, CN_NDArray* b, int32_t num_axes,
+                          const int32_t* a_axes, const int32_t* b_axes) {
+  auto result =
+      tasks::tensordot(use(a), use(b), {a_axes, a_axes + num_axes},
+                       {b_axes, b_axes + num_axes});
+  if (!result.has_value()) return nullptr;
+  return new CN_NDArray{NDArray(std::move(result.value()))};
+}
+
+int32_t nda_einsum_path(const char* subscripts, int32_t num_operands,
+                        const int32_t* dims, const uint64_t* shapes,
+                        int32_t* out_path) {
+  std::vector<std::vector<uint64_t>> shps;
+  for (int32_t i = 0; i < num_operands; ++i) {
+    shps.emplace_back(shapes, shapes + dims[i]);
+    shapes += dims[i];
+  }
+  const auto path = tasks::einsum_path(subscripts, shps);
+  if (path.size() + 1 != shps.size()) return -1;
+  for (const auto& [i, j] : path) {
+    *out_path++ = i;
+    *out_path++ = j;
+  }
+  return static_cast<int32_t>(path.size());
+}
+
+CN_NDArray* nda_csr_row_ranges(CN_NDArray* rowptr) {
+  auto result = tasks::csr_row_ranges(use(rowptr));
+  if (!result.has_value()) return nullptr;
+  return new CN_NDArray{NDArray(std::move(result.value()))};
+}
+
+bool nda_csr_spmv(CN_NDArray* y, CN_NDArray* row_ranges, CN_NDArray* colind,
+                  CN_NDArray* values, CN_NDArray* x) {
+  return tasks::csr_spmv(use(row_ranges), use(colind), use(values), use(x),
+                         use(y));
+}
+
+bool nda_csr_spmm(CN_NDArray* y, CN_NDArray* row_ranges, CN_NDArray* colind,
+                  CN_NDArray* values, CN_NDArray* x) {
+  return tasks::csr_spmm(use(row_ranges), use(colind), use(values), use(x),
+                         use(y));
+}
+
+CN_NDArray* nda_sort(CN_NDArray* arr, int32_t axis, bool flatten, bool stable,
+                     bool descending) {
+  auto result =
+      tasks::sort(use(arr), flatten ? std::nullopt : std::optional{axis},
+                  stable, descending);
+  if (!result.has_value()) return nullptr;
+  return new CN_NDArray{std::move(result.value())};
+}
+
+CN_NDArray* nda_argsort(CN_NDArray* arr, int32_t axis, bool flatten,
+                        bool stable, bool descending) {
+  auto result =
+      tasks::argsort(use(arr), flatten ? std::nullopt : std::optional{axis},
+                     stable, descending);
+  if (!result.has_value()) return nullptr;
+  return new CN_NDArray{std::move(result.value())};
+}
+
+CN_NDArray* nda_partition(CN_NDArray* arr, int64_t kth, int32_t axis) {
+  auto result = tasks::partition(use(arr), kth, axis);
+  if (!result.has_value()) return nullptr;
+  return new CN_NDArray{std::move(result.value())};
+}
+
+CN_NDArray* nda_argpartition(CN_NDArray* arr, int64_t kth, int32_t axis) {
+  auto result = tasks::argpartition(use(arr), kth, axis);
+  if (!result.has_value()) return nullptr;
+  return new CN_NDArray{std::move(result.value())};
+}
+
+bool nda_topk(CN_NDArray* arr, int64_t k, bool largest, CN_NDArray* values,
+              CN_NDArray* indices) {
+  return tasks::topk(use(arr), k, largest, use(values), use(indices));
+}
+
+bool nda_scan(CN_NDArray* out, int32_t op, CN_NDArray* input, int32_t axis,
+              bool inclusive) {
+  return tasks::scan(use(out), op, use(input), axis, inclusive);
+}
+
+CN_NDArray* nda_take(CN_NDArray* arr, CN_NDArray* indices, int32_t mode,
+                     bool column_major) {
+  auto result = tasks::take(use(arr), use(indices), mode, column_major);
+  if (!result.has_value()) return nullptr;
+  return new CN_NDArray{std::move(result.value())};
+}
+
+bool nda_put(CN_NDArray* arr, CN_NDArray* indices, CN_NDArray* values,
+             int32_t mode, bool column_major) {
+  return tasks::put(use(arr), use(indices), use(values), mode, column_major);
+}
+
+CN_NDArray* nda_compress(CN_NDArray* arr, CN_NDArray* mask,
+                         bool column_major) {
+  auto result = tasks::compress(use(arr), use(mask), column_major);
+  if (!result.has_value()) return nullptr;
+  return new CN_NDArray{std::move(result.value())};
+}
+
+CN_NDArray* nda_mask_indices(CN_NDArray* mask, bool column_major) {
+  auto result = tasks::mask_indices(use(mask), column_major);
+  if (!result.has_value()) return nullptr;
+  return new CN_NDArray{std::move(result.value())};
+}
+
+bool nda_mask_fill(CN_NDArray* arr, CN_NDArray* mask, CN_Type type,
+                   const void* value) {
+  Scalar s(type.obj, value, true);
+  return tasks::mask_fill(use(arr), use(mask), s);
+}
+
+bool nda_mask_assign(CN_NDArray* arr, CN_NDArray* mask, CN_NDArray* values,
+                     bool column_major) {
+  return tasks::mask_assign(use(arr), use(mask), use(values), column_major);
+}
+
+bool nda_gather_points(CN_NDArray* arr, const int64_t* coords, int64_t n,
+                       void* out_buf) {
+  return tasks::gather_points(use(arr), coords, n, out_buf);
+}
+
+bool nda_scatter_points(CN_NDArray* arr, const int64_t* coords,
+                        const void* values, int64_t n) {
+  return tasks::scatter_points(use(arr), coords, values, n);
+}
+
+CN_NDArray* nda_pad(CN_NDArray* arr, const uint64_t* widths, int32_t mode,
+                    CN_Type type, const void* value) {
+  std::vector<uint64_t> w(widths, widths + 2 * arr->obj.dim());
+  Scalar s(type.obj, value, true);
+  auto result = tasks::pad(use(arr), w, mode, s);
+  if (!result.has_value()) return nullptr;
+  return new CN_NDArray{std::move(result.value())};
+}
+
+CN_NDArray* nda_concatenate(int32_t num_arrays, CN_NDArray** arrs,
+                            int32_t axis) {
+  std::vector<NDArray> arr_vec;
+  arr_vec.reserve(num_arrays);
+  for (int32_t i = 0; i < num_arrays; ++i) arr_vec.push_back(use(arrs[i]));
+  auto result = tasks::concatenate(arr_vec, axis);
+  if (!result.has_value()) return nullptr;
+  return new CN_NDArray{std::move(result.value())};
+}
+
+CN_NDArray* nda_stack(int32_t num_arrays, CN_NDArray** arrs, int32_t axis) {
+  std::vector<NDArray> arr_vec;
+  arr_vec.reserve(num_arrays);
+  for (int32_t i = 0; i < num_arrays; ++i) arr_vec.push_back(use(arrs[i]));
+  auto result = tasks::stack(arr_vec, axis);
+  if (!result.has_value()) return nullptr;
+  return new CN_NDArray{std::move(result.value())};
+}
+
+bool nda_checkpoint(int32_t num_arrays, CN_NDArray** arrs, const char** names,
+                    const char* dir, bool compress) {
+  tasks::flush_deferred();
+  std::vector<NDArray> arr_vec;
+  std::vector<std::string> name_vec;
+  for (int32_t i = 0; i < num_arrays; ++i) {
+    arr_vec.push_back(use(arrs[i]));
+    name_vec.emplace_back(names[i]);
+  }
+  return tasks::checkpoint(arr_vec, name_vec, dir, compress);
+}
+
+int32_t nda_restore(int32_t num_arrays, const char** names, const char* dir,
+                    CN_NDArray** out) {
+  std::vector<std::string> name_vec(names, names + num_arrays);
+  std::vector<NDArray> result;
+  switch (tasks::restore(name_vec, dir, result)) {
+    case tasks::RestoreStatus::MISSING:
+      return CN_RESTORE_MISSING;
+    case tasks::RestoreStatus::CORRUPT:
+      return CN_RESTORE_CORRUPT;
+    case tasks::RestoreStatus::OK:
+      break;
+  }
+  for (int32_t i = 0; i < num_arrays; ++i)
+    out[i] = new CN_NDArray{std::move(result[i])};
+  return CN_RESTORE_OK;
 }
 
 CN_NDArray* nda_copy(CN_NDArray* arr) {
-  NDArray result = arr->obj.copy();
+  tasks::flush_deferred();
+  NDArray result = use(arr).copy();
   return new CN_NDArray{NDArray(std::move(result))};
 }
 
 void nda_assign(CN_NDArray* arr, CN_NDArray* other) {
-  arr->obj.assign(other->obj);
+  tasks::flush_deferred();
+  tasks::forget_deferred(arr);
+  use(arr).assign(use(other));
 }
 
 void nda_move(CN_NDArray* dst, CN_NDArray* src) {
+  tasks::flush_deferred();
+  tasks::forget_deferred(dst);
+  tasks::forget_deferred(src);
+  use(src);
   dst->obj.operator=(std::move(src->obj));
+  tasks::move_spill(dst, src);
 }
 
 void nda_destroy_array(CN_NDArray* arr) {
   if (arr != NULL) {
+    tasks::forget_deferred(arr);
+    tasks::forget_spill(arr);
     delete arr;
   }
 }
@@ -196,6 +513,26 @@ int32_t nda_array_dim(const CN_NDArray* arr) { return arr->obj.dim(); }
 
 uint64_t nda_array_size(const CN_NDArray* arr) { return arr->obj.size(); }
 
+bool nda_strided_descriptor(CN_NDArray* arr, void** ptr, uint64_t* dims,
+                            uint64_t* strides) {
+  if (arr->obj.dim() == 0) return false;
+  tasks::flush_deferred();
+  // The pointer outlives this call, so the instance must stay put.
+  tasks::pin_spill(arr);
+  auto store = use(arr).get_store().get_physical_store();
+  ufi::describe_strided(store, ptr, dims, strides);
+  return true;
+}
+
+void nda_read_scalar(const CN_NDArray* arr, void* out) {
+  // For a future-backed store this waits on the producing task's future only;
+  // region-backed stores are inline mapped as with the accessors. use() only
+  // flushes the recording if it produces `arr`.
+  auto store = use(arr).get_store().get_physical_store();
+  const auto alloc = store.get_inline_allocation();
+  std::memcpy(out, alloc.ptr, store.type().size());
+}
+
 int32_t nda_array_type_code(const CN_NDArray* arr) {
   return static_cast<int32_t>(arr->obj.type().code());
 }
@@ -208,6 +545,26 @@ uint64_t nda_nbytes(CN_NDArray* arr) {
   return static_cast<uint64_t>(arr->obj.type().size()) * nda_array_size(arr);
 }
 
+static CN_Footprint to_c_footprint(const tasks::Footprint& f) {
+  return CN_Footprint{f.sysmem, f.fbmem, f.zcmem, f.socketmem, f.scalar};
+}
+
+void nda_physical_footprint(CN_NDArray* arr, CN_Footprint* out) {
+  tasks::flush_deferred();
+  // Measures the handle as it is; a spilled array is not filled back.
+  *out = to_c_footprint(tasks::physical_footprint(arr->obj));
+}
+
+uint64_t nda_physical_bytes(CN_NDArray* arr) {
+  CN_Footprint f;
+  nda_physical_footprint(arr, &f);
+  return f.sysmem + f.fbmem + f.zcmem + f.socketmem + f.scalar;
+}
+
+void nda_allocated_footprint(CN_Footprint* out) {
+  *out = to_c_footprint(tasks::allocated_footprint());
+}
+
 void nda_array_shape(const CN_NDArray* arr, uint64_t* out_shape) {
   const auto& shp = arr->obj.shape();
   for (size_t i = 0; i < shp.size(); ++i) out_shape[i] = shp[i];
@@ -215,42 +572,224 @@ void nda_array_shape(const CN_NDArray* arr, uint64_t* out_shape) {
 
 void nda_binary_op(CN_NDArray* out, CuPyNumericBinaryOpCode op_code,
                    const CN_NDArray* rhs1, const CN_NDArray* rhs2) {
-  out->obj.binary_op(op_code, rhs1->obj, rhs2->obj);
+  if (tasks::record_binary(out, peek(out), op_code, rhs1, peek(rhs1), rhs2,
+                           peek(rhs2)))
+    return;
+  use(out).binary_op(op_code, use(rhs1), use(rhs2));
 }
 
 void nda_binary_reduction(CN_NDArray* out, CuPyNumericBinaryOpCode op_code,
                           const CN_NDArray* rhs1, const CN_NDArray* rhs2) {
-  out->obj.binary_reduction(op_code, rhs1->obj, rhs2->obj);
+  tasks::flush_deferred();
+  use(out).binary_reduction(op_code, use(rhs1), use(rhs2));
 }
 
 CN_NDArray* nda_array_equal(const CN_NDArray* rhs1, const CN_NDArray* rhs2) {
-  return new CN_NDArray{cupynumeric::array_equal(rhs1->obj, rhs2->obj)};
+  tasks::flush_deferred();
+  return new CN_NDArray{cupynumeric::array_equal(use(rhs1), use(rhs2))};
 }
 
 void nda_unary_op(CN_NDArray* out, CuPyNumericUnaryOpCode op_code,
                   CN_NDArray* input) {
-  out->obj.unary_op(op_code, input->obj);
+  if (tasks::record_unary(out, peek(out), op_code, input, peek(input)))
+    return;
+  use(out).unary_op(op_code, use(input));
+}
+
+void nda_scalar_cache_stats(CN_ScalarCacheStats* out) {
+  const auto stats = tasks::scalar_cache_stats();
+  *out = CN_ScalarCacheStats{stats.hits, stats.misses, stats.evictions,
+                             stats.size, stats.capacity};
 }
 
+void nda_set_scalar_cache_capacity(uint64_t capacity) {
+  tasks::set_scalar_cache_capacity(capacity);
+}
+
+void nda_clear_scalar_cache() { tasks::clear_scalar_cache(); }
+
+bool nda_set_spilling(bool enabled, const char* dir) {
+  return tasks::set_spilling(enabled, dir);
+}
+
+void nda_track_spill(CN_NDArray* arr) { tasks::track_spill(arr, &arr->obj); }
+
+void nda_pin_spill(CN_NDArray* arr) { tasks::pin_spill(arr); }
+
+uint64_t nda_spill_cold(uint64_t bytes) { return tasks::spill_cold(bytes); }
+
+void nda_spill_stats(CN_SpillStats* out) {
+  const auto stats = tasks::spill_stats();
+  *out = CN_SpillStats{stats.spills,         stats.fills,
+                       stats.spilled_bytes,  stats.filled_bytes,
+                       stats.resident_bytes, stats.tracked};
+}
+
+void nda_set_deferred(bool enabled) { tasks::set_deferred(enabled); }
+
+void nda_flush_deferred() { tasks::flush_deferred(); }
+
+uint64_t nda_fused_expr_launches() { return tasks::fused_expr_launches(); }
+
 void nda_unary_reduction(CN_NDArray* out, CuPyNumericUnaryRedCode op_code,
                          CN_NDArray* input) {
-  out->obj.unary_reduction(op_code, input->obj);
+  tasks::flush_deferred();
+  use(out).unary_reduction(op_code, use(input));
+}
+
+// cupynumeric only reduces over one axis (or all of them) per task. Reducing
+// over a subset of several axes is done as a chain of single-axis reductions,
+// so the op must be associative; the sum-like ops re-reduce with SUM.
+static std::optional<CuPyNumericUnaryRedCode> chained_reduction_code(
+    CuPyNumericUnaryRedCode op_code) {
+  switch (op_code) {
+    case CUPYNUMERIC_RED_ALL:
+    case CUPYNUMERIC_RED_ANY:
+    case CUPYNUMERIC_RED_MAX:
+    case CUPYNUMERIC_RED_MIN:
+    case CUPYNUMERIC_RED_NANMAX:
+    case CUPYNUMERIC_RED_NANMIN:
+    case CUPYNUMERIC_RED_NANPROD:
+    case CUPYNUMERIC_RED_NANSUM:
+    case CUPYNUMERIC_RED_PROD:
+    case CUPYNUMERIC_RED_SUM:
+      return op_code;
+    case CUPYNUMERIC_RED_COUNT_NONZERO:
+    case CUPYNUMERIC_RED_SUM_SQUARES:
+      return CUPYNUMERIC_RED_SUM;
+    default:
+      return std::nullopt;
+  }
+}
+
+// Wraps NDArray::_perform_unary_reduction. `dtype` casts the input once
+// before the first pass, `where` masks the first pass and `initial`/`out`
+// apply to the last one, so a chained reduction sees each exactly once.
+static std::optional<NDArray> perform_unary_reduction(
+    CuPyNumericUnaryRedCode op_code, const NDArray& input,
+    std::vector<int32_t> axes, std::optional<legate::Type> dtype,
+    std::optional<NDArray> out, bool keepdims, std::optional<Scalar> initial,
+    std::optional<NDArray> where) {
+  const int32_t ndim = input.dim();
+  for (auto& ax : axes) ax = ax < 0 ? ax + ndim : ax;
+  std::sort(axes.begin(), axes.end());
+  axes.erase(std::unique(axes.begin(), axes.end()), axes.end());
+
+  if (axes.size() <= 1 || static_cast<int32_t>(axes.size()) == ndim) {
+    return input._perform_unary_reduction(static_cast<int32_t>(op_code), input,
+                                          axes, dtype, std::nullopt, out,
+                                          keepdims, {}, initial, where);
+  }
+
+  auto chained_code = chained_reduction_code(op_code);
+  if (!chained_code.has_value()) return std::nullopt;
+
+  // Reduce the highest axis first so the remaining axis ids stay valid when
+  // keepdims drops the reduced dimension.
+  NDArray partial = input;
+  CuPyNumericUnaryRedCode code = op_code;
+  for (auto it = axes.rbegin(); it != axes.rend(); ++it) {
+    const bool first = it == axes.rbegin();
+    const bool last = std::next(it) == axes.rend();
+    partial = partial._perform_unary_reduction(
+        static_cast<int32_t>(code), partial, {*it},
+        first ? dtype : std::nullopt, std::nullopt,
+        last ? out : std::nullopt, keepdims, {},
+        last ? initial : std::nullopt, first ? where : std::nullopt);
+    code = chained_code.value();
+  }
+  return partial;
 }
 
 CN_NDArray* nda_unary_reduction_axes(CuPyNumericUnaryRedCode op_code,
                                      CN_NDArray* input, const int32_t* axes,
-                                     int32_t num_axes, bool keepdims) {
+                                     int32_t num_axes, bool keepdims,
+                                     CN_Type dtype, const void* initial,
+                                     const CN_NDArray* where) {
   std::vector<int32_t> axis_vec(axes, axes + num_axes);
-  NDArray result = input->obj._perform_unary_reduction(
-      static_cast<int32_t>(op_code), input->obj, axis_vec,
-      std::nullopt,  // dtype
-      std::nullopt,  // res_dtype
-      std::nullopt,  // out
-      keepdims, {},  // args
-      std::nullopt,  // initial
-      std::nullopt   // where
-  );
-  return new CN_NDArray{NDArray(std::move(result))};
+  std::optional<legate::Type> acc_type = std::nullopt;
+  if (dtype.obj != input->obj.type()) acc_type = dtype.obj;
+  std::optional<Scalar> init = std::nullopt;
+  if (initial != nullptr) init = Scalar(dtype.obj, initial, true);
+  std::optional<NDArray> mask = std::nullopt;
+  if (where != nullptr) mask = use(where);
+
+  auto result = perform_unary_reduction(op_code, use(input), axis_vec,
+                                        acc_type, std::nullopt, keepdims, init,
+                                        mask);
+  if (!result.has_value()) return nullptr;
+  return new CN_NDArray{NDArray(std::move(result.value()))};
+}
+
+// Same as nda_unary_reduction_axes, but writes into `out`; the accumulation
+// type is out's element type. An empty axis list reduces over all axes.
+bool nda_unary_reduction_axes_out(CN_NDArray* out,
+                                  CuPyNumericUnaryRedCode op_code,
+                                  CN_NDArray* input, const int32_t* axes,
+                                  int32_t num_axes, bool keepdims,
+                                  const void* initial,
+                                  const CN_NDArray* where) {
+  std::vector<int32_t> axis_vec(axes, axes + num_axes);
+  const legate::Type out_type = out->obj.type();
+  std::optional<legate::Type> acc_type = std::nullopt;
+  if (out_type != input->obj.type()) acc_type = out_type;
+  std::optional<Scalar> init = std::nullopt;
+  if (initial != nullptr) init = Scalar(out_type, initial, true);
+  std::optional<NDArray> mask = std::nullopt;
+  if (where != nullptr) mask = use(where);
+
+  auto result = perform_unary_reduction(op_code, use(input), axis_vec,
+                                        acc_type, use(out), keepdims, init,
+                                        mask);
+  return result.has_value();
+}
+
+bool nda_multi_reduction(CN_NDArray* input, const int32_t* codes,
+                         int32_t num_codes, CN_NDArray** outs) {
+  std::vector<int32_t> code_vec(codes, codes + num_codes);
+  std::vector<NDArray> out_vec;
+  out_vec.reserve(num_codes);
+  for (int32_t i = 0; i < num_codes; ++i) out_vec.push_back(use(outs[i]));
+  return tasks::multi_reduction(use(input), code_vec, out_vec);
+}
+
+bool nda_fft(CN_NDArray* in, CN_NDArray* out, int32_t kind,
+             const int32_t* axes, int32_t num_axes, bool inverse) {
+  tasks::flush_deferred();
+  std::vector<int32_t> axis_vec(axes, axes + num_axes);
+  return tasks::fft(use(in), use(out), kind, axis_vec, inverse);
+}
+
+void nda_fft_plan_cache_stats(CN_FFTPlanCacheStats* out) {
+  const auto stats = tasks::fft_plan_cache_stats();
+  *out = CN_FFTPlanCacheStats{stats.hits, stats.misses, stats.evictions,
+                              stats.size};
+}
+
+void nda_clear_fft_plan_cache() { tasks::clear_fft_plan_cache(); }
+
+CN_NDArray* nda_convolve(CN_NDArray* arr, CN_NDArray* weights, int32_t mode,
+                         bool flip, int32_t method, CN_Type type,
+                         const void* value) {
+  tasks::flush_deferred();
+  Scalar s(type.obj, value, true);
+  auto result = tasks::convolve(use(arr), use(weights), mode, flip, method, s);
+  if (!result.has_value()) return nullptr;
+  return new CN_NDArray{std::move(result.value())};
+}
+
+bool nda_krylov(int32_t op, int32_t num_vecs, CN_NDArray** vecs,
+                int32_t num_coeffs, CN_NDArray** coeffs, CN_NDArray** dots,
+                int32_t* num_dots) {
+  tasks::flush_deferred();
+  std::vector<NDArray> vec_vec, coeff_vec, dot_vec;
+  for (int32_t i = 0; i < num_vecs; ++i) vec_vec.push_back(use(vecs[i]));
+  for (int32_t i = 0; i < num_coeffs; ++i) coeff_vec.push_back(use(coeffs[i]));
+  if (!tasks::krylov(op, vec_vec, coeff_vec, dot_vec)) return false;
+  for (std::size_t i = 0; i < dot_vec.size(); ++i)
+    dots[i] = new CN_NDArray{std::move(dot_vec[i])};
+  *num_dots = static_cast<int32_t>(dot_vec.size());
+  return true;
 }
 
 static legate::Slice to_legate_slice(const CN_Slice& slice) {
@@ -263,24 +802,26 @@ static legate::Slice to_legate_slice(const CN_Slice& slice) {
 
 CN_NDArray* nda_get_slice(CN_NDArray* arr, const CN_Slice* slices,
                           int32_t ndim) {
+  tasks::flush_deferred();
+  tasks::pin_spill(arr);
   switch (ndim) {
     case 1: {
       std::initializer_list<legate::Slice> slice_list = {
           to_legate_slice(slices[0])};
-      NDArray result = arr->obj[slice_list];
+      NDArray result = use(arr)[slice_list];
       return new CN_NDArray{NDArray(std::move(result))};
     }
     case 2: {
       std::initializer_list<legate::Slice> slice_list = {
           to_legate_slice(slices[0]), to_legate_slice(slices[1])};
-      NDArray result = arr->obj[slice_list];
+      NDArray result = use(arr)[slice_list];
       return new CN_NDArray{NDArray(std::move(result))};
     }
     case 3: {
       std::initializer_list<legate::Slice> slice_list = {
           to_legate_slice(slices[0]), to_legate_slice(slices[1]),
           to_legate_slice(slices[2])};
-      NDArray result = arr->obj[slice_list];
+      NDArray result = use(arr)[slice_list];
       return new CN_NDArray{NDArray(std::move(result))};
     }
     default:
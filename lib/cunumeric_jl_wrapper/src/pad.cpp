@@ -0,0 +1,200 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahhal <naderrahhal2026@u.northwestern.edu>
+ */
+
+#include "pad.h"
+
+#include <cupynumeric.h>
+#include <cupynumeric/runtime.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace tasks {
+namespace {
+
+// A stretch of the padded output along one dimension and where it comes
+// from in the source: `count` elements from `source` on, or the element
+// `source` repeated when `repeat` is set. `border` marks stretches outside
+// the source, which PAD_CONSTANT fills instead of copying.
+struct Piece {
+  int64_t target;
+  int64_t count;
+  int64_t source;
+  bool repeat;
+  bool border;
+};
+
+std::vector<Piece> pieces_along(int32_t mode, int64_t before, int64_t n,
+                                int64_t after) {
+  std::vector<Piece> pieces;
+  auto add_border = [&](int64_t start, int64_t count, int64_t edge) {
+    if (count == 0) return;
+    if (mode != PAD_WRAP) {
+      pieces.push_back(Piece{start, count, edge, true, true});
+      return;
+    }
+    // Wrapped stretches longer than the source take several copies.
+    for (int64_t i = start; i < start + count;) {
+      int64_t s = (i - before) % n;
+      if (s < 0) s += n;
+      const int64_t len = std::min(start + count - i, n - s);
+      pieces.push_back(Piece{i, len, s, false, true});
+      i += len;
+    }
+  };
+  add_border(0, before, 0);
+  pieces.push_back(Piece{before, n, 0, false, false});
+  add_border(before + n, after, n - 1);
+  return pieces;
+}
+
+// Output shape of joining `arrs` along `axis`, or nullopt when they differ
+// in type, rank, or any other extent.
+std::optional<std::vector<uint64_t>> joined_shape(
+    const std::vector<cupynumeric::NDArray>& arrs, int32_t axis) {
+  if (arrs.empty()) return std::nullopt;
+  const auto& first = arrs.front();
+  std::vector<uint64_t> shape(first.shape().begin(), first.shape().end());
+  shape[axis] = 0;
+  for (const auto& arr : arrs) {
+    if (arr.type() != first.type() || arr.dim() != first.dim())
+      return std::nullopt;
+    const auto& extents = arr.shape();
+    for (std::size_t d = 0; d < shape.size(); ++d)
+      if (d != static_cast<std::size_t>(axis) &&
+          extents[d] != first.shape()[d])
+        return std::nullopt;
+    shape[axis] += extents[axis];
+  }
+  return shape;
+}
+
+}  // namespace
+
+// The output is split into one region per combination of a before,
+// interior or after stretch in every dimension. The interior is a copy of
+// `arr`; each border region is a fill or a copy of the source elements it
+// repeats: a stride-0 view of the edge, or slices of the far side for wrap.
+// Every output element is written once, no tile is handed all of `arr`, and
+// copies and fills run wherever the data lives, GPUs included.
+std::optional<cupynumeric::NDArray> pad(const cupynumeric::NDArray& arr,
+                                        const std::vector<uint64_t>& widths,
+                                        int32_t mode,
+                                        const legate::Scalar& value) {
+  const int32_t dim = arr.dim();
+  if (mode < PAD_CONSTANT || mode > PAD_WRAP) return std::nullopt;
+  if (dim == 0 || widths.size() != 2 * static_cast<std::size_t>(dim))
+    return std::nullopt;
+  if (value.type() != arr.type()) return std::nullopt;
+
+  const auto& shape = arr.shape();
+  std::vector<uint64_t> out_shape(dim);
+  uint64_t volume = 1;
+  for (int32_t d = 0; d < dim; ++d) {
+    out_shape[d] = shape[d] + widths[2 * d] + widths[2 * d + 1];
+    volume *= out_shape[d];
+  }
+
+  auto cn_runtime = cupynumeric::CuPyNumericRuntime::get_runtime();
+  if (volume == 0) return cn_runtime->create_array(out_shape, arr.type());
+  // Nothing to repeat: only a constant border can grow an empty array.
+  if (arr.size() == 0) {
+    if (mode != PAD_CONSTANT) return std::nullopt;
+    return cupynumeric::full(out_shape, value);
+  }
+
+  std::vector<std::vector<Piece>> pieces(dim);
+  for (int32_t d = 0; d < dim; ++d)
+    pieces[d] = pieces_along(mode, static_cast<int64_t>(widths[2 * d]),
+                             static_cast<int64_t>(shape[d]),
+                             static_cast<int64_t>(widths[2 * d + 1]));
+
+  auto out = cn_runtime->create_array(out_shape, arr.type());
+  auto runtime = legate::Runtime::get_runtime();
+  std::vector<std::size_t> choice(dim, 0);
+  while (true) {
+    auto target = out.get_store();
+    auto source = arr.get_store();
+    bool border = false;
+    for (int32_t d = 0; d < dim; ++d) {
+      const auto& p = pieces[d][choice[d]];
+      target = target.slice(d, legate::Slice{p.target, p.target + p.count});
+      border = border || p.border;
+      if (p.repeat)
+        source = source.project(d, p.source).promote(d, p.count);
+      else
+        source = source.slice(d, legate::Slice{p.source, p.source + p.count});
+    }
+    if (mode == PAD_CONSTANT && border)
+      runtime->issue_fill(target, value);
+    else
+      runtime->issue_copy(target, source);
+
+    int32_t d = dim - 1;
+    for (; d >= 0; --d) {
+      if (++choice[d] < pieces[d].size()) break;
+      choice[d] = 0;
+    }
+    if (d < 0) break;
+  }
+  return out;
+}
+
+std::optional<cupynumeric::NDArray> concatenate(
+    const std::vector<cupynumeric::NDArray>& arrs, int32_t axis) {
+  if (arrs.empty()) return std::nullopt;
+  const int32_t dim = arrs.front().dim();
+  if (dim == 0 || axis < -dim || axis >= dim) return std::nullopt;
+  if (axis < 0) axis += dim;
+  auto shape = joined_shape(arrs, axis);
+  if (!shape) return std::nullopt;
+
+  auto out = cupynumeric::CuPyNumericRuntime::get_runtime()->create_array(
+      shape.value(), arrs.front().type());
+  auto store = out.get_store();
+  auto runtime = legate::Runtime::get_runtime();
+  int64_t offset = 0;
+  for (const auto& arr : arrs) {
+    const auto n = static_cast<int64_t>(arr.shape()[axis]);
+    if (n == 0) continue;
+    auto target = store.slice(axis, legate::Slice{offset, offset + n});
+    runtime->issue_copy(target, arr.get_store());
+    offset += n;
+  }
+  return out;
+}
+
+std::optional<cupynumeric::NDArray> stack(
+    const std::vector<cupynumeric::NDArray>& arrs, int32_t axis) {
+  if (arrs.empty()) return std::nullopt;
+  const int32_t dim = arrs.front().dim() + 1;
+  if (axis < -dim || axis >= dim) return std::nullopt;
+  if (axis < 0) axis += dim;
+  std::vector<cupynumeric::NDArray> promoted;
+  promoted.reserve(arrs.size());
+  for (const auto& arr : arrs) {
+    if (arr.dim() + 1 != dim) return std::nullopt;
+    promoted.push_back(cupynumeric::as_array(arr.get_store().promote(axis, 1)));
+  }
+  return concatenate(promoted, axis);
+}
+
+}  // namespace tasks
@@ -0,0 +1,109 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahhal <naderrahhal2026@u.northwestern.edu>
+ */
+
+#include "scalar_cache.h"
+
+#include <cupynumeric.h>
+#include <cupynumeric/runtime.h>
+
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace tasks {
+namespace {
+
+constexpr uint64_t DEFAULT_CAPACITY = 256;
+
+struct ScalarCache {
+  using Entry = std::pair<std::string, legate::LogicalStore>;
+  // Most recently used first.
+  std::list<Entry> entries;
+  std::unordered_map<std::string, std::list<Entry>::iterator> index;
+  ScalarCacheStats stats{0, 0, 0, 0, DEFAULT_CAPACITY};
+
+  void evict_to(uint64_t size) {
+    while (entries.size() > size) {
+      index.erase(entries.back().first);
+      entries.pop_back();
+      ++stats.evictions;
+    }
+    stats.size = entries.size();
+  }
+};
+
+ScalarCache& cache() {
+  static ScalarCache c;
+  return c;
+}
+
+// Type code followed by the value bytes. Scalars reaching the C API are
+// primitive, so the code and size pin down the type.
+std::string cache_key(const legate::Scalar& value) {
+  const auto code = static_cast<int32_t>(value.type().code());
+  std::string key(reinterpret_cast<const char*>(&code), sizeof(code));
+  key.append(static_cast<const char*>(value.ptr()), value.size());
+  return key;
+}
+
+legate::LogicalStore make_store(const legate::Scalar& value) {
+  auto runtime = cupynumeric::CuPyNumericRuntime::get_runtime();
+  return runtime->create_scalar_store(value);
+}
+
+}  // namespace
+
+legate::LogicalStore interned_scalar_store(const legate::Scalar& value) {
+  auto& c = cache();
+  if (c.stats.capacity == 0 || !value.type().is_primitive()) {
+    ++c.stats.misses;
+    return make_store(value);
+  }
+  auto key = cache_key(value);
+  if (auto it = c.index.find(key); it != c.index.end()) {
+    ++c.stats.hits;
+    c.entries.splice(c.entries.begin(), c.entries, it->second);
+    return it->second->second;
+  }
+  ++c.stats.misses;
+  auto store = make_store(value);
+  c.entries.emplace_front(key, store);
+  c.index.emplace(std::move(key), c.entries.begin());
+  c.evict_to(c.stats.capacity);
+  return store;
+}
+
+ScalarCacheStats scalar_cache_stats() { return cache().stats; }
+
+void set_scalar_cache_capacity(uint64_t capacity) {
+  auto& c = cache();
+  c.stats.capacity = capacity;
+  c.evict_to(capacity);
+}
+
+void clear_scalar_cache() {
+  auto& c = cache();
+  c.index.clear();
+  c.entries.clear();
+  c.stats.size = 0;
+}
+
+}  // namespace tasks
@@ -0,0 +1,464 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahhal <naderrahhal2026@u.northwestern.edu>
+ */
+
+#include "scan.h"
+
+#include <cupynumeric.h>
+#include <cupynumeric/runtime.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "half.h"
+
+namespace tasks {
+namespace {
+
+template <typename T>
+constexpr bool is_complex_v =
+    std::is_same_v<T, legate::type_of_t<legate::Type::Code::COMPLEX64>> ||
+    std::is_same_v<T, legate::type_of_t<legate::Type::Code::COMPLEX128>>;
+
+// FLOAT16 is stored as Half and scanned in float; bool only for products.
+template <typename T>
+constexpr bool is_scannable_v =
+    std::is_arithmetic_v<T> || is_complex_v<T> || std::is_same_v<T, Half>;
+
+template <typename T>
+using compute_t = std::conditional_t<std::is_same_v<T, Half>, float, T>;
+
+template <typename T>
+compute_t<T> to_compute(T x) {
+  if constexpr (std::is_same_v<T, Half>) {
+    return half_to_float(x);
+  } else {
+    return x;
+  }
+}
+
+template <typename T>
+T from_compute(compute_t<T> x) {
+  if constexpr (std::is_same_v<T, Half>) {
+    return float_to_half(x);
+  } else {
+    return x;
+  }
+}
+
+template <typename T, int32_t OP>
+struct Op {
+  static constexpr bool PROD = OP == SCAN_PROD || OP == SCAN_NANPROD;
+  static constexpr bool SKIP_NAN =
+      (OP == SCAN_NANSUM || OP == SCAN_NANPROD) && !std::is_integral_v<T>;
+
+  static T identity() { return PROD ? T(1) : T(0); }
+
+  static T combine(T acc, T x) {
+    if constexpr (std::is_same_v<T, bool>) {
+      return PROD ? acc && x : acc || x;
+    } else if constexpr (PROD) {
+      return acc * x;
+    } else {
+      return acc + x;
+    }
+  }
+
+  // x != x only holds for NaN; written as a select so the loop vectorizes.
+  static T apply(T acc, T x) {
+    if constexpr (SKIP_NAN) x = x != x ? identity() : x;
+    return combine(acc, x);
+  }
+};
+
+template <typename F>
+void dispatch_op(int32_t op, F&& f) {
+  switch (op) {
+    case SCAN_SUM:
+      return f(std::integral_constant<int32_t, SCAN_SUM>{});
+    case SCAN_PROD:
+      return f(std::integral_constant<int32_t, SCAN_PROD>{});
+    case SCAN_NANSUM:
+      return f(std::integral_constant<int32_t, SCAN_NANSUM>{});
+    case SCAN_NANPROD:
+      return f(std::integral_constant<int32_t, SCAN_NANPROD>{});
+    default:
+      throw std::invalid_argument("scan: unknown op");
+  }
+}
+
+// Columns of the inner dims scanned together; the running values stay in L1.
+constexpr int64_t BLOCK = 256;
+
+// A dense row-major tile seen as (outer, n, inner) around the scan axis.
+template <int DIM>
+struct Layout {
+  int64_t outer = 1;
+  int64_t n = 1;
+  int64_t inner = 1;
+
+  Layout(const legate::Rect<DIM>& rect, int32_t axis) {
+    for (int d = 0; d < DIM; ++d) {
+      const int64_t extent = rect.hi[d] - rect.lo[d] + 1;
+      if (d < axis) outer *= extent;
+      if (d == axis) n = extent;
+      if (d > axis) inner *= extent;
+    }
+  }
+};
+
+// The first point of every line along `axis`, in row-major order.
+template <int DIM>
+std::vector<legate::Point<DIM>> line_starts(const legate::Rect<DIM>& rect,
+                                            int32_t axis) {
+  legate::Rect<DIM> starts = rect;
+  starts.hi[axis] = rect.lo[axis];
+  std::vector<legate::Point<DIM>> lines;
+  lines.reserve(starts.volume());
+  for (legate::PointInRectIterator<DIM> it(starts, false); it.valid(); ++it)
+    lines.push_back(*it);
+  return lines;
+}
+
+template <typename F>
+void parallel_for(int64_t count, bool openmp, F&& f) {
+  if (openmp) {
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < count; ++i) f(i);
+  } else {
+    for (int64_t i = 0; i < count; ++i) f(i);
+  }
+}
+
+// T is the element type in memory and V = compute_t<T> the running type.
+// Half lines are widened a block of columns at a time and narrowed on store;
+// their line totals are kept in float.
+template <typename T, int32_t OP, int DIM>
+void scan_tile(legate::TaskContext& context, int32_t axis, bool inclusive,
+               bool openmp) {
+  using V = compute_t<T>;
+  using O = Op<V, OP>;
+  constexpr bool HALF = std::is_same_v<T, Half>;
+  // Half is not Legate's C++ type for FLOAT16, so its accessors are unchecked.
+  constexpr bool CHECKED = !HALF;
+  auto output = context.output(0).data();
+  const auto rect = output.shape<DIM>();
+  if (rect.empty()) return;
+  auto in = context.input(0).data().read_accessor<T, DIM, CHECKED>(rect);
+  auto out = output.write_accessor<T, DIM, CHECKED>(rect);
+
+  // Line totals, one slab per tile, when the axis is split across tiles.
+  legate::Rect<DIM> trect;
+  std::optional<legate::AccessorWO<V, DIM>> totals;
+  if (context.num_outputs() > 1) {
+    auto store = context.output(1).data();
+    trect = store.shape<DIM>();
+    totals = store.write_accessor<V, DIM>(trect);
+  }
+
+  const bool dense = in.accessor.is_dense_row_major(rect) &&
+                     out.accessor.is_dense_row_major(rect) &&
+                     (!totals || totals->accessor.is_dense_row_major(trect));
+  if (dense) {
+    // Scan a block of inner columns at a time, row after row along the axis,
+    // so the innermost loop is contiguous and independent across columns.
+    const Layout<DIM> L(rect, axis);
+    const T* x = in.ptr(rect.lo);
+    T* y = out.ptr(rect.lo);
+    V* t = totals ? totals->ptr(trect.lo) : nullptr;
+    const int64_t num_blocks = (L.inner + BLOCK - 1) / BLOCK;
+    parallel_for(L.outer * num_blocks, openmp, [&](int64_t b) {
+      const int64_t o = b / num_blocks;
+      const int64_t j0 = (b % num_blocks) * BLOCK;
+      const int64_t len = std::min(BLOCK, L.inner - j0);
+      V run[BLOCK];
+      for (int64_t j = 0; j < len; ++j) run[j] = O::identity();
+      for (int64_t i = 0; i < L.n; ++i) {
+        const int64_t row = (o * L.n + i) * L.inner + j0;
+        const V* xi;
+        V* yi;
+        if constexpr (HALF) {
+          thread_local std::vector<float> wide(2 * BLOCK);
+          widen(x + row, wide.data(), len);
+          xi = wide.data();
+          yi = wide.data() + BLOCK;
+        } else {
+          xi = x + row;
+          yi = y + row;
+        }
+        if (inclusive) {
+#pragma omp simd
+          for (int64_t j = 0; j < len; ++j) {
+            run[j] = O::apply(run[j], xi[j]);
+            yi[j] = run[j];
+          }
+        } else {
+#pragma omp simd
+          for (int64_t j = 0; j < len; ++j) {
+            const V v = xi[j];
+            yi[j] = run[j];
+            run[j] = O::apply(run[j], v);
+          }
+        }
+        if constexpr (HALF) narrow(yi, y + row, len);
+      }
+      if (t != nullptr)
+        for (int64_t j = 0; j < len; ++j) t[o * L.inner + j0 + j] = run[j];
+    });
+    return;
+  }
+
+  // Strided views: one line at a time through the accessors.
+  const auto lines = line_starts(rect, axis);
+  const int64_t n = rect.hi[axis] - rect.lo[axis] + 1;
+  parallel_for(static_cast<int64_t>(lines.size()), openmp, [&](int64_t l) {
+    auto p = lines[l];
+    V run = O::identity();
+    for (int64_t i = 0; i < n; ++i, ++p[axis]) {
+      const V v = to_compute(in[p]);
+      if (inclusive) {
+        run = O::apply(run, v);
+        out[p] = from_compute<T>(run);
+      } else {
+        out[p] = from_compute<T>(run);
+        run = O::apply(run, v);
+      }
+    }
+    if (totals) {
+      auto q = lines[l];
+      q[axis] = trect.lo[axis];
+      (*totals)[q] = run;
+    }
+  });
+}
+
+template <typename T, int32_t OP, int DIM>
+void carry_tile(legate::TaskContext& context, int32_t axis, int64_t tile,
+                bool openmp) {
+  using V = compute_t<T>;
+  using O = Op<V, OP>;
+  constexpr bool CHECKED = !std::is_same_v<T, Half>;
+  auto output = context.output(0).data();
+  const auto rect = output.shape<DIM>();
+  if (rect.empty()) return;
+  const int64_t index = rect.lo[axis] / tile;
+  if (index == 0) return;
+
+  auto totals_store = context.input(1).data();
+  auto totals = totals_store.read_accessor<V, DIM>(totals_store.shape<DIM>());
+  auto out = output.read_write_accessor<T, DIM, CHECKED>(rect);
+
+  // Carry of each line: the totals of every earlier tile.
+  const auto lines = line_starts(rect, axis);
+  // Not std::vector, which packs bool.
+  std::unique_ptr<V[]> carry(new V[lines.size()]);
+  parallel_for(static_cast<int64_t>(lines.size()), openmp, [&](int64_t l) {
+    auto q = lines[l];
+    V c = O::identity();
+    for (q[axis] = 0; q[axis] < index; ++q[axis]) c = O::combine(c, totals[q]);
+    carry[l] = c;
+  });
+
+  if (out.accessor.is_dense_row_major(rect)) {
+    const Layout<DIM> L(rect, axis);
+    T* y = out.ptr(rect.lo);
+    parallel_for(L.outer * L.n, openmp, [&](int64_t r) {
+      const V* c = carry.get() + (r / L.n) * L.inner;
+      T* yr = y + r * L.inner;
+#pragma omp simd
+      for (int64_t j = 0; j < L.inner; ++j)
+        yr[j] = from_compute<T>(O::combine(c[j], to_compute(yr[j])));
+    });
+    return;
+  }
+
+  const int64_t n = rect.hi[axis] - rect.lo[axis] + 1;
+  parallel_for(static_cast<int64_t>(lines.size()), openmp, [&](int64_t l) {
+    auto p = lines[l];
+    for (int64_t i = 0; i < n; ++i, ++p[axis])
+      out[p] = from_compute<T>(O::combine(carry[l], to_compute(out[p])));
+  });
+}
+
+struct ScanTileFn {
+  template <legate::Type::Code CODE, int DIM>
+  void operator()(legate::TaskContext& context, bool openmp) {
+    using T = std::conditional_t<CODE == legate::Type::Code::FLOAT16, Half,
+                                 legate::type_of_t<CODE>>;
+    if constexpr (is_scannable_v<T>) {
+      const auto axis = context.scalar(1).value<int32_t>();
+      const auto inclusive = context.scalar(2).value<bool>();
+      dispatch_op(context.scalar(0).value<int32_t>(), [&](auto op) {
+        scan_tile<T, decltype(op)::value, DIM>(context, axis, inclusive,
+                                               openmp);
+      });
+    } else {
+      throw std::invalid_argument("scan: unsupported type");
+    }
+  }
+};
+
+struct CarryTileFn {
+  template <legate::Type::Code CODE, int DIM>
+  void operator()(legate::TaskContext& context, bool openmp) {
+    using T = std::conditional_t<CODE == legate::Type::Code::FLOAT16, Half,
+                                 legate::type_of_t<CODE>>;
+    if constexpr (is_scannable_v<T>) {
+      const auto axis = context.scalar(1).value<int32_t>();
+      const auto tile = context.scalar(2).value<int64_t>();
+      dispatch_op(context.scalar(0).value<int32_t>(), [&](auto op) {
+        carry_tile<T, decltype(op)::value, DIM>(context, axis, tile, openmp);
+      });
+    } else {
+      throw std::invalid_argument("scan: unsupported type");
+    }
+  }
+};
+
+template <typename Fn>
+void scan_variant(legate::TaskContext context, bool openmp) {
+  auto out = context.output(0).data();
+  legate::double_dispatch(out.dim(), out.type().code(), Fn{}, context,
+                          openmp);
+}
+
+bool is_scannable_type(legate::Type::Code code, int32_t op) {
+  switch (code) {
+    case legate::Type::Code::BOOL:
+      return op == SCAN_PROD || op == SCAN_NANPROD;
+    case legate::Type::Code::INT8:
+    case legate::Type::Code::INT16:
+    case legate::Type::Code::INT32:
+    case legate::Type::Code::INT64:
+    case legate::Type::Code::UINT8:
+    case legate::Type::Code::UINT16:
+    case legate::Type::Code::UINT32:
+    case legate::Type::Code::UINT64:
+    case legate::Type::Code::FLOAT16:
+    case legate::Type::Code::FLOAT32:
+    case legate::Type::Code::FLOAT64:
+    case legate::Type::Code::COMPLEX64:
+    case legate::Type::Code::COMPLEX128:
+      return true;
+    default:
+      return false;
+  }
+}
+
+}  // namespace
+
+void ScanTask::cpu_variant(legate::TaskContext context) {
+  scan_variant<ScanTileFn>(context, false);
+}
+
+void ScanCarryTask::cpu_variant(legate::TaskContext context) {
+  scan_variant<CarryTileFn>(context, false);
+}
+
+#if LEGATE_DEFINED(LEGATE_USE_OPENMP)
+void ScanTask::omp_variant(legate::TaskContext context) {
+  scan_variant<ScanTileFn>(context, true);
+}
+
+void ScanCarryTask::omp_variant(legate::TaskContext context) {
+  scan_variant<CarryTileFn>(context, true);
+}
+#endif
+
+bool scan(cupynumeric::NDArray& out, int32_t op,
+          const cupynumeric::NDArray& input, int32_t axis, bool inclusive) {
+  if (op < SCAN_SUM || op > SCAN_NANPROD) return false;
+  const int32_t dim = input.dim();
+  if (dim == 0 || axis < -dim || axis >= dim) return false;
+  if (axis < 0) axis += dim;
+  if (out.shape() != input.shape() || out.type() != input.type()) return false;
+  if (!is_scannable_type(input.type().code(), op)) return false;
+  if (input.size() == 0) return true;
+
+  auto runtime = legate::Runtime::get_runtime();
+  auto library = cupynumeric::CuPyNumericRuntime::get_runtime()->get_library();
+
+  const auto& shape = input.shape();
+  std::vector<uint64_t> extents(shape.begin(), shape.end());
+  const uint64_t num_procs =
+      std::max<uint64_t>(1, runtime->get_machine().count());
+
+  // Prefer tiling the longest other axis: when it alone gives every
+  // processor a tile, each line stays inside one tile and a single pass is
+  // enough. Otherwise split the scan axis and propagate carries.
+  std::size_t split = axis;
+  for (std::size_t d = 0; d < extents.size(); ++d)
+    if (d != static_cast<std::size_t>(axis) && extents[d] >= num_procs &&
+        (split == static_cast<std::size_t>(axis) ||
+         extents[d] > extents[split]))
+      split = d;
+
+  std::vector<uint64_t> tile = extents;
+  tile[split] = (extents[split] + num_procs - 1) / num_procs;
+  const uint64_t num_tiles = (extents[split] + tile[split] - 1) / tile[split];
+  const bool carry = split == static_cast<std::size_t>(axis) && num_tiles > 1;
+
+  std::vector<legate::SymbolicExpr> proj(extents.size(), legate::constant(0));
+  proj[split] = legate::dimension(0);
+  const legate::SymbolicPoint projection{proj};
+  const legate::tuple<uint64_t> launch{num_tiles};
+  auto out_part = out.get_store().partition_by_tiling(tile);
+
+  auto task =
+      runtime->create_task(library, legate::LocalTaskID{SCAN_TASK}, launch);
+  task.add_input(input.get_store().partition_by_tiling(tile), projection);
+  task.add_output(out_part, projection);
+  std::optional<legate::LogicalStore> totals;
+  if (carry) {
+    std::vector<uint64_t> totals_shape = extents;
+    totals_shape[axis] = num_tiles;
+    // Half totals are kept in float, the type the tiles scan in.
+    const auto totals_type = input.type().code() == legate::Type::Code::FLOAT16
+                                 ? legate::float32()
+                                 : input.type();
+    totals = runtime->create_store(
+        legate::Shape{legate::tuple<uint64_t>{totals_shape}}, totals_type);
+    std::vector<uint64_t> slab = extents;
+    slab[axis] = 1;
+    task.add_output(totals->partition_by_tiling(slab), projection);
+  }
+  task.add_scalar_arg(legate::Scalar{op});
+  task.add_scalar_arg(legate::Scalar{axis});
+  task.add_scalar_arg(legate::Scalar{inclusive});
+  runtime->submit(std::move(task));
+  if (!carry) return true;
+
+  auto fix = runtime->create_task(library, legate::LocalTaskID{SCAN_CARRY_TASK},
+                                  launch);
+  fix.add_input(out_part, projection);
+  fix.add_input(totals.value());
+  fix.add_output(out_part, projection);
+  fix.add_scalar_arg(legate::Scalar{op});
+  fix.add_scalar_arg(legate::Scalar{axis});
+  fix.add_scalar_arg(legate::Scalar{static_cast<int64_t>(tile[axis])});
+  runtime->submit(std::move(fix));
+  return true;
+}
+
+}  // namespace tasks
@@ -0,0 +1,358 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahhal <naderrahhal2026@u.northwestern.edu>
+ */
+
+#include "sort.h"
+
+#include <cupynumeric.h>
+#include <cupynumeric/cupynumeric_c.h>
+#include <cupynumeric/operators.h>
+#include <cupynumeric/runtime.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace tasks {
+namespace {
+
+template <typename T>
+struct Candidate {
+  T value;
+  int64_t index;
+};
+
+// `a` ranks ahead of `b`. NaN counts as the largest value.
+template <typename T>
+struct Better {
+  bool largest;
+
+  bool ranks_before(T a, T b) const {
+    if constexpr (std::is_floating_point_v<T>) {
+      if (std::isnan(a) || std::isnan(b))
+        return largest ? (std::isnan(a) && !std::isnan(b))
+                       : (std::isnan(b) && !std::isnan(a));
+    }
+    return largest ? a > b : a < b;
+  }
+
+  bool operator()(const Candidate<T>& a, const Candidate<T>& b) const {
+    if (ranks_before(a.value, b.value)) return true;
+    if (ranks_before(b.value, a.value)) return false;
+    return a.index < b.index;
+  }
+};
+
+// Bounded heap with the worst kept candidate on top.
+template <typename T>
+struct TopKHeap {
+  std::size_t k;
+  Better<T> better;
+  std::vector<Candidate<T>> heap;
+
+  void offer(const Candidate<T>& c) {
+    if (heap.size() < k) {
+      heap.push_back(c);
+      std::push_heap(heap.begin(), heap.end(), better);
+    } else if (better(c, heap.front())) {
+      std::pop_heap(heap.begin(), heap.end(), better);
+      heap.back() = c;
+      std::push_heap(heap.begin(), heap.end(), better);
+    }
+  }
+
+  // Best first.
+  std::vector<Candidate<T>> take() {
+    std::sort_heap(heap.begin(), heap.end(), better);
+    return std::move(heap);
+  }
+};
+
+// Threads each fill a heap over a slab of the tile's first dim.
+constexpr int64_t NUM_SLABS = 64;
+
+struct TopKTileFn {
+  template <legate::Type::Code CODE, int DIM>
+  void operator()(legate::TaskContext& context, bool openmp) {
+    using T = legate::type_of_t<CODE>;
+    if constexpr (std::is_arithmetic_v<T>) {
+      auto input = context.input(0).data();
+      auto values = context.output(0).data();
+      auto indices = context.output(1).data();
+      const auto k = context.scalar(0).value<int64_t>();
+      const bool largest = context.scalar(1).value<bool>();
+      const auto shape = context.scalar(2).values<uint64_t>();
+
+      const auto out_rect = values.shape<2>();
+      auto val_acc = values.write_accessor<T, 2>(out_rect);
+      auto idx_acc = indices.write_accessor<int64_t, 2>(out_rect);
+      const auto row = out_rect.lo[0];
+
+      const auto rect = input.shape<DIM>();
+      std::vector<Candidate<T>> best;
+      if (!rect.empty()) {
+        auto acc = input.read_accessor<T, DIM>(rect);
+        // Column-major, as Julia's linear indices.
+        std::array<int64_t, DIM> strides;
+        int64_t s = 1;
+        for (int d = 0; d < DIM; ++d) {
+          strides[d] = s;
+          s *= static_cast<int64_t>(shape[d]);
+        }
+
+        const int64_t extent = rect.hi[0] - rect.lo[0] + 1;
+        const int64_t num_slabs = openmp ? std::min(NUM_SLABS, extent) : 1;
+        const int64_t slab = (extent + num_slabs - 1) / num_slabs;
+        std::vector<TopKHeap<T>> heaps(
+            num_slabs, TopKHeap<T>{static_cast<std::size_t>(k), {largest}, {}});
+        auto scan = [&](int64_t i) {
+          legate::Rect<DIM> sub = rect;
+          sub.lo[0] = rect.lo[0] + i * slab;
+          sub.hi[0] = std::min<int64_t>(rect.hi[0], sub.lo[0] + slab - 1);
+          for (legate::PointInRectIterator<DIM> it(sub); it.valid(); ++it) {
+            int64_t flat = 0;
+            for (int d = 0; d < DIM; ++d) flat += (*it)[d] * strides[d];
+            heaps[i].offer({acc[*it], flat});
+          }
+        };
+        if (openmp) {
+#pragma omp parallel for schedule(static)
+          for (int64_t i = 0; i < num_slabs; ++i) scan(i);
+        } else {
+          scan(0);
+        }
+
+        TopKHeap<T> merged{static_cast<std::size_t>(k), {largest}, {}};
+        for (auto& h : heaps)
+          for (const auto& c : h.heap) merged.offer(c);
+        best = merged.take();
+      }
+
+      for (int64_t j = 0; j < k; ++j) {
+        const bool valid = j < static_cast<int64_t>(best.size());
+        val_acc[{row, j}] = valid ? best[j].value : T{};
+        idx_acc[{row, j}] = valid ? best[j].index : -1;
+      }
+    } else {
+      throw std::invalid_argument("topk: unsupported type");
+    }
+  }
+};
+
+struct TopKMergeFn {
+  template <legate::Type::Code CODE>
+  void operator()(legate::TaskContext& context) {
+    using T = legate::type_of_t<CODE>;
+    if constexpr (std::is_arithmetic_v<T>) {
+      auto partial_vals = context.input(0).data();
+      auto partial_idx = context.input(1).data();
+      const auto k = context.scalar(0).value<int64_t>();
+      const bool largest = context.scalar(1).value<bool>();
+
+      const auto rect = partial_vals.shape<2>();
+      auto vals = partial_vals.read_accessor<T, 2>(rect);
+      auto idx = partial_idx.read_accessor<int64_t, 2>(rect);
+      TopKHeap<T> heap{static_cast<std::size_t>(k), {largest}, {}};
+      for (auto r = rect.lo[0]; r <= rect.hi[0]; ++r)
+        for (auto c = rect.lo[1]; c <= rect.hi[1]; ++c)
+          if (idx[{r, c}] >= 0) heap.offer({vals[{r, c}], idx[{r, c}]});
+      const auto best = heap.take();
+
+      auto out_vals = context.output(0).data().write_accessor<T, 1>();
+      auto out_idx = context.output(1).data().write_accessor<int64_t, 1>();
+      for (std::size_t j = 0; j < best.size(); ++j) {
+        out_vals[j] = best[j].value;
+        out_idx[j] = best[j].index;
+      }
+    } else {
+      throw std::invalid_argument("topk: unsupported type");
+    }
+  }
+};
+
+template <bool OPENMP>
+void topk_tile(legate::TaskContext context) {
+  auto input = context.input(0).data();
+  legate::double_dispatch(input.dim(), input.type().code(), TopKTileFn{},
+                          context, OPENMP);
+}
+
+std::optional<int32_t> normalize_axis(int32_t axis, int32_t ndim) {
+  if (axis < -ndim || axis >= ndim) return std::nullopt;
+  return axis < 0 ? axis + ndim : axis;
+}
+
+}  // namespace
+
+void TopKTask::cpu_variant(legate::TaskContext context) {
+  topk_tile<false>(context);
+}
+
+#if LEGATE_DEFINED(LEGATE_USE_OPENMP)
+void TopKTask::omp_variant(legate::TaskContext context) {
+  topk_tile<true>(context);
+}
+#endif
+
+void TopKMergeTask::cpu_variant(legate::TaskContext context) {
+  legate::type_dispatch(context.input(0).type().code(), TopKMergeFn{},
+                        context);
+}
+
+// Descending sorts run ascending on the input reversed along the axis and
+// reverse the result back. Equal keys then keep their original order, as
+// with a descending comparator, instead of coming out reversed.
+std::optional<cupynumeric::NDArray> sort(const cupynumeric::NDArray& input,
+                                         std::optional<int32_t> axis,
+                                         bool stable, bool descending) {
+  if (axis.has_value()) {
+    axis = normalize_axis(axis.value(), input.dim());
+    if (!axis.has_value()) return std::nullopt;
+  }
+  const char* kind = stable ? "stable" : "quicksort";
+  if (!descending) return cupynumeric::sort(input, axis, kind);
+  const auto source = axis.has_value() ? input : cupynumeric::ravel(input);
+  const int32_t ax = axis.value_or(0);
+  const std::vector<int32_t> axes{ax};
+  auto ascending = cupynumeric::sort(cupynumeric::flip(source, axes), ax, kind);
+  return cupynumeric::flip(ascending, axes);
+}
+
+std::optional<cupynumeric::NDArray> argsort(const cupynumeric::NDArray& input,
+                                            std::optional<int32_t> axis,
+                                            bool stable, bool descending) {
+  if (axis.has_value()) {
+    axis = normalize_axis(axis.value(), input.dim());
+    if (!axis.has_value()) return std::nullopt;
+  }
+  const char* kind = stable ? "stable" : "quicksort";
+  if (!descending) return cupynumeric::argsort(input, axis, kind);
+  const auto source = axis.has_value() ? input : cupynumeric::ravel(input);
+  const int32_t ax = axis.value_or(0);
+  const std::vector<int32_t> axes{ax};
+  auto ascending =
+      cupynumeric::argsort(cupynumeric::flip(source, axes), ax, kind);
+  auto order = cupynumeric::flip(ascending, axes);
+  // Positions in the reversed input map back to n - 1 - i.
+  const auto last = static_cast<int64_t>(source.shape()[ax]) - 1;
+  auto result = cupynumeric::CuPyNumericRuntime::get_runtime()->create_array(
+      order.shape(), order.type());
+  result.binary_op(CUPYNUMERIC_BINOP_SUBTRACT,
+                   cupynumeric::full(order.shape(), legate::Scalar{last}),
+                   order);
+  return result;
+}
+
+// A sort along the axis satisfies the partition contract, and the
+// distributed sort already splits the work across processors. This is a full
+// O(n log n) sort, not an O(n) selection.
+std::optional<cupynumeric::NDArray> partition(
+    const cupynumeric::NDArray& input, int64_t kth, int32_t axis) {
+  const auto ax = normalize_axis(axis, input.dim());
+  if (!ax.has_value()) return std::nullopt;
+  const auto n = static_cast<int64_t>(input.shape()[ax.value()]);
+  if (kth < -n || kth >= n) return std::nullopt;
+  return sort(input, ax, false, false);
+}
+
+std::optional<cupynumeric::NDArray> argpartition(
+    const cupynumeric::NDArray& input, int64_t kth, int32_t axis) {
+  const auto ax = normalize_axis(axis, input.dim());
+  if (!ax.has_value()) return std::nullopt;
+  const auto n = static_cast<int64_t>(input.shape()[ax.value()]);
+  if (kth < -n || kth >= n) return std::nullopt;
+  return argsort(input, ax, false, false);
+}
+
+bool topk(const cupynumeric::NDArray& input, int64_t k, bool largest,
+          cupynumeric::NDArray& values, cupynumeric::NDArray& indices) {
+  switch (input.type().code()) {
+    case legate::Type::Code::FLOAT16:
+    case legate::Type::Code::COMPLEX64:
+    case legate::Type::Code::COMPLEX128:
+      return false;
+    default:
+      break;
+  }
+  if (input.dim() == 0 || k < 1 || k > static_cast<int64_t>(input.size()))
+    return false;
+  if (values.dim() != 1 || indices.dim() != 1 ||
+      values.shape()[0] != static_cast<uint64_t>(k) ||
+      indices.shape()[0] != static_cast<uint64_t>(k) ||
+      values.type() != input.type() || indices.type() != legate::int64())
+    return false;
+
+  auto runtime = legate::Runtime::get_runtime();
+  auto library = cupynumeric::CuPyNumericRuntime::get_runtime()->get_library();
+
+  // Same tiling as multi_reduction: the longest axis, one tile per
+  // processor, one row of k candidates per tile.
+  const auto& shape = input.shape();
+  std::vector<uint64_t> extents(shape.begin(), shape.end());
+  const std::size_t split = static_cast<std::size_t>(std::distance(
+      extents.begin(), std::max_element(extents.begin(), extents.end())));
+  const uint64_t num_procs =
+      std::max<uint64_t>(1, runtime->get_machine().count());
+  std::vector<uint64_t> tile = extents;
+  tile[split] = (extents[split] + num_procs - 1) / num_procs;
+  const uint64_t num_tiles = (extents[split] + tile[split] - 1) / tile[split];
+
+  const auto uk = static_cast<uint64_t>(k);
+  auto partial_vals =
+      runtime->create_store(legate::Shape{num_tiles, uk}, input.type());
+  auto partial_idx =
+      runtime->create_store(legate::Shape{num_tiles, uk}, legate::int64());
+
+  std::vector<legate::SymbolicExpr> input_proj(extents.size(),
+                                               legate::constant(0));
+  input_proj[split] = legate::dimension(0);
+  const legate::SymbolicPoint row_proj{legate::dimension(0),
+                                       legate::constant(0)};
+
+  auto task =
+      runtime->create_task(library, legate::LocalTaskID{TOPK_TASK},
+                           legate::tuple<uint64_t>{num_tiles});
+  task.add_input(input.get_store().partition_by_tiling(tile),
+                 legate::SymbolicPoint{std::move(input_proj)});
+  task.add_output(partial_vals.partition_by_tiling({1, uk}), row_proj);
+  task.add_output(partial_idx.partition_by_tiling({1, uk}), row_proj);
+  task.add_scalar_arg(legate::Scalar{k});
+  task.add_scalar_arg(legate::Scalar{largest});
+  task.add_scalar_arg(legate::Scalar{extents});
+  runtime->submit(std::move(task));
+
+  auto merge =
+      runtime->create_task(library, legate::LocalTaskID{TOPK_MERGE_TASK});
+  auto vals_var = merge.add_input(partial_vals);
+  auto idx_var = merge.add_input(partial_idx);
+  auto out_vals = merge.add_output(values.get_store());
+  auto out_idx = merge.add_output(indices.get_store());
+  for (const auto& v : {vals_var, idx_var, out_vals, out_idx})
+    merge.add_constraint(legate::broadcast(v));
+  merge.add_scalar_arg(legate::Scalar{k});
+  merge.add_scalar_arg(legate::Scalar{largest});
+  runtime->submit(std::move(merge));
+  return true;
+}
+
+}  // namespace tasks
@@ -0,0 +1,264 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahhal <naderrahhal2026@u.northwestern.edu>
+ */
+
+#include "sparse.h"
+
+#include <cupynumeric.h>
+#include <cupynumeric/runtime.h>
+
+#include <complex>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace tasks {
+namespace {
+
+using Range = legate::Rect<1>;
+
+template <typename Fn>
+void for_rows(int64_t lo, int64_t hi, bool openmp, Fn&& row) {
+  if (openmp) {
+    // Row lengths vary, so hand out small chunks.
+#pragma omp parallel for schedule(dynamic, 256)
+    for (int64_t i = lo; i <= hi; ++i) row(i);
+  } else {
+    for (int64_t i = lo; i <= hi; ++i) row(i);
+  }
+}
+
+template <typename T>
+struct SpMVKernel {
+  void operator()(legate::TaskContext& context, bool openmp) const {
+    auto y = context.output(0).data();
+    const auto rect = y.shape<1>();
+    if (rect.empty()) return;
+    // Range has no legate type code, so skip the accessor type check.
+    auto ranges = context.input(0).data().read_accessor<Range, 1, false>();
+    auto crd = context.input(1).data().read_accessor<int64_t, 1>();
+    auto vals = context.input(2).data().read_accessor<T, 1>();
+    auto x = context.input(3).data().read_accessor<T, 1>();
+    auto out = y.write_accessor<T, 1>(rect);
+
+    for_rows(rect.lo[0], rect.hi[0], openmp, [&](int64_t i) {
+      const Range r = ranges[i];
+      T sum{};
+      for (int64_t j = r.lo[0]; j <= r.hi[0]; ++j) sum += vals[j] * x[crd[j]];
+      out[i] = sum;
+    });
+  }
+};
+
+template <typename T>
+struct SpMMKernel {
+  void operator()(legate::TaskContext& context, bool openmp) const {
+    auto y = context.output(0).data();
+    const auto rect = y.shape<2>();
+    if (rect.empty()) return;
+    // Row ranges are promoted to (rows, k); column lo[1] carries each row's.
+    auto ranges = context.input(0).data().read_accessor<Range, 2, false>();
+    auto crd = context.input(1).data().read_accessor<int64_t, 1>();
+    auto vals = context.input(2).data().read_accessor<T, 1>();
+    auto x = context.input(3).data().read_accessor<T, 2>();
+    auto out = y.write_accessor<T, 2>(rect);
+    const int64_t c_lo = rect.lo[1], c_hi = rect.hi[1];
+
+    for_rows(rect.lo[0], rect.hi[0], openmp, [&](int64_t i) {
+      std::vector<T> sum(c_hi - c_lo + 1, T{});
+      const Range r = ranges[legate::Point<2>(i, c_lo)];
+      for (int64_t j = r.lo[0]; j <= r.hi[0]; ++j) {
+        const T v = vals[j];
+        const int64_t col = crd[j];
+        for (int64_t c = c_lo; c <= c_hi; ++c)
+          sum[c - c_lo] += v * x[legate::Point<2>(col, c)];
+      }
+      for (int64_t c = c_lo; c <= c_hi; ++c)
+        out[legate::Point<2>(i, c)] = sum[c - c_lo];
+    });
+  }
+};
+
+template <template <typename> class Kernel>
+void sparse_variant(legate::TaskContext context, bool openmp) {
+  switch (context.output(0).type().code()) {
+    case legate::Type::Code::FLOAT32:
+      Kernel<float>{}(context, openmp);
+      break;
+    case legate::Type::Code::FLOAT64:
+      Kernel<double>{}(context, openmp);
+      break;
+    case legate::Type::Code::COMPLEX64:
+      Kernel<std::complex<float>>{}(context, openmp);
+      break;
+    case legate::Type::Code::COMPLEX128:
+      Kernel<std::complex<double>>{}(context, openmp);
+      break;
+    default:
+      throw std::invalid_argument("csr: unsupported type");
+  }
+}
+
+bool is_sparse_value_type(const legate::Type& type) {
+  switch (type.code()) {
+    case legate::Type::Code::FLOAT32:
+    case legate::Type::Code::FLOAT64:
+    case legate::Type::Code::COMPLEX64:
+    case legate::Type::Code::COMPLEX128:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool check_operands(const cupynumeric::NDArray& row_ranges,
+                    const cupynumeric::NDArray& colind,
+                    const cupynumeric::NDArray& values,
+                    const cupynumeric::NDArray& x,
+                    const cupynumeric::NDArray& y, int32_t dim) {
+  if (row_ranges.dim() != 1 || colind.dim() != 1 || values.dim() != 1)
+    return false;
+  if (x.dim() != dim || y.dim() != dim) return false;
+  if (row_ranges.type() != legate::rect_type(1) ||
+      colind.type() != legate::int64() || !is_sparse_value_type(values.type()))
+    return false;
+  if (x.type() != values.type() || y.type() != values.type()) return false;
+  if (colind.shape()[0] != values.shape()[0]) return false;
+  if (y.shape()[0] != row_ranges.shape()[0]) return false;
+  if (dim == 2 && y.shape()[1] != x.shape()[1]) return false;
+  return true;
+}
+
+}  // namespace
+
+void CSRRowRangesTask::cpu_variant(legate::TaskContext context) {
+  auto out = context.output(0).data();
+  const auto rect = out.shape<1>();
+  if (rect.empty()) return;
+  auto lo = context.input(0).data().read_accessor<int64_t, 1>();
+  auto hi = context.input(1).data().read_accessor<int64_t, 1>();
+  auto ranges = out.write_accessor<Range, 1, false>(rect);
+  for (int64_t i = rect.lo[0]; i <= rect.hi[0]; ++i)
+    ranges[i] = Range(lo[i], hi[i] - 1);
+}
+
+void CSRSpMVTask::cpu_variant(legate::TaskContext context) {
+  sparse_variant<SpMVKernel>(context, false);
+}
+
+void CSRSpMMTask::cpu_variant(legate::TaskContext context) {
+  sparse_variant<SpMMKernel>(context, false);
+}
+
+#if LEGATE_DEFINED(LEGATE_USE_OPENMP)
+void CSRSpMVTask::omp_variant(legate::TaskContext context) {
+  sparse_variant<SpMVKernel>(context, true);
+}
+
+void CSRSpMMTask::omp_variant(legate::TaskContext context) {
+  sparse_variant<SpMMKernel>(context, true);
+}
+#endif
+
+std::optional<cupynumeric::NDArray> csr_row_ranges(
+    const cupynumeric::NDArray& rowptr) {
+  if (rowptr.dim() != 1 || rowptr.type() != legate::int64() ||
+      rowptr.shape()[0] == 0)
+    return std::nullopt;
+  const uint64_t rows = rowptr.shape()[0] - 1;
+  auto cn_runtime = cupynumeric::CuPyNumericRuntime::get_runtime();
+  auto ranges = cn_runtime->create_array({rows}, legate::rect_type(1));
+  if (rows == 0) return ranges;
+
+  // lo/hi are the overlapping views rowptr[0:rows] and rowptr[1:rows+1],
+  // both aligned with the output.
+  auto store = rowptr.get_store();
+  const auto n = static_cast<int64_t>(rows);
+  auto runtime = legate::Runtime::get_runtime();
+  auto task = runtime->create_task(cn_runtime->get_library(),
+                                   legate::LocalTaskID{CSR_ROW_RANGES_TASK});
+  auto lo = task.add_input(store.slice(0, legate::Slice{0, n}));
+  auto hi = task.add_input(store.slice(0, legate::Slice{1, n + 1}));
+  auto out = task.add_output(ranges.get_store());
+  task.add_constraint(legate::align(lo, out));
+  task.add_constraint(legate::align(hi, out));
+  runtime->submit(std::move(task));
+  return ranges;
+}
+
+bool csr_spmv(const cupynumeric::NDArray& row_ranges,
+              const cupynumeric::NDArray& colind,
+              const cupynumeric::NDArray& values,
+              const cupynumeric::NDArray& x, cupynumeric::NDArray& y) {
+  if (!check_operands(row_ranges, colind, values, x, y, 1)) return false;
+  if (y.size() == 0) return true;
+
+  // Rows of y (and their ranges) tile evenly; each point task then sees the
+  // slice of colind/values its ranges cover and the entries of x its column
+  // indices touch.
+  auto runtime = legate::Runtime::get_runtime();
+  auto library = cupynumeric::CuPyNumericRuntime::get_runtime()->get_library();
+  auto task =
+      runtime->create_task(library, legate::LocalTaskID{CSR_SPMV_TASK});
+  auto ranges_var = task.add_input(row_ranges.get_store());
+  auto crd_var = task.add_input(colind.get_store());
+  auto vals_var = task.add_input(values.get_store());
+  auto x_var = task.add_input(x.get_store());
+  auto y_var = task.add_output(y.get_store());
+  task.add_constraint(legate::align(ranges_var, y_var));
+  task.add_constraint(legate::image(ranges_var, crd_var,
+                                    legate::ImageComputationHint::FIRST_LAST));
+  task.add_constraint(legate::image(ranges_var, vals_var,
+                                    legate::ImageComputationHint::FIRST_LAST));
+  task.add_constraint(legate::image(crd_var, x_var));
+  runtime->submit(std::move(task));
+  return true;
+}
+
+bool csr_spmm(const cupynumeric::NDArray& row_ranges,
+              const cupynumeric::NDArray& colind,
+              const cupynumeric::NDArray& values,
+              const cupynumeric::NDArray& x, cupynumeric::NDArray& y) {
+  if (!check_operands(row_ranges, colind, values, x, y, 2)) return false;
+  if (y.size() == 0) return true;
+
+  // Same row blocking as csr_spmv with the ranges promoted to Y's shape;
+  // X is needed whole by every row block.
+  const auto k = static_cast<int64_t>(y.shape()[1]);
+  auto runtime = legate::Runtime::get_runtime();
+  auto library = cupynumeric::CuPyNumericRuntime::get_runtime()->get_library();
+  auto task =
+      runtime->create_task(library, legate::LocalTaskID{CSR_SPMM_TASK});
+  auto ranges_var = task.add_input(row_ranges.get_store().promote(1, k));
+  auto crd_var = task.add_input(colind.get_store());
+  auto vals_var = task.add_input(values.get_store());
+  auto x_var = task.add_input(x.get_store());
+  auto y_var = task.add_output(y.get_store());
+  task.add_constraint(legate::align(ranges_var, y_var));
+  task.add_constraint(legate::broadcast(y_var, legate::tuple<uint32_t>{1}));
+  task.add_constraint(legate::image(ranges_var, crd_var,
+                                    legate::ImageComputationHint::FIRST_LAST));
+  task.add_constraint(legate::image(ranges_var, vals_var,
+                                    legate::ImageComputationHint::FIRST_LAST));
+  task.add_constraint(legate::broadcast(x_var));
+  runtime->submit(std::move(task));
+  return true;
+}
+
+}  // namespace tasks
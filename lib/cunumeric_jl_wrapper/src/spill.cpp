@@ -0,0 +1,258 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahhal <naderrahhal2026@u.northwestern.edu>
+ */
+
+#include "spill.h"
+
+#include <cupynumeric.h>
+#include <cupynumeric/runtime.h>
+#include <deps/realm/machine.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+#include "expr.h"
+
+namespace tasks {
+namespace {
+
+// Arrays smaller than a page are not worth a scratch file.
+constexpr uint64_t MIN_SPILL_BYTES = 4096;
+
+struct Entry {
+  cupynumeric::NDArray* arr;
+  uint64_t last_use;
+  uint64_t spilled;  // bytes in its scratch file, 0 while resident
+  bool pinned;
+};
+
+struct SpillManager {
+  bool enabled = false;
+  std::string dir;
+  uint64_t clock = 0;
+  std::unordered_map<const void*, Entry> entries;
+  SpillStats stats{0, 0, 0, 0, 0, 0};
+};
+
+SpillManager& manager() {
+  static SpillManager m;
+  return m;
+}
+
+uint64_t array_bytes(const cupynumeric::NDArray& arr) {
+  return static_cast<uint64_t>(arr.size()) * arr.type().size();
+}
+
+bool spillable(const Entry& entry) {
+  if (entry.pinned || entry.spilled > 0) return false;
+  const auto& arr = *entry.arr;
+  if (arr.dim() == 0 || !arr.type().is_primitive()) return false;
+  if (array_bytes(arr) < MIN_SPILL_BYTES) return false;
+  auto store = arr.get_store();
+  return !store.transformed() && !store.has_scalar_storage();
+}
+
+// Copies between a strided host allocation (byte strides) and a dense
+// C-order buffer, one contiguous row at a time where possible.
+void copy_strided(char* strided, const std::vector<size_t>& strides,
+                  char* dense, const std::vector<uint64_t>& extents,
+                  size_t elem, bool to_dense) {
+  const size_t dim = extents.size();
+  const uint64_t row = extents[dim - 1];
+  const size_t row_stride = strides[dim - 1];
+  std::vector<uint64_t> idx(dim, 0);
+  while (true) {
+    char* base = strided;
+    for (size_t d = 0; d + 1 < dim; ++d) base += idx[d] * strides[d];
+    if (row_stride == elem) {
+      to_dense ? std::memcpy(dense, base, row * elem)
+               : std::memcpy(base, dense, row * elem);
+      dense += row * elem;
+    } else {
+      for (uint64_t i = 0; i < row; ++i, dense += elem) {
+        char* p = base + i * row_stride;
+        to_dense ? std::memcpy(dense, p, elem) : std::memcpy(p, dense, elem);
+      }
+    }
+    size_t d = dim - 1;
+    while (d-- > 0) {
+      if (++idx[d] < extents[d]) break;
+      idx[d] = 0;
+    }
+    if (d == static_cast<size_t>(-1)) return;
+  }
+}
+
+// Unlinked scratch file of `bytes` bytes, backed by real blocks so that a
+// full disk fails here rather than on a later page fault.
+int open_scratch(const std::string& dir, uint64_t bytes) {
+  std::string path = dir + "/cunumeric-spill-XXXXXX";
+  const int fd = mkstemp(path.data());
+  if (fd < 0) return -1;
+  unlink(path.c_str());
+  if (posix_fallocate(fd, 0, static_cast<off_t>(bytes)) != 0) {
+    close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+bool spill(SpillManager& m, Entry& entry) {
+  auto& arr = *entry.arr;
+  const uint64_t bytes = array_bytes(arr);
+  const int fd = open_scratch(m.dir, bytes);
+  if (fd < 0) return false;
+  void* ptr =
+      mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (ptr == MAP_FAILED) return false;
+
+  auto store = arr.get_store();
+  const auto extents = store.extents();
+  {
+    // Waits for pending writers of the array.
+    auto physical = store.get_physical_store();
+    const auto alloc = physical.get_inline_allocation();
+    copy_strided(static_cast<char*>(alloc.ptr), alloc.strides,
+                 static_cast<char*>(ptr), extents.data(), arr.type().size(),
+                 true);
+  }
+  auto allocation = legate::ExternalAllocation::create_sysmem(
+      ptr, bytes, /*read_only=*/false,
+      [bytes](void* p) { munmap(p, bytes); });
+  auto attached = legate::Runtime::get_runtime()->create_store(
+      legate::Shape{extents}, arr.type(), allocation);
+  // Dropping the last reference to the old store releases its instances.
+  arr = cupynumeric::as_array(attached);
+
+  entry.spilled = bytes;
+  ++m.stats.spills;
+  m.stats.spilled_bytes += bytes;
+  m.stats.resident_bytes += bytes;
+  return true;
+}
+
+void fill(SpillManager& m, Entry& entry) {
+  auto& arr = *entry.arr;
+  auto runtime = cupynumeric::CuPyNumericRuntime::get_runtime();
+  auto fresh = runtime->create_array(arr.shape(), arr.type());
+  fresh.assign(arr);
+  // The scratch mapping is unmapped once the copy no longer needs it.
+  arr = std::move(fresh);
+
+  ++m.stats.fills;
+  m.stats.filled_bytes += entry.spilled;
+  m.stats.resident_bytes -= entry.spilled;
+  entry.spilled = 0;
+}
+
+}  // namespace
+
+bool set_spilling(bool enabled, const std::string& dir) {
+  auto& m = manager();
+  if (enabled) {
+    if (Realm::Machine::get_machine().get_address_space_count() > 1)
+      return false;
+    m.dir = dir;
+    m.enabled = true;
+    return true;
+  }
+  for (auto& [key, entry] : m.entries)
+    if (entry.spilled > 0) fill(m, entry);
+  m.entries.clear();
+  m.stats.tracked = 0;
+  m.enabled = false;
+  return true;
+}
+
+bool spilling() { return manager().enabled; }
+
+void track_spill(const void* key, cupynumeric::NDArray* arr) {
+  auto& m = manager();
+  if (!m.enabled) return;
+  m.entries.insert_or_assign(key, Entry{arr, ++m.clock, 0, false});
+  m.stats.tracked = m.entries.size();
+}
+
+void pin_spill(const void* key) {
+  auto& m = manager();
+  if (!m.enabled) return;
+  auto it = m.entries.find(key);
+  if (it == m.entries.end()) return;
+  if (it->second.spilled > 0) fill(m, it->second);
+  it->second.pinned = true;
+}
+
+void forget_spill(const void* key) {
+  auto& m = manager();
+  auto it = m.entries.find(key);
+  if (it == m.entries.end()) return;
+  m.stats.resident_bytes -= it->second.spilled;
+  m.entries.erase(it);
+  m.stats.tracked = m.entries.size();
+}
+
+void touch_spill(const void* key) {
+  auto& m = manager();
+  if (!m.enabled) return;
+  auto it = m.entries.find(key);
+  if (it == m.entries.end()) return;
+  it->second.last_use = ++m.clock;
+  if (it->second.spilled > 0) fill(m, it->second);
+}
+
+void move_spill(const void* dst_key, const void* src_key) {
+  auto& m = manager();
+  auto src = m.entries.find(src_key);
+  if (src == m.entries.end()) return;
+  const bool pinned = src->second.pinned;
+  forget_spill(src_key);
+  auto dst = m.entries.find(dst_key);
+  if (dst != m.entries.end()) dst->second.pinned |= pinned;
+}
+
+uint64_t spill_cold(uint64_t bytes) {
+  auto& m = manager();
+  if (!m.enabled) return 0;
+  // Recorded ops hold copies of their arrays; launch them first.
+  flush_deferred();
+  std::vector<Entry*> candidates;
+  for (auto& [key, entry] : m.entries)
+    if (spillable(entry)) candidates.push_back(&entry);
+  std::sort(candidates.begin(), candidates.end(),
+            [](const Entry* a, const Entry* b) {
+              return a->last_use < b->last_use;
+            });
+  uint64_t released = 0;
+  for (auto* entry : candidates) {
+    if (released >= bytes) break;
+    if (spill(m, *entry)) released += entry->spilled;
+  }
+  return released;
+}
+
+SpillStats spill_stats() { return manager().stats; }
+
+}  // namespace tasks
@@ -0,0 +1,76 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahhal <naderrahhal2026@u.northwestern.edu>
+ */
+
+#include "tasks.h"
+
+#include <cupynumeric.h>
+#include <cupynumeric/runtime.h>
+
+#include "checkpoint.h"
+#include "convolve.h"
+#include "expr.h"
+#include "factor.h"
+#include "fft.h"
+#include "footprint.h"
+#include "gemm.h"
+#include "indexing.h"
+#include "krylov.h"
+#include "multi_reduction.h"
+#include "scan.h"
+#include "sort.h"
+#include "sparse.h"
+
+namespace tasks {
+void register_tasks(legate::Library library) {
+  MultiReductionTask::register_variants(library);
+  MultiReductionMergeTask::register_variants(library);
+  GemmTask::register_variants(library);
+  CSRRowRangesTask::register_variants(library);
+  CSRSpMVTask::register_variants(library);
+  CSRSpMMTask::register_variants(library);
+  TopKTask::register_variants(library);
+  TopKMergeTask::register_variants(library);
+  ScanTask::register_variants(library);
+  ScanCarryTask::register_variants(library);
+  IndexPointsTask::register_variants(library);
+  TakeTask::register_variants(library);
+  CompressTask::register_variants(library);
+  MaskFillTask::register_variants(library);
+  FusedExprTask::register_variants(library);
+  CheckpointTask::register_variants(library);
+  RestoreTask::register_variants(library);
+  FootprintTask::register_variants(library);
+  PotrfTask::register_variants(library);
+  GetrfTask::register_variants(library);
+  TrsmTask::register_variants(library);
+  KrylovTask::register_variants(library);
+  FftTask::register_variants(library);
+  ConvolveTask::register_variants(library);
+}
+}  // namespace tasks
+
+extern "C" {
+
+void nda_register_tasks() {
+  auto runtime = cupynumeric::CuPyNumericRuntime::get_runtime();
+  tasks::register_tasks(runtime->get_library());
+}
+
+}  // extern "C"
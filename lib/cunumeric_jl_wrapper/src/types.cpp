@@ -21,6 +21,7 @@
 #include "types.h"
 
 #include "cupynumeric.h"
+#include "tasks.h"
 
 void wrap_unary_ops(jlcxx::Module& mod) {
   mod.add_bits<CuPyNumericUnaryOpCode>("UnaryOpCode",
@@ -175,4 +176,8 @@ void wrap_linalg_ops(jlcxx::Module& mod) {
                 legate::LocalTaskID{CuPyNumericOpCode::CUPYNUMERIC_SYEV});
   mod.set_const("GEEV",
                 legate::LocalTaskID{CuPyNumericOpCode::CUPYNUMERIC_GEEV});
+  // Host factorization tasks from factor.h, registered in the same library.
+  mod.set_const("POTRF", legate::LocalTaskID{tasks::POTRF_TASK});
+  mod.set_const("GETRF", legate::LocalTaskID{tasks::GETRF_TASK});
+  mod.set_const("TRSM", legate::LocalTaskID{tasks::TRSM_TASK});
 }
@@ -26,6 +26,7 @@
 #include "accessors.h"
 #include "cupynumeric.h"
 #include "cupynumeric/operators.h"
+#include "expr.h"
 #include "jlcxx/jlcxx.hpp"
 #include "jlcxx/stl.hpp"
 #include "legate.h"
@@ -42,7 +43,10 @@ struct WrapCppOptional {
   }
 };
 
-legate::LogicalArray get_store(CN_NDArray* arr) { return arr->obj.get_store(); }
+legate::LogicalArray get_store(CN_NDArray* arr) {
+  tasks::flush_deferred_for(arr);
+  return arr->obj.get_store();
+}
 
 legate::Library get_lib() {
   auto runtime = cupynumeric::CuPyNumericRuntime::get_runtime();
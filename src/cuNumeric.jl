@@ -61,7 +61,12 @@ const DEFAULT_FLOAT = Float32
 const DEFAULT_INT = Int32
 
 const SUPPORTED_INT_TYPES = Union{Int8,Int16,Int32,Int64,UInt8,UInt16,UInt32,UInt64}
-const SUPPORTED_FLOAT_TYPES = Union{Float32,Float64} # Float16 disabled for now. Issues need to be resolved.
+const SUPPORTED_FLOAT_TYPES = Union{Float32,Float64}
+# Float16 is a storage type: arrays of it can be created, indexed, converted,
+# reduced, scanned and used in fused elementwise expressions (computed in
+# Float32), but it is not part of the numeric unions the linear algebra and
+# test sweeps use.
+const SUPPORTED_HALF_TYPES = Float16
 const SUPPORTED_COMPLEX_TYPES = Union{ComplexF32,ComplexF64}
 
 const SUPPORTED_NUMERIC_TYPES = Union{
@@ -72,8 +77,14 @@ const SUPPORTED_NUMERIC_TYPES = Union{
 const SUPPORTED_SOLVE_TYPES = Union{SUPPORTED_FLOAT_TYPES,SUPPORTED_COMPLEX_TYPES}
 const SUPPORTED_SVD_TYPES = Union{SUPPORTED_FLOAT_TYPES,SUPPORTED_COMPLEX_TYPES}
 const SUPPORTED_QR_TYPES = Union{SUPPORTED_FLOAT_TYPES,SUPPORTED_COMPLEX_TYPES}
+const SUPPORTED_GEMM_TYPES = Union{SUPPORTED_FLOAT_TYPES,SUPPORTED_COMPLEX_TYPES}
+# mixed_mul: storage/output types and the types products may be summed in
+const SUPPORTED_MIXED_GEMM_TYPES = Union{SUPPORTED_HALF_TYPES,SUPPORTED_FLOAT_TYPES}
+const SUPPORTED_ACCUMULATION_TYPES = SUPPORTED_FLOAT_TYPES
+const SUPPORTED_SPARSE_TYPES = Union{SUPPORTED_FLOAT_TYPES,SUPPORTED_COMPLEX_TYPES}
 const SUPPORTED_ARRAY_TYPES = Union{Bool,SUPPORTED_NUMERIC_TYPES}
-const SUPPORTED_TYPES = Union{SUPPORTED_ARRAY_TYPES,String}
+const SUPPORTED_ELEMENT_TYPES = Union{SUPPORTED_NUMERIC_TYPES,SUPPORTED_HALF_TYPES}
+const SUPPORTED_TYPES = Union{SUPPORTED_ARRAY_TYPES,SUPPORTED_HALF_TYPES,String}
 
 # const MAX_DIM = 6 # idk what we compiled?
 
@@ -164,6 +175,8 @@ const FUSE_BROADCAST_EXPRS = CNPreferences.FUSE_BROADCAST
 # Fuse when broadcast tree length is at least this (see `_broadcast_tree_length`).
 # Default 2 skips single-op exprs like `y .= cos.(x)`. Use 1 to fuse everything.
 const FUSE_BROADCAST_MIN_OPS = CNPreferences.FUSE_BROADCAST_MIN_OPS
+# Record unfused broadcasts and run them as fused host tasks (opt-in, see `with_deferred`).
+const DEFER_BROADCAST_EXPRS = CNPreferences.DEFER_BROADCAST
 
 # Functionality
 include("ndarray/promotion.jl")
@@ -174,6 +187,12 @@ include("ndarray/ndarray.jl")
 include("ndarray/unary.jl")
 include("ndarray/binary.jl")
 include("ndarray/linalg.jl")
+include("ndarray/sparse.jl")
+include("ndarray/krylov.jl")
+include("ndarray/fft.jl")
+include("ndarray/convolve.jl")
+include("ndarray/sort.jl")
+include("ndarray/checkpoint.jl")
 include("scoping/scoping.jl")
 
 # From https://github.com/JuliaGraphics/QML.jl/blob/dca239404135d85fe5d4afe34ed3dc5f61736c63/src/QML.jl#L147
@@ -191,7 +210,8 @@ end
 getargv(a::ArgcArgv) = Base.unsafe_convert(CxxPtr{CxxPtr{CxxChar}}, a.argv)
 
 function my_on_exit()
-    return drain_pending_frees!()   # flush before Legate tears down
+    drain_pending_frees!()   # flush before Legate tears down
+    return clear_scalar_cache!()
 end
 
 global cuNumeric_config_str::String = ""
@@ -220,6 +240,9 @@ function _start_runtime()
     # setup /src/memory.jl
     cuNumeric.init_gc!()
 
+    # host tasks launched by the C API (lib/cunumeric_jl_wrapper/src/tasks.cpp)
+    ccall((:nda_register_tasks, libnda), Cvoid, ())
+
     Base.atexit(my_on_exit)
 
     return RUNTIME_ACTIVE
@@ -16,59 +16,6 @@ function to_stdvec(::Type{T}, vec) where {T}
     return stdvec
 end
 
-function add_padding(arr::NDArray, dims::Dims{N}; copy=false) where {N}
-    old_size = size(arr)
-
-    @assert all(dims .>= old_size) "newdims must be ≥ current dims elementwise"
-    new = zeros(eltype(arr), dims)
-
-    if copy # due to being an input. we don't need to copy outputs
-        slices = ntuple(d -> (0, Int(old_size[d])), length(old_size))
-        s = nda_get_slice(new, slice_array(slices...))
-        copyto!(s, arr)
-        destroy!(s)
-    end
-
-    nda_destroy_array(arr.ptr)
-    register_free!(arr.nbytes)
-
-    # update pointer & update metadata
-    arr.ptr = new.ptr
-    arr.nbytes = new.nbytes
-    arr.padding = old_size # remember the prior (before the padding)
-
-    # julia GC will call finalizer, but we manually cleaned it
-    new.ptr = Ptr{Cvoid}(0)
-    new.nbytes = 0
-    return new.padding = nothing
-end
-
-function add_padding(arr::NDArray, i::Int64; copy=false)
-    return add_padding(arr, (i,); copy=copy)
-end
-
-function check_sz!(arr, maxshape; copy=false)
-    sz = cuNumeric.size(arr)
-    if maxshape != nothing
-        # currently require all ndarray inputs to be equal
-        alligned_equal_size = sz == maxshape
-        if !alligned_equal_size
-            cuNumeric.add_padding(arr, maxshape; copy=copy)
-            new_size = padded_shape(arr)
-            @warn "[Padding Added] $sz output is now $new_size"
-        end
-    end
-end
-
-function check_sz(arr, maxshape)
-    sz = cuNumeric.size(arr)
-    if maxshape != nothing
-        # currently require all ndarray inputs to be equal
-        alligned_equal_size = sz == maxshape
-        @assert alligned_equal_size
-    end
-end
-
 # `get_store` returns a Julia-owned `LogicalArrayImplAllocated` that shares the
 # underlying Legate store with the NDArray. `add_input`/`add_output` copy that
 # array into the task; if we leave the temporary alive until GC, store refcounts
@@ -84,17 +31,9 @@ end
 function Launch(kernel::CUDATask, inputs::Tuple{Vararg{NDArray}},
     outputs::Tuple{Vararg{NDArray}}, scalars::Tuple{Vararg{Any}};
     blocks, threads, taskid=cuNumeric.RUN_PTX, ctx=nothing, validate_shapes=true)
-    max_shape = if validate_shapes
-        # Generic PTX tasks retain the existing padding/shape behavior.
-        ndarrays = vcat(inputs..., outputs...) # returns (nbytes, position)
-        mx = findmax(arr -> arr.nbytes, ndarrays) # first elem nbytes
-        shape = size(ndarrays[mx[2]]) # second elem max position
-        @assert !isnothing(shape)
-        shape
-    else
-        # Fused linear broadcast verifies shapes match
-        nothing
-    end
+    # Fused linear broadcast guarantees equal shapes and skips the comparison.
+    arrays = (inputs..., outputs...)
+    same_shape = !validate_shapes || all(arr -> size(arr) == size(first(arrays)), arrays)
 
     rt = Legate.get_runtime()
     lib = cuNumeric.get_lib()
@@ -102,13 +41,11 @@ function Launch(kernel::CUDATask, inputs::Tuple{Vararg{NDArray}},
 
     input_vars = Vector{Legate.Variable}()
     for arr in inputs
-        validate_shapes && check_sz!(arr, max_shape; copy=true)
         push!(input_vars, _add_task_array!(Legate.add_input, task, arr))
     end
 
     output_vars = Vector{Legate.Variable}()
     for arr in outputs
-        validate_shapes && check_sz!(arr, max_shape; copy=false)
         push!(output_vars, _add_task_array!(Legate.add_output, task, arr))
     end
 
@@ -130,8 +67,17 @@ function Launch(kernel::CUDATask, inputs::Tuple{Vararg{NDArray}},
         Legate.add_scalar(task, Legate.Scalar(s))
     end
 
-    # all inputs are aligned with all outputs
-    Legate.default_alignment(task, input_vars, output_vars)
+    if same_shape
+        # all inputs are aligned with all outputs
+        Legate.default_alignment(task, input_vars, output_vars)
+    else
+        # Arrays of different shapes cannot share one tiling, so each is
+        # handed whole to a single point task. Every argument is a strided
+        # descriptor with its own extents; nothing is padded or copied.
+        for var in Iterators.flatten((input_vars, output_vars))
+            cuNumeric.add_broadcast_constraint(task, var)
+        end
+    end
     return Legate.submit_auto_task(rt, task)
 end
 
@@ -31,10 +31,11 @@ function _setup_cuda_tasking()
     end
 end
 
-# Dense @cuda_task / RunPTXTask — MUST match CUDA.jl CuDeviceArray layout.
+# @cuda_task / RunPTXTask arrays are strided descriptors with their own
+# extents, so arguments need neither a common shape nor a dense layout.
 # Other memory types: https://github.com/JuliaGPU/CUDA.jl/blob/345c1600ebd561135148bb04ee2657f521a40e25/CUDACore/src/device/pointer.jl#L7
 function ndarray_cuda_type(::Type{<:NDArray{T,N}}) where {T,N}
-    return CUDACore.CuDeviceArray{T,N,CUDACore.AS.Global}
+    return CuStridedDeviceArray{T,N,CUDACore.AS.Global}
 end
 
 function ndarray_cuda_type(::Type{T}) where {T}
@@ -46,8 +47,8 @@ end
     map_cuda_type(::Type{T})::Type
 
 Recursively rewrite cuNumeric broadcast-related types for fused-broadcast PTX
-(e.g. mapping `NDArray{...}` to `CuStridedDeviceArray{...}`). Dense `@cuda_task`
-uses `ndarray_cuda_type` → CUDA.jl `CuDeviceArray` instead.
+(e.g. mapping `NDArray{...}` to `CuStridedDeviceArray{...}`). `@cuda_task`
+uses `ndarray_cuda_type`, which maps plain NDArray arguments the same way.
 """
 map_cuda_type(::Type{T}) where {T} = T
 
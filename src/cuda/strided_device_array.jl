@@ -14,12 +14,10 @@
  * limitations under the License.
 =#
 
-# Device-side strided array packed by RunPTXBroadcastTask only.
+# Device-side strided array packed by RunPTXTask and RunPTXBroadcastTask.
 # Layout must match C++ `CuStridedDeviceArray<D>` in
-# lib/cunumeric_jl_wrapper/src/cuda.cpp:
+# lib/cunumeric_jl_wrapper/include/strided_descriptor.h:
 #   ptr, maxsize, dims[N], strides[N] (element strides), length
-#
-# Dense RunPTXTask / @cuda_task still uses CUDA.jl CuDeviceArray (unchanged).
 
 struct CuStridedDeviceArray{T,N,A} <: AbstractArray{T,N}
     ptr::CUDACore.LLVMPtr{T,A}
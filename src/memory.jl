@@ -50,10 +50,6 @@ query_total_device_memory() = ccall((:nda_query_total_device_memory, libnda),
     Int64, ())
 query_total_host_memory() = ccall((:nda_query_total_host_memory, libnda),
     Int64, ())
-nda_query_allocated_device_memory() = ccall((:nda_query_allocated_device_memory, libnda),
-    Int64, ())
-nda_query_allocated_host_memory() = ccall((:nda_query_allocated_host_memory, libnda),
-    Int64, ())
 
 const total_device_bytes = Ref{Int64}(0)      # cached device total
 const total_host_bytes = Ref{Int64}(0)      # cached host total
@@ -67,6 +63,8 @@ const post_gc_device_bytes = Atomic{Int64}(0)
 const post_gc_host_bytes = Atomic{Int64}(0)
 # how much new memory must accumulate before GC fires again
 const gc_hysteresis_frac = Ref{Float64}(0.05)
+# spill cold arrays to scratch files when a collection cannot get below the hard limit
+const SPILL_ENABLE = Ref{Bool}(false)
 
 @doc"""
     init_gc!()
@@ -124,17 +122,12 @@ function register_free!(nbytes::Integer)
     return nothing
 end
 
+# Resets the predicted counters to `allocated_footprint()`. Host memory includes
+# NUMA socket and zero-copy memory, which also live in host RAM.
 function recalibrate_allocator!()
-    recal_host_mem = ccall((:nda_query_allocated_host_memory, libnda), Int64, ())
-    @assert recal_host_mem >= 0
-    atomic_xchg!(current_host_bytes, recal_host_mem)
-
-    if HAS_CUDA
-        recal_device_mem = ccall((:nda_query_allocated_device_memory, libnda), Int64, ())
-        @assert recal_device_mem >= 0
-        atomic_xchg!(current_device_bytes, recal_device_mem)
-    end
-
+    f = allocated_footprint()
+    atomic_xchg!(current_host_bytes, Int64(f.sysmem + f.socketmem + f.zcmem))
+    HAS_CUDA && atomic_xchg!(current_device_bytes, Int64(f.fbmem))
     return nothing
 end
 
@@ -149,8 +142,17 @@ function maybe_collect()
     host_delta = Int(round(gc_hysteresis_frac[] * total_host_bytes[]))
     grew = device_bytes > dev_floor + dev_delta || host_bytes > host_floor + host_delta
 
+    # Predictions miss padding, layouts and scalar stores and count views as
+    # allocations; confirm with `allocated_footprint()` before collecting.
+    if grew && (device_bytes > soft_limit(; host=false) || host_bytes > soft_limit())
+        recalibrate_allocator!()
+        host_bytes = current_host_bytes[]
+        device_bytes = current_device_bytes[]
+    end
+
     if device_bytes > hard_limit(; host=false) || host_bytes > hard_limit()
         grew && _collect!(true)
+        SPILL_ENABLE[] && _spill_excess!()
     elseif device_bytes > soft_limit(; host=false) || host_bytes > soft_limit()
         grew && _collect!(false)
     else
@@ -170,3 +172,153 @@ function _collect!(full::Bool)
     atomic_xchg!(post_gc_host_bytes, current_host_bytes[])
     return nothing
 end
+
+# Spills down to the soft limit whatever a full collection could not release.
+function _spill_excess!()
+    excess = max(
+        current_host_bytes[] - soft_limit(),
+        current_device_bytes[] - soft_limit(; host=false),
+    )
+    excess > 0 || return nothing
+    spill_cold!(excess)
+    recalibrate_allocator!()
+    return nothing
+end
+
+@doc"""
+    enable_spilling!(; dir=tempdir())
+
+Let cuNumeric move cold arrays out of memory. When the automatic GC reaches its
+hard limit and a full collection does not free enough, the least recently used
+arrays are copied into memory-mapped scratch files under `dir` until usage is
+back at the soft limit. A spilled array stays usable and is copied back the
+next time an operation touches it, so working sets larger than memory can run
+on a single node. Only arrays created after this call are candidates; views and
+arrays whose store or pointer was handed out (`get_store`, custom tasks) stay
+resident. Single-process runs only.
+
+See also [`disable_spilling!`](@ref), [`spill_stats`](@ref).
+"""
+function enable_spilling!(; dir::AbstractString=tempdir())
+    isdir(dir) || throw(ArgumentError("spill directory $dir does not exist"))
+    ok = ccall((:nda_set_spilling, libnda), Bool, (Bool, Cstring), true, dir)
+    ok || error("spilling is only supported in single-process runs")
+    SPILL_ENABLE[] = true
+    return nothing
+end
+
+@doc"""
+    disable_spilling!()
+
+Stop spilling and copy every spilled array back into memory.
+"""
+function disable_spilling!()
+    SPILL_ENABLE[] = false
+    ccall((:nda_set_spilling, libnda), Bool, (Bool, Cstring), false, "")
+    return nothing
+end
+
+@doc"""
+    spill_cold!(nbytes::Integer)
+
+Spill the least recently used arrays until at least `nbytes` have left memory,
+regardless of the GC limits. Returns the number of bytes spilled. No-op unless
+[`enable_spilling!`](@ref) was called.
+"""
+function spill_cold!(nbytes::Integer)
+    nbytes >= 0 || throw(ArgumentError("nbytes must be >= 0, got $nbytes"))
+    return Int64(ccall((:nda_spill_cold, libnda), UInt64, (UInt64,), UInt64(nbytes)))
+end
+
+# Mirrors CN_SpillStats in ndarray_c_api.h.
+struct SpillStats
+    spills::UInt64
+    fills::UInt64
+    spilled_bytes::UInt64
+    filled_bytes::UInt64
+    resident_bytes::UInt64
+    tracked::UInt64
+end
+
+@doc"""
+    spill_stats()
+
+Counters of the spill manager: number of `spills` and `fills`, total
+`spilled_bytes` and `filled_bytes`, the `resident_bytes` currently held in
+scratch files and the number of `tracked` arrays.
+"""
+function spill_stats()
+    stats = Ref{SpillStats}()
+    ccall((:nda_spill_stats, libnda), Cvoid, (Ref{SpillStats},), stats)
+    return stats[]
+end
+
+# Mirrors CN_Footprint in ndarray_c_api.h.
+@doc"""
+    MemoryFootprint
+
+Bytes by memory kind: `sysmem` (host), `fbmem` (GPU framebuffer), `zcmem`
+(zero-copy), `socketmem` (NUMA socket) and `scalar` (future-backed stores,
+which have no instance). `sum(f)` adds them up.
+"""
+struct MemoryFootprint
+    sysmem::UInt64
+    fbmem::UInt64
+    zcmem::UInt64
+    socketmem::UInt64
+    scalar::UInt64
+end
+
+Base.sum(f::MemoryFootprint) = Int64(f.sysmem + f.fbmem + f.zcmem + f.socketmem + f.scalar)
+
+@doc"""
+    allocated_footprint() -> MemoryFootprint
+
+Bytes Legate currently has allocated in each memory kind of this process,
+whichever arrays they belong to. This is the ground truth the GC heuristics
+recalibrate against; compare with [`physical_footprint`](@ref) of individual
+arrays to find the ones that dominate.
+"""
+function allocated_footprint()
+    out = Ref{MemoryFootprint}()
+    ccall((:nda_allocated_footprint, libnda), Cvoid, (Ref{MemoryFootprint},), out)
+    return out[]
+end
+
+# Mirrors CN_ScalarCacheStats in ndarray_c_api.h.
+struct ScalarCacheStats
+    hits::UInt64
+    misses::UInt64
+    evictions::UInt64
+    size::UInt64
+    capacity::UInt64
+end
+
+@doc"""
+    scalar_cache_stats()
+
+Counters of the cache behind scalar broadcast operands. Equal literals of the
+same type (`dt`, `0.5`, ...) share one read-only scalar store, so scalar-heavy
+loops reuse stores instead of allocating one per literal per iteration.
+Returns a `ScalarCacheStats` with `hits`, `misses`, `evictions`, `size` and
+`capacity`.
+"""
+function scalar_cache_stats()
+    stats = Ref{ScalarCacheStats}()
+    ccall((:nda_scalar_cache_stats, libnda), Cvoid, (Ref{ScalarCacheStats},), stats)
+    return stats[]
+end
+
+@doc"""
+    set_scalar_cache_capacity!(n::Integer)
+
+Keep at most `n` cached scalar stores (default 256), evicting the least recently
+used ones. `n = 0` disables sharing.
+"""
+function set_scalar_cache_capacity!(n::Integer)
+    n >= 0 || throw(ArgumentError("scalar cache capacity must be >= 0, got $n"))
+    ccall((:nda_set_scalar_cache_capacity, libnda), Cvoid, (UInt64,), UInt64(n))
+    return nothing
+end
+
+clear_scalar_cache!() = ccall((:nda_clear_scalar_cache, libnda), Cvoid, ())
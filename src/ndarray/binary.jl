@@ -139,6 +139,12 @@ end
 Base.:(*)(val::V, arr::NDArray{A}) where {A,V} = _mul_scalar(__my_promote_type(A, V), val, arr)
 Base.:(*)(arr::NDArray{A}, val::V) where {A,V} = val * arr
 
+# A 0-d array is a scalar handle: scale by broadcasting against its store
+# instead of reading the value back to Julia.
+Base.:(*)(s::NDArray{<:Any,0}, arr::NDArray) = s .* arr
+Base.:(*)(arr::NDArray, s::NDArray{<:Any,0}) = arr .* s
+Base.:(*)(s1::NDArray{<:Any,0}, s2::NDArray{<:Any,0}) = s1 .* s2
+
 _mul_scalar(::Type{T}, val, arr::NDArray{T}) where {T} = nda_multiply_scalar(arr, T(val))
 function _mul_scalar(::Type{U}, val, arr::NDArray) where {U}
     promoted = unchecked_promote_arr(arr, U)  # always a new array when U ≠ eltype
@@ -63,14 +63,15 @@ Base.convert(::Type{BrokenBroadcast{T}}, x) where {T} = BrokenBroadcast{T}()
 Base.convert(::Type{BrokenBroadcast{T}}, x::BrokenBroadcast{T}) where {T} = x
 Base.eltype(::Type{BrokenBroadcast{T}}) where {T} = T
 
+# 0-d results stay 0-d NDArrays (future-backed scalar handles) so scalar
+# arithmetic on reductions chains into later tasks without a sync. Read the
+# value with `x[]` or `unwrap(x)`.
 function Broadcast.copy(bc::Broadcasted{<:NDArrayStyle{0}})
     ElType = Broadcast.combine_eltypes(bc.f, bc.args)
     if ElType == Union{}
         ElType = Nothing
     end
-    dest = copyto!(similar(bc, ElType), bc)
-    #! CHECK THIS DOESNT CAUSE ISSUES DUE TO BLOCKING NATURE
-    return @allowscalar dest[CartesianIndex()]
+    return copyto!(nda_empty_array((), ElType), bc)
 end
 
 @inline function Broadcast.copy(bc::Broadcasted{<:NDArrayStyle})
@@ -118,6 +119,14 @@ end
     return nothing
 end
 
+# Lower-rank and extent-1 operands become zero-copy `broadcast_to` views.
+# 0-d arrays (promoted scalars) are left to cuPyNumeric's own broadcasting.
+@inline _broadcast_view(x, dims) = x
+@inline _broadcast_view(x::NDArray{<:Any,0}, dims) = x
+@inline function _broadcast_view(x::NDArray, dims)
+    return size(x) == dims ? x : nda_broadcast_to(x, dims)
+end
+
 # Un-fused implementation of broadcast tree
 function unravel_broadcast_tree(bc::Broadcasted)
 
@@ -141,8 +150,12 @@ function unravel_broadcast_tree(bc::Broadcasted)
     # If not it falls back to a pass-through that just calls
     # the Julia function and assumes the user defined a function
     # composed of supported operations.
-    result = __broadcast(bc.f, out, in_args...)
+    # cuPyNumeric aligns trailing dimensions (NumPy rules); Julia aligns
+    # leading ones. Hand it stride-0 views of the full shape instead.
+    view_args = _broadcast_view.(in_args, Ref(size(out)))
+    result = __broadcast(bc.f, out, view_args...)
     for i in eachindex(materialized_args)
+        view_args[i] !== in_args[i] && destroy!(view_args[i])
         _destroy_unfused_arg_temps!(bc.args[i], materialized_args[i], in_args[i])
     end
     return result
@@ -193,6 +206,36 @@ end
     end
 end
 
+"""
+    with_deferred(f)
+
+Run `f()` with the C wrapper recording elementwise ops instead of launching
+them. On return the recorded graph is pruned of dead temporaries and common
+subexpressions and launched as one fused host task per subgraph. Arrays
+produced inside `f` are safe to use after it returns, and any other operation
+on one of them inside `f` launches the recording first. The recorder is
+process-wide: while `f` runs, elementwise ops issued by other tasks are
+recorded too.
+"""
+function with_deferred(f)
+    nda_set_deferred(true)
+    try
+        return f()
+    finally
+        nda_set_deferred(false)
+    end
+end
+
+# Host-side fusion for builds without CUDA fusion (see `DEFER_BROADCAST_EXPRS`).
+@inline function _unravel_maybe_deferred(bc::Broadcasted)
+    @static if DEFER_BROADCAST_EXPRS
+        if _broadcast_tree_length(bc) >= FUSE_BROADCAST_MIN_OPS
+            return with_deferred(() -> unravel_broadcast_tree(bc))
+        end
+    end
+    return unravel_broadcast_tree(bc)
+end
+
 @inline function _copyto!(dest::NDArray, bc::Broadcasted)
     axes(dest) == axes(bc) || Broadcast.throwdm(axes(dest), axes(bc))
     isempty(dest) && return dest
@@ -207,16 +250,17 @@ end
     # Fused writes `dest` in place (no post-fuse `nda_move`); promotion is
     # checked pre-launch in `fuse_broadcast_tree!`. CPU vs GPU is compile-time
     # via `@static if FUSE_BROADCAST_EXPRS && HAS_CUDA`.
-    # Fusion requires same-shaped NDArray leaves; otherwise fall back.
+    # Fusion expands broadcasting NDArray leaves to stride-0 views.
     # Single-op exprs (length < `FUSE_BROADCAST_MIN_OPS`) stay unfused by default.
+    # Otherwise the unfused path may still be fused on the host when deferral is on.
     @static if FUSE_BROADCAST_EXPRS && HAS_CUDA
         if _should_attempt_broadcast_fusion(dest, bc)
             return fuse_broadcast_tree!(dest, bc)
         else
-            return _copyto_unfused!(dest, unravel_broadcast_tree(bc))
+            return _copyto_unfused!(dest, _unravel_maybe_deferred(bc))
         end
     else
-        return _copyto_unfused!(dest, unravel_broadcast_tree(bc))
+        return _copyto_unfused!(dest, _unravel_maybe_deferred(bc))
     end
 end
 
@@ -231,14 +231,15 @@ end
 const _BCAST_PTX_CACHE = Dict{Tuple{Any,DataType,DataType},FusedBroadcastMetadata}()
 const _BCAST_PTX_CACHE_LOCK = ReentrantLock()
 
-# Every NDArray leaf must match `dest` shape. Shape-mismatched broadcasts
-# (e.g. matrix .+ vector) are handled by the unfused path.
+# Every NDArray leaf must match `dest` shape or broadcast to it. Leaves that
+# broadcast (e.g. the vector in matrix .* vector) are swapped for stride-0
+# `broadcast_to` views before launch, see `_expand_fusion_leaves`.
 #
 # Slice views are allowed: RunPTXBroadcastTask packs their element strides.
 @inline _can_fuse_linear_broadcast_leaf(dest, ::Number) = true
 @inline _can_fuse_linear_broadcast_leaf(dest, ::Base.RefValue) = true
 @inline function _can_fuse_linear_broadcast_leaf(dest, x::NDArray)
-    return size(x) == size(dest)
+    return _broadcasts_to(size(x), size(dest))
 end
 @inline function _can_fuse_linear_broadcast_leaf(dest, x::Base.Broadcast.Extruded)
     return _can_fuse_linear_broadcast_leaf(dest, x.x)
@@ -257,8 +258,8 @@ end
 """
 Return true when same-shaped broadcast fusion is safe for `bc` into `dest`.
 
-Requires every NDArray leaf to have the same size as `dest`. Scalars / RefValues
-are allowed. Unknown leaf types refuse fusion (fall back to unfused).
+Requires every NDArray leaf to have the same size as `dest` or to broadcast to
+it along leading dimensions. Scalars / RefValues are allowed. Unknown leaf types refuse fusion (fall back to unfused).
 
 Also refuses 0-d destinations: `RunPTXBroadcastTask` only supports dims in
 `[1, 6]`; 0-d falls back to the unfused path.
@@ -269,6 +270,21 @@ Also refuses 0-d destinations: `RunPTXBroadcastTask` only supports dims in
     return _can_fuse_linear_broadcast_leaf(dest, bc)
 end
 
+# Replace broadcasting NDArray leaves with stride-0 views of `dest`'s shape so
+# the kernel indexes every operand alike; views are pushed onto `views` and
+# destroyed by the caller once the task is submitted.
+@inline _expand_fusion_leaves(dest, x, views) = x
+function _expand_fusion_leaves(dest, x::NDArray, views)
+    size(x) == size(dest) && return x
+    view = nda_broadcast_to(x, size(dest))
+    push!(views, view)
+    return view
+end
+function _expand_fusion_leaves(dest, bc::Base.Broadcast.Broadcasted, views)
+    args = map(a -> _expand_fusion_leaves(dest, a, views), bc.args)
+    return Base.Broadcast.Broadcasted(bc.style, bc.f, args, bc.axes)
+end
+
 # Same-shaped operands do not need Broadcast's dynamic index projection.
 @inline function _unwrap_fusion_arg(x::Base.Broadcast.Extruded)
     if all(x.keeps)
@@ -647,6 +663,10 @@ function fuse_broadcast_tree!(dest::D, bc::B) where {D<:NDArray,B<:Base.Broadcas
     # flattening turns their inputs into top-level runtime arguments.
     bc = _fold_fused_scalar_broadcasts(bc)
 
+    # Lower-rank and extent-1 leaves become zero-copy views of dest's shape.
+    views = NDArray[]
+    bc = _expand_fusion_leaves(dest, bc, views)
+
     # Capture the readable tree before flatten collapses the nesting.
     bc_scope = bc
 
@@ -737,6 +757,7 @@ function fuse_broadcast_tree!(dest::D, bc::B) where {D<:NDArray,B<:Base.Broadcas
             validate_shapes=false,
         )
     end
+    foreach(destroy!, views)
 
     # Fused kernel already wrote `dest` in place; promotion was checked pre-launch.
     return dest
@@ -0,0 +1,76 @@
+#= Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahal <naderrahhal2026@u.northwestern.edu>
+=#
+
+const _CHECKPOINT_NAME = r"^[A-Za-z0-9_-]+$"
+
+function _checkpoint_name(name::AbstractString)
+    occursin(_CHECKPOINT_NAME, name) ||
+        throw(ArgumentError("checkpoint names may only use [A-Za-z0-9_-], got \"$name\""))
+    return String(name)
+end
+
+@doc"""
+    checkpoint(dir, arrays::Pair{<:AbstractString,<:NDArray}...; compress=false)
+    checkpoint(dir, arrays::AbstractDict; compress=false)
+
+Save each `name => array` to the directory `dir` (created if needed).
+Every tile of an array is written concurrently by the task that owns it as
+its own shard file, and `dir/manifest` indexes the shards. With
+`compress=true` each shard is byte-shuffled and LZ-compressed in 1 MiB chunks;
+chunks that do not shrink are stored as is. Saving a name again replaces its
+previous shards once the new ones are complete. Blocks until everything is
+on disk, and throws an `ErrorException` when a shard or the manifest could not
+be written; arrays that failed keep their previous checkpoint.
+
+Names may only use `[A-Za-z0-9_-]`. 0-d arrays are not supported.
+See [`restore`](@ref).
+"""
+function checkpoint(
+    dir::AbstractString, arrays::Pair{<:AbstractString,<:NDArray}...; compress::Bool=false
+)
+    names = String[_checkpoint_name(first(p)) for p in arrays]
+    allunique(names) || throw(ArgumentError("checkpoint names must be unique"))
+    arrs = NDArray[last(p) for p in arrays]
+    any(a -> ndims(a) == 0, arrs) &&
+        throw(ArgumentError("checkpoint does not support 0-d arrays"))
+    return nda_checkpoint(arrs, names, String(dir), compress)
+end
+
+function checkpoint(dir::AbstractString, arrays::AbstractDict; compress::Bool=false)
+    return checkpoint(dir, pairs(arrays)...; compress=compress)
+end
+
+@doc"""
+    restore(dir, name) -> NDArray
+    restore(dir, names...) -> Tuple
+
+Read arrays saved with [`checkpoint`](@ref). Each tile of the new array is
+filled from whichever shards overlap it, so the checkpoint may have been
+written with a different number of processors or ranks. Blocks until the
+shards are read. Throws an `ArgumentError` when a name is not in the
+checkpoint, and an `ErrorException` when its shards are incomplete, damaged or
+of another type.
+"""
+restore(dir::AbstractString, name::AbstractString) =
+    only(nda_restore([_checkpoint_name(name)], String(dir)))
+
+function restore(dir::AbstractString, names::AbstractString...)
+    return Tuple(nda_restore(String[_checkpoint_name(n) for n in names], String(dir)))
+end
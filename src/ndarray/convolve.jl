@@ -0,0 +1,104 @@
+#= Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahal <naderrahhal2026@u.northwestern.edu>
+=#
+
+const _CONVOLVE_TYPES = Union{SUPPORTED_FLOAT_TYPES,SUPPORTED_COMPLEX_TYPES}
+
+@doc"""
+    cuNumeric.convolve(A::NDArray, w::NDArray; mode=:constant, value=0, method=:auto)
+    cuNumeric.correlate(A::NDArray, w::NDArray; mode=:constant, value=0, method=:auto)
+
+Filter `A` with the kernel `w`, which has as many dimensions as `A`, and
+return an array of `A`'s size. With `c = div.(size(w), 2)`, `correlate`
+computes
+
+    out[i] = Σ_j w[j] * A[i + j - c - 1]
+
+and `convolve` does the same with `w` reversed along every dimension. A
+complex kernel is conjugated by `correlate` (not by `convolve`), as in
+`numpy.correlate` and `scipy.signal.correlate`. With
+the default zero border this is the `"same"` mode of `numpy.convolve` and
+`scipy.signal.convolve`. Reads past the border of `A` follow `mode`, as in
+[`pad`](@ref): `:constant` uses `value`, `:edge` repeats the nearest
+element, `:wrap` is periodic. Both arrays are promoted to a common
+`Float32`, `Float64` or complex element type.
+
+`method` selects the algorithm:
+
+- `:direct` is a single stencil pass. Each task gets its tile of `A` plus a
+  halo as wide as the kernel's reach, so a 5×5 filter reads every element
+  once rather than once per shifted slice. `:wrap` pads `A` first, because
+  its halo comes from the far side of the array.
+- `:fft` pads `A` by the boundary rule and multiplies spectra from
+  [`fft`](@ref), then crops the result. Each transform over all dimensions
+  takes two split passes.
+- `:auto` uses `:fft` only when the kernel has many more taps than the
+  log2 of the padded size.
+
+The stencil and FFT tasks have CPU and OpenMP variants only. On GPU builds
+both methods run on host processors, with the operands mapped to host
+memory.
+
+# Examples
+```@repl
+u = cuNumeric.rand(64, 64)
+blur = cuNumeric.fill(1 / 25, 5, 5)
+cuNumeric.convolve(u, blur; mode=:edge)
+```
+"""
+function convolve(a::NDArray, w::NDArray; kwargs...)
+    return _convolve("convolve", a, w, true; kwargs...)
+end
+
+function correlate(a::NDArray, w::NDArray; kwargs...)
+    return _convolve("correlate", a, w, false; kwargs...)
+end
+
+function _convolve(
+    name, a::NDArray{A,N}, w::NDArray{B,M}, flip::Bool; mode::Symbol=:constant, value=0,
+    method::Symbol=:auto,
+) where {A,B,N,M}
+    N == M || throw(DimensionMismatch("$name: kernel has $M dimensions, array has $N"))
+    N >= 1 || throw(ArgumentError("$name: expected at least one dimension"))
+    T = promote_type(A, B)
+    T <: _CONVOLVE_TYPES || throw(ArgumentError("$name: unsupported element type $T"))
+    any(iszero, size(w)) && throw(ArgumentError("$name: kernel must not be empty"))
+    mode in (:constant, :edge, :wrap) ||
+        throw(ArgumentError("$name: mode must be :constant, :edge or :wrap, got :$mode"))
+    code = _convolve_method(name, method)
+
+    a_T = unchecked_promote_arr(a, T)
+    w_T = unchecked_promote_arr(w, T)
+    if !flip && T <: Complex
+        w_conj = conj(w_T)
+        w_T !== w && destroy!(w_T)
+        w_T = w_conj
+    end
+    out = nda_convolve(a_T, w_T, _pad_mode(mode), flip, code, convert(T, value))
+    a_T !== a && destroy!(a_T)
+    w_T !== w && destroy!(w_T)
+    return out
+end
+
+function _convolve_method(name, method::Symbol)
+    method === :auto && return CONVOLVE_AUTO
+    method === :direct && return CONVOLVE_DIRECT
+    method === :fft && return CONVOLVE_FFT
+    throw(ArgumentError("$name: method must be :auto, :direct or :fft, got :$method"))
+end
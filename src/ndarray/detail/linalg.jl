@@ -105,6 +105,118 @@ function _solve(a::NDArray{T,N}, b::NDArray{S,M}) where {T,N,S,M}
     throw(ArgumentError("Batched matrices require signature (...,m,m),(...,m,n)->(...,m,n)"))
 end
 
+# Bits of the TRSM task's flags scalar; must match TrsmFlags in factor.h.
+const TRSM_LOWER = Int32(1)
+const TRSM_ADJOINT = Int32(2)
+const TRSM_UNIT = Int32(4)
+
+# Launches one of the host factorization tasks over the batch tiles of `a`,
+# laid out like `solve_batched`. Every operand shares `a`'s batch dimensions
+# and is kept whole in its last two, so each point task owns whole matrices.
+function factor_batched(task_id, scope, a::NDArray, inputs, outputs, scalars=())
+    tilesize, color_shape = prepare_manual_task_for_batched_matrices(size(a))
+    batch_tile = tilesize[1:(end - 2)]
+    tile(x) = Legate.partition_by_tiling(
+        nda_to_logical_store(x), collect((batch_tile..., size(x)[(end - 1):end]...))
+    )
+    tiled_in = [tile(x) for x in inputs]
+    tiled_out = [tile(x) for x in outputs]
+
+    @task_scope scope begin
+        rt = Legate.get_runtime()
+        domain = Legate.domain_from_shape(Legate.Shape(Legate.to_cxx_vector(color_shape)))
+        lib = cuNumeric.get_lib()
+        task = Legate.create_manual_task(rt, lib, task_id, domain)
+
+        foreach(p -> Legate.add_input(task, p), tiled_in)
+        foreach(p -> Legate.add_output(task, p), tiled_out)
+        foreach(s -> Legate.add_scalar(task, Legate.Scalar(s)), scalars)
+
+        Legate.submit_manual_task(rt, task)
+    end
+end
+
+# Per-matrix Int32 status with the batch shape of `a`, like LAPACK's info.
+_factor_info(a::NDArray{<:Any,N}) where {N} = nda_empty_array((size(a)[1:(N - 2)]..., 1, 1), Int32)
+
+# The first nonzero status, or 0 when every matrix succeeded.
+function _first_failure(info::NDArray)
+    host = Array(info)
+    i = findfirst(!iszero, host)
+    return isnothing(i) ? 0 : Int(host[i])
+end
+
+function potrf_batched(a::NDArray{T,N}) where {T,N}
+    l = nda_empty_array(size(a), T)
+    info = _factor_info(a)
+    prod(size(a)) == 0 || factor_batched(cuNumeric.POTRF, "potrf", a, (a,), (l, info))
+    return l, info
+end
+
+function getrf_batched(a::NDArray{T,N}) where {T,N}
+    k = min(size(a, N - 1), size(a, N))
+    lu = nda_empty_array(size(a), T)
+    piv = nda_empty_array((size(a)[1:(N - 2)]..., 1, k), Int32)
+    info = _factor_info(a)
+    prod(size(a)) == 0 || factor_batched(cuNumeric.GETRF, "getrf", a, (a,), (lu, piv, info))
+    return lu, piv, info
+end
+
+# `piv` is `nothing` or GETRF's (..., 1, k) interchanges, applied to `b` first.
+function trsm_batched(a::NDArray{T,N}, b::NDArray{T,N}, flags::Int32, piv=nothing) where {T,N}
+    x = nda_empty_array(size(b), T)
+    inputs = isnothing(piv) ? (a, b) : (a, b, piv)
+    prod(size(b)) == 0 || factor_batched(cuNumeric.TRSM, "trsm", a, inputs, (x,), (flags,))
+    return x
+end
+
+function _factor_promote(op, a::NDArray)
+    A = eltype(a)
+    A <: _SOLVE_ACCEPTED || throw(ArgumentError("array type $A is unsupported in $(op)"))
+    O = _solve_eltype(A)
+    A <: _SOLVE_PROMOTABLE && assertpromotion(op, A, O)
+    return unchecked_promote_arr(a, O)
+end
+
+function _factor_operands(op, a::NDArray{<:_SOLVE_ACCEPTED}, b::NDArray{<:_SOLVE_ACCEPTED})
+    A, B = eltype(a), eltype(b)
+    O = promote_type(_solve_eltype(A), _solve_eltype(B))
+    A <: _SOLVE_PROMOTABLE && assertpromotion(op, A, O)
+    B <: _SOLVE_PROMOTABLE && assertpromotion(op, B, O)
+    return unchecked_promote_arr(a, O), unchecked_promote_arr(b, O)
+end
+
+function _factor_operands(op, a::NDArray, b::NDArray)
+    bad = eltype(a) <: _SOLVE_ACCEPTED ? eltype(b) : eltype(a)
+    throw(ArgumentError("array type $bad is unsupported in $(op)"))
+end
+
+function _factor_check_dims(a::NDArray{<:Any,N}, name; square=true) where {N}
+    N >= 2 || throw(
+        ArgumentError("$(N)-dimensional array given. Array must be at least two-dimensional")
+    )
+    square && size(a, N - 1) != size(a, N) &&
+        throw(ArgumentError("$(name): last 2 dimensions of the array must be square"))
+    return a
+end
+
+# `b` is (..., n) or (..., n, k) against the (..., n, n) factor `a`. Returns
+# the 2-D-trailing right-hand side and whether it was a vector.
+function _factor_rhs(a::NDArray{<:Any,N}, b::NDArray{<:Any,M}, name) where {N,M}
+    vector = M == N - 1
+    (vector || M == N) || throw(
+        ArgumentError("$(name): batched matrices require signature (...,n,n),(...,n,k)->(...,n,k)")
+    )
+    rhs = vector ? reshape(b, (size(b)..., 1)) : b
+    size(rhs)[1:(N - 2)] == size(a)[1:(N - 2)] ||
+        throw(DimensionMismatch("$(name): batch dimensions differ: $(size(a)), $(size(b))"))
+    size(rhs, N - 1) == size(a, N) ||
+        throw(DimensionMismatch("$(name): factor is $(size(a, N))×$(size(a, N)) but b has $(size(rhs, N - 1)) rows"))
+    return rhs, vector
+end
+
+_drop_rhs_dim(x::NDArray, vector::Bool) = vector ? reshape(x, size(x)[1:(end - 1)]) : x
+
 function svd_single(a::NDArray{T,N}, u::NDArray, s::NDArray, vh::NDArray) where {T,N}
     rt = Legate.get_runtime()
     lib = cuNumeric.get_lib()
@@ -220,3 +332,124 @@ end
 function _qr_check_dims(a::NDArray)
     throw(ArgumentError("cuNumeric does not yet support stacked 2d arrays"))
 end
+
+function nda_batched_matmul!(c::NDArray{T,N}, a::NDArray{T,N}, b::NDArray{T,N}) where {T,N}
+    ok = @task_scope "batched_matmul" begin
+        ccall((:nda_batched_matmul, libnda),
+            Bool, (NDArray_t, NDArray_t, NDArray_t),
+            c.ptr, a.ptr, b.ptr)
+    end
+    ok || throw(ArgumentError("batched_mul: unsupported element type $(T)"))
+    return c
+end
+
+function _batched_mul_check_dims(c::NDArray{<:Any,N}, a::NDArray{<:Any,N}, b::NDArray{<:Any,N}) where {N}
+    N >= 2 || throw(ArgumentError("batched_mul requires at least two-dimensional arrays"))
+    batch = size(c)[1:(N - 2)]
+    (size(a)[1:(N - 2)] == batch && size(b)[1:(N - 2)] == batch) ||
+        throw(DimensionMismatch("batched_mul: batch dimensions differ: $(size(a)), $(size(b))"))
+    (size(a, N) == size(b, N - 1) && size(c, N - 1) == size(a, N - 1) && size(c, N) == size(b, N)) ||
+        throw(
+            DimensionMismatch(
+                "batched_mul: signature (...,m,k),(...,k,n)->(...,m,n) " *
+                "does not match $(size(a)), $(size(b)) -> $(size(c))",
+            ),
+        )
+    return nothing
+end
+
+function nda_gemm!(
+    c::NDArray{T,N}, a::NDArray{T,N}, transA::Bool, b::NDArray{T,N}, transB::Bool, alpha::T, beta::T
+) where {T,N}
+    ok = @task_scope "gemm" begin
+        ccall((:nda_gemm, libnda),
+            Bool, (NDArray_t, NDArray_t, Bool, NDArray_t, Bool, Ref{T}, Ref{T}),
+            c.ptr, a.ptr, transA, b.ptr, transB, alpha, beta)
+    end
+    ok || throw(ArgumentError("gemm!: unsupported element type $(T)"))
+    return c
+end
+
+# Shape of op(x) for the trailing two dims.
+_gemm_op_size(x::NDArray{<:Any,N}, trans::Bool) where {N} =
+    trans ? (size(x, N), size(x, N - 1)) : (size(x, N - 1), size(x, N))
+
+function _gemm_check_dims(
+    c::NDArray{<:Any,N}, a::NDArray{<:Any,N}, transA::Bool, b::NDArray{<:Any,N}, transB::Bool
+) where {N}
+    N >= 2 || throw(ArgumentError("gemm! requires at least two-dimensional arrays"))
+    batch = size(c)[1:(N - 2)]
+    (size(a)[1:(N - 2)] == batch && size(b)[1:(N - 2)] == batch) ||
+        throw(DimensionMismatch("gemm!: batch dimensions differ: $(size(a)), $(size(b))"))
+    (m, k), (kb, n) = _gemm_op_size(a, transA), _gemm_op_size(b, transB)
+    (k == kb && size(c, N - 1) == m && size(c, N) == n) || throw(
+        DimensionMismatch(
+            "gemm!: op(A) is $(m)×$(k) and op(B) is $(kb)×$(n), " *
+            "but C is $(size(c, N - 1))×$(size(c, N))",
+        ),
+    )
+    return nothing
+end
+
+function nda_matmul_mixed!(c::NDArray{O,N}, a::NDArray{T,N}, b::NDArray{T,N}, ::Type{Acc}) where {O,T,N,Acc}
+    legate_type = Legate.to_legate_type(Acc)
+    ok = @task_scope "matmul_mixed" begin
+        ccall((:nda_matmul_mixed, libnda),
+            Bool, (NDArray_t, NDArray_t, NDArray_t, Legate.LegateTypeAllocated),
+            c.ptr, a.ptr, b.ptr, legate_type)
+    end
+    ok || throw(ArgumentError("mixed_mul!: unsupported types $(T) -> $(Acc) -> $(O)"))
+    return c
+end
+
+function nda_einsum(subscripts::AbstractString, ops::Vector{NDArray{T}}) where {T}
+    op_ptrs = NDArray_t[op.ptr for op in ops]
+    ptr = @task_scope "einsum" begin
+        ccall((:nda_einsum, libnda),
+            NDArray_t, (Cstring, Int32, Ptr{NDArray_t}),
+            subscripts, Int32(length(ops)), op_ptrs)
+    end
+    ptr == C_NULL && throw(ArgumentError("einsum: invalid or unsupported subscripts \"$(subscripts)\""))
+    return NDArray(ptr; T=T)
+end
+
+function nda_tensordot(a::NDArray{T}, b::NDArray{T}, a_axes::Vector{Int32}, b_axes::Vector{Int32}) where {T}
+    ptr = @task_scope "tensordot" begin
+        ccall((:nda_tensordot, libnda),
+            NDArray_t, (NDArray_t, NDArray_t, Int32, Ptr{Int32}, Ptr{Int32}),
+            a.ptr, b.ptr, Int32(length(a_axes)), a_axes, b_axes)
+    end
+    ptr == C_NULL && throw(DimensionMismatch("tensordot: axes $(a_axes) and $(b_axes) do not match"))
+    return NDArray(ptr; T=T)
+end
+
+function nda_einsum_path(subscripts::AbstractString, shapes::Vector{<:Dims})
+    dims = Int32[length(s) for s in shapes]
+    flat = UInt64[e for s in shapes for e in s]
+    path = Vector{Int32}(undef, 2 * max(length(shapes) - 1, 0))
+    steps = ccall((:nda_einsum_path, libnda),
+        Int32, (Cstring, Int32, Ptr{Int32}, Ptr{UInt64}, Ptr{Int32}),
+        subscripts, Int32(length(shapes)), dims, flat, path)
+    steps < 0 && throw(ArgumentError("einsum: invalid subscripts \"$(subscripts)\" for shapes $(shapes)"))
+    return [(Int(path[2i - 1]) + 1, Int(path[2i]) + 1) for i in 1:steps]
+end
+
+function nda_csr_row_ranges(rowptr::NDArray{Int64,1})
+    ptr = @task_scope "csr_row_ranges" begin
+        ccall((:nda_csr_row_ranges, libnda), NDArray_t, (NDArray_t,), rowptr.ptr)
+    end
+    ptr == C_NULL && throw(ArgumentError("CSRMatrix: rowptr must be a non-empty Int64 vector"))
+    return ptr
+end
+
+for (fn, scope) in ((:nda_csr_spmv, "csr_spmv"), (:nda_csr_spmm, "csr_spmm"))
+    @eval function $(Symbol(fn, :!))(y::NDArray, ranges::NDArray_t, colind::NDArray, values::NDArray, x::NDArray)
+        ok = @task_scope $scope begin
+            ccall(($(QuoteNode(fn)), libnda),
+                Bool, (NDArray_t, NDArray_t, NDArray_t, NDArray_t, NDArray_t),
+                y.ptr, ranges, colind.ptr, values.ptr, x.ptr)
+        end
+        ok || throw(ArgumentError($(scope) * ": mismatched operand shapes or types"))
+        return y
+    end
+end
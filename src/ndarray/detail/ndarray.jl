@@ -34,6 +34,18 @@ nda_destroy_array(ptr::NDArray_t) = ccall((:nda_destroy_array, libnda),
 nda_nbytes(ptr::NDArray_t) = ccall((:nda_nbytes, libnda),
     Int64, (NDArray_t,), ptr)
 
+function nda_physical_footprint(ptr::NDArray_t)
+    out = Ref{MemoryFootprint}()
+    ccall((:nda_physical_footprint, libnda),
+        Cvoid, (NDArray_t, Ref{MemoryFootprint}), ptr, out)
+    return out[]
+end
+
+nda_track_spill(ptr::NDArray_t) = ccall((:nda_track_spill, libnda),
+    Cvoid, (NDArray_t,), ptr)
+nda_pin_spill(ptr::NDArray_t) = ccall((:nda_pin_spill, libnda),
+    Cvoid, (NDArray_t,), ptr)
+
 function get_julia_type(ptr::NDArray_t)
     type_code = ccall((:nda_array_type_code, libnda), Int32, (NDArray_t,), ptr)
     return Legate.code_type_map[type_code]
@@ -48,16 +60,17 @@ The NDArray type represents a multi-dimensional array in cuNumeric.
 It is a wrapper around a Legate array and provides various methods for array manipulation and operations.
 Finalizer calls `nda_destroy_array` to clean up the underlying Legate array when the NDArray is garbage collected.
 """
-mutable struct NDArray{T,N,PADDED,P} <: AbstractNDArray{T,N}
+mutable struct NDArray{T,N,P} <: AbstractNDArray{T,N}
     ptr::NDArray_t
     nbytes::Int64
-    padding::Union{Nothing,NTuple{N,Int}}
     parent::P
 
     function NDArray(ptr::NDArray_t, ::Type{T}, ::Val{N}) where {T,N}
         nbytes = cuNumeric.nda_nbytes(ptr)
         cuNumeric.register_alloc!(nbytes)
-        handle = new{T,N,false,Nothing}(ptr, nbytes, nothing, nothing)
+        # views carry a parent and must never be rebound by the spill manager
+        cuNumeric.SPILL_ENABLE[] && cuNumeric.nda_track_spill(ptr)
+        handle = new{T,N,Nothing}(ptr, nbytes, nothing)
         finalizer(_finalize_ndarray!, handle)
         return handle
     end
@@ -66,7 +79,7 @@ mutable struct NDArray{T,N,PADDED,P} <: AbstractNDArray{T,N}
     function NDArray(ptr::NDArray_t, ::Type{T}, ::Val{N}, parent::P) where {T,N,P}
         nbytes = cuNumeric.nda_nbytes(ptr)
         cuNumeric.register_alloc!(nbytes)
-        handle = new{T,N,false,P}(ptr, nbytes, nothing, parent)
+        handle = new{T,N,P}(ptr, nbytes, parent)
         finalizer(_finalize_ndarray!, handle)
         return handle
     end
@@ -116,19 +129,21 @@ end
 
 _scope_op(kind, op_code) = string(kind, "#", Int32(op_code))
 
-#! JUST USE FULL TO MAKE a 0D?
-# $ cuNumeric.nda_full_array(UInt64[], 2.0f0)
-# TODO DAVID TEST THIS HERE
-# function NDArray(value::T) where {T <: SUPPORTED_TYPES}
-#     type = Legate.to_legate_type(T)
-#     ptr = ccall((:nda_from_scalar, libnda),
-#         NDArray_t, (Legate.LegateTypeAllocated, Ptr{Cvoid}),
-#         type, Ref(value))
-#     return NDArray(ptr, T = T, n_dim = 1)
-# end
-
+# Writable 0-d array.
 NDArray(value::T) where {T<:SUPPORTED_TYPES} = nda_full_array((), value)
 
+# Read-only 0-d operand. Equal values share one cached scalar store, so
+# never pass the result as an output.
+function nda_from_scalar(value::T) where {T<:SUPPORTED_TYPES}
+    legate_type = Legate.to_legate_type(T)
+    ptr = @task_scope "from_scalar" begin
+        ccall((:nda_from_scalar, libnda),
+            NDArray_t, (Legate.LegateTypeAllocated, Ptr{Cvoid}),
+            legate_type, Ref(value))
+    end
+    return NDArray(ptr, T, Val(0))
+end
+
 # construction
 function nda_zeros_array(dims::Dims{N}, ::Type{T}) where {T,N}
     shape = collect(UInt64, dims)
@@ -141,6 +156,19 @@ function nda_zeros_array(dims::Dims{N}, ::Type{T}) where {T,N}
     return NDArray(ptr, T, Val(N))
 end
 
+# Allocated without a fill; a 0-d result is a future-backed scalar store. Reductions
+# into it still initialize it with their identity.
+function nda_empty_array(dims::Dims{N}, ::Type{T}) where {T,N}
+    shape = collect(UInt64, dims)
+    legate_type = Legate.to_legate_type(T)
+    ptr = @task_scope "empty" begin
+        ccall((:nda_empty_array, libnda),
+            NDArray_t, (Int32, Ptr{UInt64}, Legate.LegateTypeAllocated),
+            Int32(N), shape, legate_type)
+    end
+    return NDArray(ptr, T, Val(N))
+end
+
 function nda_full_array(dims::Dims{N}, value::T) where {T,N}
     shape = collect(UInt64, dims)
     type = Legate.to_legate_type(T)
@@ -189,6 +217,13 @@ nda_array_dim(arr::NDArray) = ccall((:nda_array_dim, libnda),
     Int32, (NDArray_t,), arr.ptr)
 nda_array_size(arr::NDArray) = ccall((:nda_array_size, libnda),
     Int32, (NDArray_t,), arr.ptr)
+function nda_read_scalar(arr::NDArray{T,0}) where {T}
+    value = Ref{T}()
+    ccall((:nda_read_scalar, libnda),
+        Cvoid, (NDArray_t, Ptr{Cvoid}),
+        arr.ptr, value)
+    return value[]
+end
 function nda_array_type_code(arr::NDArray)
     return ccall((:nda_array_type_code, libnda),
         Int32, (NDArray_t,), arr.ptr)
@@ -211,7 +246,27 @@ function nda_reshape_array(arr::NDArray{T}, newdims::Dims{N}) where {T,N}
             NDArray_t, (NDArray_t, Int32, Ptr{UInt64}),
             arr.ptr, Int32(N), newshape)
     end
-    return NDArray(ptr, T, Val(N))
+    # May alias `arr`'s store, so it must never be spilled on its own.
+    return NDArray(ptr, T, Val(N), arr)
+end
+
+# Julia broadcasting aligns leading dimensions; each one must match or be 1.
+function _broadcasts_to(src::Dims, dims::Dims)
+    length(src) <= length(dims) || return false
+    return all(i -> src[i] == dims[i] || src[i] == 1, eachindex(src))
+end
+
+function nda_broadcast_to(arr::NDArray{T}, dims::Dims{N}) where {T,N}
+    _broadcasts_to(size(arr), dims) ||
+        throw(DimensionMismatch("cannot broadcast array of size $(size(arr)) to $dims"))
+    newshape = collect(UInt64, dims)
+    ptr = @task_scope "broadcast_to" begin
+        ccall((:nda_broadcast_to, libnda),
+            NDArray_t, (NDArray_t, Int32, Ptr{UInt64}),
+            arr.ptr, Int32(N), newshape)
+    end
+    # Keep parent: the view aliases the source store.
+    return NDArray(ptr, T, Val(N), arr)
 end
 
 function nda_astype(arr::NDArray{OLD_T,N}, ::Type{NEW_T}) where {OLD_T,NEW_T,N}
@@ -289,6 +344,21 @@ function nda_unary_op!(out::NDArray, op_code::UnaryOpCode, input::NDArray)
     return out
 end
 
+# Deferred elementwise mode; leaving the outermost scope launches what was recorded.
+function nda_set_deferred(enabled::Bool)
+    @task_scope "deferred" begin
+        ccall((:nda_set_deferred, libnda), Cvoid, (Bool,), enabled)
+    end
+end
+
+function nda_flush_deferred()
+    @task_scope "flush_deferred" begin
+        ccall((:nda_flush_deferred, libnda), Cvoid, ())
+    end
+end
+
+nda_fused_expr_launches() = Int(ccall((:nda_fused_expr_launches, libnda), UInt64, ()))
+
 function nda_unary_reduction(out::NDArray, op_code::UnaryRedCode, input::NDArray)
     @task_scope _scope_op("reduce", op_code) begin
         ccall((:nda_unary_reduction, libnda),
@@ -298,16 +368,326 @@ function nda_unary_reduction(out::NDArray, op_code::UnaryRedCode, input::NDArray
     return out
 end
 
+# `U` is the accumulation/result type; cupynumeric casts inside the reduction,
+# so a wider accumulator does not need a promoted copy of `input`.
 function nda_unary_reduction_axes(
-    op_code::UnaryRedCode, input::NDArray{T,N}, axes::Vector{Int32}, keepdims::Bool
-) where {T,N}
+    op_code::UnaryRedCode, input::NDArray{T}, axes::Vector{Int32}, keepdims::Bool,
+    ::Type{U}=T; initial::Union{Nothing,U}=nothing, mask::Union{Nothing,NDArray{Bool}}=nothing,
+) where {T,U}
     axes_c = collect(Int32, axes)
+    legate_type = Legate.to_legate_type(U)
+    init = isnothing(initial) ? C_NULL : Ref(initial)
+    mask_ptr = isnothing(mask) ? C_NULL : mask.ptr
     ptr = @task_scope _scope_op("reduce_axes", op_code) begin
         ccall((:nda_unary_reduction_axes, libnda),
-            NDArray_t, (UnaryRedCode, NDArray_t, Ptr{Int32}, Int32, Cint),
-            op_code, input.ptr, axes_c, Int32(length(axes_c)), keepdims)
+            NDArray_t,
+            (UnaryRedCode, NDArray_t, Ptr{Int32}, Int32, Cint,
+                Legate.LegateTypeAllocated, Ptr{Cvoid}, NDArray_t),
+            op_code, input.ptr, axes_c, Int32(length(axes_c)), keepdims,
+            legate_type, init, mask_ptr)
     end
-    return NDArray(ptr)
+    ptr == C_NULL && _throw_unchained_reduction(op_code, axes_c)
+    return NDArray(ptr; T=U)
+end
+
+# In-place variant: accumulates in eltype(out). Empty `axes` reduces everything.
+function nda_unary_reduction_axes!(
+    out::NDArray{U}, op_code::UnaryRedCode, input::NDArray, axes::Vector{Int32},
+    keepdims::Bool; initial::Union{Nothing,U}=nothing,
+    mask::Union{Nothing,NDArray{Bool}}=nothing,
+) where {U}
+    axes_c = collect(Int32, axes)
+    init = isnothing(initial) ? C_NULL : Ref(initial)
+    mask_ptr = isnothing(mask) ? C_NULL : mask.ptr
+    ok = @task_scope _scope_op("reduce_axes!", op_code) begin
+        ccall((:nda_unary_reduction_axes_out, libnda),
+            Bool,
+            (NDArray_t, UnaryRedCode, NDArray_t, Ptr{Int32}, Int32, Cint,
+                Ptr{Cvoid}, NDArray_t),
+            out.ptr, op_code, input.ptr, axes_c, Int32(length(axes_c)), keepdims,
+            init, mask_ptr)
+    end
+    ok || _throw_unchained_reduction(op_code, axes_c)
+    return out
+end
+
+function _throw_unchained_reduction(op_code::UnaryRedCode, axes::Vector{Int32})
+    throw(
+        ArgumentError(
+            "reduction $(Int32(op_code)) cannot be split over axes $(axes .+ 1); " *
+            "reduce over a single dimension or over all of them",
+        ),
+    )
+end
+
+# Must match CN_STAT_* in ndarray_c_api.h
+const STAT_MEAN = Int32(1 << 16)
+const STAT_SAMPLE_VARIANCE = STAT_MEAN + Int32(1)
+
+function nda_multi_reduction!(outs::Vector{<:NDArray}, input::NDArray, codes::Vector{Int32})
+    out_ptrs = NDArray_t[out.ptr for out in outs]
+    ok = @task_scope "multi_reduction" begin
+        ccall((:nda_multi_reduction, libnda),
+            Bool,
+            (NDArray_t, Ptr{Int32}, Int32, Ptr{NDArray_t}),
+            input.ptr, codes, Int32(length(codes)), out_ptrs)
+    end
+    ok || throw(ArgumentError("multi_reduce: unsupported statistic or element type"))
+    return outs
+end
+
+# Must match CN_FFT_* in ndarray_c_api.h
+const FFT_C2C = Int32(0)
+const FFT_R2C = Int32(1)
+const FFT_C2R = Int32(2)
+
+function nda_fft!(out::NDArray, input::NDArray, kind::Int32, axes::Vector{Int32}, inverse::Bool)
+    ok = @task_scope "fft" begin
+        ccall((:nda_fft, libnda),
+            Bool, (NDArray_t, NDArray_t, Int32, Ptr{Int32}, Int32, Bool),
+            input.ptr, out.ptr, kind, axes, Int32(length(axes)), inverse)
+    end
+    ok || throw(ArgumentError("fft: unsupported axes, shapes or element types"))
+    return out
+end
+
+# Must match CN_CONVOLVE_* in ndarray_c_api.h. Boundary modes are PAD_*.
+const CONVOLVE_AUTO = Int32(0)
+const CONVOLVE_DIRECT = Int32(1)
+const CONVOLVE_FFT = Int32(2)
+
+function nda_convolve(
+    arr::NDArray{T,N}, weights::NDArray{T,N}, mode::Int32, flip::Bool, method::Int32, value::T
+) where {T,N}
+    type = Legate.to_legate_type(T)
+    ptr = @task_scope "convolve" begin
+        ccall((:nda_convolve, libnda),
+            NDArray_t,
+            (NDArray_t, NDArray_t, Int32, Bool, Int32, Legate.LegateTypeAllocated, Ptr{Cvoid}),
+            arr.ptr, weights.ptr, mode, flip, method, type, Ref(value))
+    end
+    ptr == C_NULL && throw(ArgumentError("convolve: unsupported element type, mode or method"))
+    return NDArray(ptr, T, Val(N))
+end
+
+# Must match CN_KRYLOV_* in ndarray_c_api.h
+const KRYLOV_DOTS = Int32(0)
+const KRYLOV_CG = Int32(1)
+const KRYLOV_CG_DIRECTION = Int32(2)
+const KRYLOV_PIPECG = Int32(3)
+const KRYLOV_BICG_S = Int32(4)
+const KRYLOV_BICG_X = Int32(5)
+const KRYLOV_BICG_P = Int32(6)
+
+# Returns the op's dot products as 0-d Float64 arrays without waiting on them.
+function nda_krylov(op::Int32, vecs::Vector{<:NDArray}, coeffs::Vector{<:NDArray})
+    vec_ptrs = NDArray_t[v.ptr for v in vecs]
+    coeff_ptrs = NDArray_t[c.ptr for c in coeffs]
+    dot_ptrs = Vector{NDArray_t}(undef, 4)
+    num_dots = Ref{Int32}(0)
+    ok = @task_scope "krylov" begin
+        ccall((:nda_krylov, libnda),
+            Bool,
+            (Int32, Int32, Ptr{NDArray_t}, Int32, Ptr{NDArray_t}, Ptr{NDArray_t}, Ptr{Int32}),
+            op, Int32(length(vecs)), vec_ptrs, Int32(length(coeffs)), coeff_ptrs,
+            dot_ptrs, num_dots)
+    end
+    ok || throw(ArgumentError("krylov: operands do not fit op $op"))
+    return NDArray{Float64,0}[NDArray(dot_ptrs[i], Float64, Val(0)) for i in 1:num_dots[]]
+end
+
+# Must match CN_SCAN_* in ndarray_c_api.h
+const SCAN_SUM = Int32(0)
+const SCAN_PROD = Int32(1)
+const SCAN_NANSUM = Int32(2)
+const SCAN_NANPROD = Int32(3)
+
+function nda_scan!(out::NDArray{T,N}, op::Int32, input::NDArray{T,N}, axis::Integer, inclusive::Bool) where {T,N}
+    ok = @task_scope "scan" begin
+        ccall((:nda_scan, libnda),
+            Bool, (NDArray_t, Int32, NDArray_t, Int32, Bool),
+            out.ptr, op, input.ptr, Int32(axis), inclusive)
+    end
+    ok || throw(ArgumentError("scan: unsupported op, axis or element type $(T)"))
+    return out
+end
+
+# Must match CN_INDEX_* in ndarray_c_api.h
+const INDEX_CLIP = Int32(0)
+const INDEX_WRAP = Int32(1)
+
+# Flat indices are 0-based; column_major=true matches Julia's linear indexing.
+function nda_take(arr::NDArray{T}, indices::NDArray{Int64,1}, mode::Int32, column_major::Bool) where {T}
+    ptr = @task_scope "take" begin
+        ccall((:nda_take, libnda),
+            NDArray_t, (NDArray_t, NDArray_t, Int32, Bool),
+            arr.ptr, indices.ptr, mode, column_major)
+    end
+    ptr == C_NULL && throw(ArgumentError("take: unsupported array or index mode"))
+    return NDArray(ptr, T, Val(1))
+end
+
+function nda_put!(arr::NDArray{T}, indices::NDArray{Int64,1}, values::NDArray{T,1}, mode::Int32,
+    column_major::Bool) where {T}
+    ok = @task_scope "put" begin
+        ccall((:nda_put, libnda),
+            Bool, (NDArray_t, NDArray_t, NDArray_t, Int32, Bool),
+            arr.ptr, indices.ptr, values.ptr, mode, column_major)
+    end
+    ok || throw(DimensionMismatch("put: $(length(values)) values for $(length(indices)) indices"))
+    return arr
+end
+
+function nda_compress(arr::NDArray{T,N}, mask::NDArray{Bool,N}, column_major::Bool) where {T,N}
+    ptr = @task_scope "compress" begin
+        ccall((:nda_compress, libnda),
+            NDArray_t, (NDArray_t, NDArray_t, Bool),
+            arr.ptr, mask.ptr, column_major)
+    end
+    ptr == C_NULL && throw(DimensionMismatch("mask of size $(size(mask)) for array of size $(size(arr))"))
+    return NDArray(ptr, T, Val(1))
+end
+
+function nda_mask_indices(mask::NDArray{Bool}, column_major::Bool)
+    ptr = @task_scope "mask_indices" begin
+        ccall((:nda_mask_indices, libnda),
+            NDArray_t, (NDArray_t, Bool),
+            mask.ptr, column_major)
+    end
+    ptr == C_NULL && throw(ArgumentError("mask_indices: 0-d mask"))
+    return NDArray(ptr, Int64, Val(1))
+end
+
+function nda_mask_fill!(arr::NDArray{T,N}, mask::NDArray{Bool,N}, value::T) where {T,N}
+    type = Legate.to_legate_type(T)
+    ok = @task_scope "mask_fill" begin
+        ccall((:nda_mask_fill, libnda),
+            Bool, (NDArray_t, NDArray_t, Legate.LegateTypeAllocated, Ptr{Cvoid}),
+            arr.ptr, mask.ptr, type, Ref(value))
+    end
+    ok || throw(DimensionMismatch("mask of size $(size(mask)) for array of size $(size(arr))"))
+    return arr
+end
+
+function nda_mask_assign!(arr::NDArray{T,N}, mask::NDArray{Bool,N}, values::NDArray{T,1},
+    column_major::Bool) where {T,N}
+    ok = @task_scope "mask_assign" begin
+        ccall((:nda_mask_assign, libnda),
+            Bool, (NDArray_t, NDArray_t, NDArray_t, Bool),
+            arr.ptr, mask.ptr, values.ptr, column_major)
+    end
+    ok || throw(DimensionMismatch("mask_assign: one value per true element of the mask is required"))
+    return arr
+end
+
+# coords: one column of 0-based coordinates per point
+function nda_gather_points(arr::NDArray{T,N}, coords::Matrix{Int64}) where {T,N}
+    n = size(coords, 2)
+    out = Vector{T}(undef, n)
+    ok = @task_scope "gather_points" begin
+        ccall((:nda_gather_points, libnda),
+            Bool, (NDArray_t, Ptr{Int64}, Int64, Ptr{Cvoid}),
+            arr.ptr, coords, n, out)
+    end
+    ok || throw(BoundsError(arr))
+    return out
+end
+
+function nda_scatter_points!(arr::NDArray{T,N}, coords::Matrix{Int64}, values::Vector{T}) where {T,N}
+    n = size(coords, 2)
+    length(values) == n || throw(DimensionMismatch("scatter_points: $(length(values)) values for $n points"))
+    ok = @task_scope "scatter_points" begin
+        ccall((:nda_scatter_points, libnda),
+            Bool, (NDArray_t, Ptr{Int64}, Ptr{Cvoid}, Int64),
+            arr.ptr, coords, values, n)
+    end
+    ok || throw(BoundsError(arr))
+    return arr
+end
+
+# Host view of the descriptor RunPTXTask packs for `arr`: element pointer,
+# extents and element strides (0 along broadcast dimensions).
+function nda_strided_descriptor(arr::NDArray{T,N}) where {T,N}
+    ptr = Ref{Ptr{Cvoid}}(C_NULL)
+    dims = Vector{UInt64}(undef, N)
+    strides = Vector{UInt64}(undef, N)
+    ok = ccall((:nda_strided_descriptor, libnda),
+        Bool, (NDArray_t, Ptr{Ptr{Cvoid}}, Ptr{UInt64}, Ptr{UInt64}),
+        arr.ptr, ptr, dims, strides)
+    ok || throw(ArgumentError("strided descriptor: 0-d arrays have none"))
+    return Ptr{T}(ptr[]), ntuple(d -> Int(dims[d]), N), ntuple(d -> Int(strides[d]), N)
+end
+
+# Must match CN_PAD_* in ndarray_c_api.h
+const PAD_CONSTANT = Int32(0)
+const PAD_EDGE = Int32(1)
+const PAD_WRAP = Int32(2)
+
+# widths: (before, after) for each dimension, flattened
+function nda_pad(arr::NDArray{T,N}, widths::Vector{UInt64}, mode::Int32, value::T) where {T,N}
+    type = Legate.to_legate_type(T)
+    ptr = @task_scope "pad" begin
+        ccall((:nda_pad, libnda),
+            NDArray_t, (NDArray_t, Ptr{UInt64}, Int32, Legate.LegateTypeAllocated, Ptr{Cvoid}),
+            arr.ptr, widths, mode, type, Ref(value))
+    end
+    ptr == C_NULL && throw(ArgumentError("pad: unsupported mode or edge/wrap padding of an empty dimension"))
+    return NDArray(ptr, T, Val(N))
+end
+
+# axis is 0-based
+function nda_concatenate(arrs::Vector{<:NDArray{T,N}}, axis::Int32) where {T,N}
+    arr_ptrs = NDArray_t[arr.ptr for arr in arrs]
+    ptr = @task_scope "concatenate" begin
+        ccall((:nda_concatenate, libnda),
+            NDArray_t, (Int32, Ptr{NDArray_t}, Int32),
+            Int32(length(arrs)), arr_ptrs, axis)
+    end
+    ptr == C_NULL && throw(DimensionMismatch("concatenate: arrays differ outside dimension $(axis + 1)"))
+    return NDArray(ptr, T, Val(N))
+end
+
+function nda_stack(arrs::Vector{<:NDArray{T,N}}, axis::Int32) where {T,N}
+    arr_ptrs = NDArray_t[arr.ptr for arr in arrs]
+    ptr = @task_scope "stack" begin
+        ccall((:nda_stack, libnda),
+            NDArray_t, (Int32, Ptr{NDArray_t}, Int32),
+            Int32(length(arrs)), arr_ptrs, axis)
+    end
+    ptr == C_NULL && throw(DimensionMismatch("stack: arrays must share one size"))
+    return NDArray(ptr, T, Val(N + 1))
+end
+
+function nda_checkpoint(
+    arrs::Vector{<:NDArray}, names::Vector{String}, dir::String, compress::Bool
+)
+    arr_ptrs = NDArray_t[arr.ptr for arr in arrs]
+    ok = @task_scope "checkpoint" begin
+        ccall((:nda_checkpoint, libnda),
+            Bool, (Int32, Ptr{NDArray_t}, Ptr{Cstring}, Cstring, Bool),
+            Int32(length(arrs)), arr_ptrs, names, dir, compress)
+    end
+    ok || error("checkpoint: failed to write $(join(names, ", ")) to $dir")
+    return nothing
+end
+
+# Must match CN_RESTORE_* in ndarray_c_api.h
+const RESTORE_OK = Int32(0)
+const RESTORE_MISSING = Int32(1)
+const RESTORE_CORRUPT = Int32(2)
+
+function nda_restore(names::Vector{String}, dir::String)
+    ptrs = Vector{NDArray_t}(undef, length(names))
+    status = @task_scope "restore" begin
+        ccall((:nda_restore, libnda),
+            Int32, (Int32, Ptr{Cstring}, Cstring, Ptr{NDArray_t}),
+            Int32(length(names)), names, dir, ptrs)
+    end
+    status == RESTORE_MISSING &&
+        throw(ArgumentError("restore: no checkpoint of $(join(names, ", ")) in $dir"))
+    status == RESTORE_CORRUPT &&
+        error("restore: the shards of $(join(names, ", ")) in $dir are incomplete or damaged")
+    return NDArray[NDArray(ptr) for ptr in ptrs]
 end
 
 function nda_array_equal(rhs1::NDArray{T,N}, rhs2::NDArray{T,N}) where {T,N}
@@ -346,7 +726,44 @@ function nda_ravel(arr::NDArray)
             NDArray_t, (NDArray_t,),
             arr.ptr)
     end
-    return NDArray(ptr)
+    # A view of `arr` when it is contiguous; never spilled on its own.
+    return NDArray(ptr, eltype(arr), Val(1), arr)
+end
+
+# axis is 0-based; a negative axis with flatten=true sorts the flattened array
+for (fn, scope) in ((:nda_sort, "sort"), (:nda_argsort, "argsort"))
+    @eval function $fn(arr::NDArray, axis::Integer, flatten::Bool, stable::Bool, descending::Bool)
+        ptr = @task_scope $scope begin
+            ccall(($(QuoteNode(fn)), libnda),
+                NDArray_t, (NDArray_t, Int32, Bool, Bool, Bool),
+                arr.ptr, Int32(axis), flatten, stable, descending)
+        end
+        ptr == C_NULL && throw(ArgumentError($(scope) * ": axis out of range"))
+        return NDArray(ptr)
+    end
+end
+
+for (fn, scope) in ((:nda_partition, "partition"), (:nda_argpartition, "argpartition"))
+    @eval function $fn(arr::NDArray, kth::Integer, axis::Integer)
+        ptr = @task_scope $scope begin
+            ccall(($(QuoteNode(fn)), libnda),
+                NDArray_t, (NDArray_t, Int64, Int32),
+                arr.ptr, Int64(kth), Int32(axis))
+        end
+        ptr == C_NULL && throw(ArgumentError($(scope) * ": axis or kth out of range"))
+        return NDArray(ptr)
+    end
+end
+
+function nda_topk!(values::NDArray{T,1}, indices::NDArray{Int64,1}, arr::NDArray{T}, k::Integer,
+    largest::Bool) where {T}
+    ok = @task_scope "topk" begin
+        ccall((:nda_topk, libnda),
+            Bool, (NDArray_t, Int64, Bool, NDArray_t, NDArray_t),
+            arr.ptr, Int64(k), largest, values.ptr, indices.ptr)
+    end
+    ok || throw(ArgumentError("topk: k must be in 1:length(arr) and the element type real"))
+    return values, indices
 end
 
 function nda_add(rhs1::NDArray, rhs2::NDArray, out::NDArray)
@@ -444,6 +861,8 @@ end
 
 # return underlying logical store to the NDArray obj
 function get_store(arr::NDArray)
+    # the store may outlive this call, so the spill manager must not rebind arr
+    SPILL_ENABLE[] && nda_pin_spill(arr.ptr)
     cxx_ptr = CxxWrap.CxxPtr{CN_NDArray}(arr.ptr)
     return _get_store(cxx_ptr)
 end
@@ -534,9 +953,7 @@ end
 
 Return the size of the given `NDArray`.
 """
-shape(arr::NDArray{<:Any,N,true}) where {N} = arr.padding
-
-function shape(arr::NDArray{<:Any,N,false}) where {N}
+function shape(arr::NDArray{<:Any,N}) where {N}
     shp = cuNumeric.nda_array_shape(arr)
     return ntuple(i -> Int(shp[i]), Val(N))
 end
@@ -0,0 +1,118 @@
+#= Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahal <naderrahhal2026@u.northwestern.edu>
+=#
+
+const _FFT_TYPES = Union{SUPPORTED_FLOAT_TYPES,SUPPORTED_COMPLEX_TYPES}
+
+function _fft_axes(name, a::NDArray{T,N}, dims) where {T,N}
+    T <: _FFT_TYPES || throw(ArgumentError("$name: unsupported element type $T"))
+    isempty(dims) && throw(ArgumentError("$name: dims must not be empty"))
+    all(d -> 1 <= d <= N, dims) ||
+        throw(ArgumentError("$name: dims=$dims out of range for a $N-dimensional NDArray"))
+    allunique(dims) || throw(ArgumentError("$name: dims=$dims repeats a dimension"))
+    return Int32[d - 1 for d in dims]
+end
+
+@doc"""
+    cuNumeric.fft(A::NDArray, dims=1:ndims(A))
+    cuNumeric.ifft(A::NDArray, dims=1:ndims(A))
+
+Discrete Fourier transform of `A` over `dims` (an integer or a collection),
+with the sign and scaling conventions of FFTW: `ifft` uses `exp(+2πi jk/n)`
+and divides by the product of the transformed lengths, so
+`ifft(fft(A)) ≈ A`. Real inputs are transformed as complex ones of the same
+precision; the result is `ComplexF32` or `ComplexF64`.
+
+Transforms run as CPU/OpenMP tasks, also on GPU builds, where the arrays are
+mapped to host memory. Each launch splits the array along a
+dimension it does not transform, so every task holds whole lines. When all
+dimensions are transformed, this takes two passes: first all dimensions but
+one, then that dimension on its own. Any length is supported (radix-2 for
+powers of two, Bluestein's algorithm otherwise). Host plans are cached (see
+[`fft_plan_cache_stats`](@ref)), so repeated transforms of one shape in a
+time loop skip planning.
+"""
+function fft(a::NDArray{T,N}, dims=1:N) where {T,N}
+    axes = _fft_axes("fft", a, dims)
+    out = nda_empty_array(size(a), complex(T))
+    return nda_fft!(out, a, FFT_C2C, axes, false)
+end
+
+function ifft(a::NDArray{T,N}, dims=1:N) where {T,N}
+    axes = _fft_axes("ifft", a, dims)
+    out = nda_empty_array(size(a), complex(T))
+    return nda_fft!(out, a, FFT_C2C, axes, true)
+end
+
+@doc"""
+    cuNumeric.rfft(A::NDArray{<:Real}, dims=1:ndims(A))
+    cuNumeric.irfft(A::NDArray{<:Complex}, d::Integer, dims=1:ndims(A))
+
+Real-input transform and its inverse, as in FFTW: `rfft` returns only the
+non-redundant half of the spectrum, shrinking `first(dims)` from `n` to
+`div(n, 2) + 1`. `irfft` takes the length `d` of that dimension in the real
+result and returns `A` scaled like [`ifft`](@ref), so
+`irfft(rfft(A), size(A, first(dims))) ≈ A`.
+"""
+function rfft(a::NDArray{T,N}, dims=1:N) where {T,N}
+    T <: SUPPORTED_FLOAT_TYPES || throw(ArgumentError("rfft: expected a real array, got $T"))
+    axes = _fft_axes("rfft", a, dims)
+    halved = axes[1] + 1
+    shape = ntuple(k -> k == halved ? div(size(a, k), 2) + 1 : size(a, k), N)
+    out = nda_empty_array(shape, complex(T))
+    return nda_fft!(out, a, FFT_R2C, axes, false)
+end
+
+function irfft(a::NDArray{T,N}, d::Integer, dims=1:N) where {T,N}
+    T <: SUPPORTED_COMPLEX_TYPES ||
+        throw(ArgumentError("irfft: expected a complex array, got $T"))
+    axes = _fft_axes("irfft", a, dims)
+    halved = axes[1] + 1
+    m = size(a, halved)
+    div(d, 2) + 1 == m ||
+        throw(DimensionMismatch("irfft: length $d does not fit $m entries along dimension $halved"))
+    shape = ntuple(k -> k == halved ? Int(d) : size(a, k), N)
+    out = nda_empty_array(shape, real(T))
+    return nda_fft!(out, a, FFT_C2R, axes, true)
+end
+
+# Mirrors CN_FFTPlanCacheStats in ndarray_c_api.h.
+struct FFTPlanCacheStats
+    hits::UInt64
+    misses::UInt64
+    evictions::UInt64
+    size::UInt64
+end
+
+@doc"""
+    fft_plan_cache_stats()
+
+Counters of the FFT plan cache. A plan (bit reversal, twiddles, Bluestein
+chirps for every transformed length) is built once per kind, precision, dims,
+transformed lengths and direction, and at most 64 are kept, least recently
+used dropped first. Returns an `FFTPlanCacheStats` with `hits`, `misses`,
+`evictions` and `size`, counted over the tasks run by this process.
+"""
+function fft_plan_cache_stats()
+    stats = Ref{FFTPlanCacheStats}()
+    ccall((:nda_fft_plan_cache_stats, libnda), Cvoid, (Ref{FFTPlanCacheStats},), stats)
+    return stats[]
+end
+
+clear_fft_plan_cache!() = ccall((:nda_clear_fft_plan_cache, libnda), Cvoid, ())
@@ -0,0 +1,203 @@
+#= Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahal <naderrahhal2026@u.northwestern.edu>
+=#
+
+@doc"""
+    KrylovStats
+
+Returned next to the solution by [`cg`](@ref) and [`bicgstab`](@ref).
+`residual` is the norm of the recurrence residual of the returned `x`,
+`iterations` the number of iterations run, and `converged` whether `residual`
+met the tolerance.
+"""
+struct KrylovStats
+    converged::Bool
+    iterations::Int
+    residual::Float64
+end
+
+# Operators: a square matrix, a CSR matrix, or `A(q, p)` storing A * p in q.
+_krylov_apply!(q::NDArray{T,1}, A::NDArray{T,2}, p::NDArray{T,1}) where {T} =
+    nda_three_dot_arg(A, p, q)
+_krylov_apply!(q::NDArray{T,1}, A::CSRMatrix{T}, p::NDArray{T,1}) where {T} = mul!(q, A, p)
+_krylov_apply!(q::NDArray, A, p::NDArray) = (A(q, p); q)
+
+function _krylov_check_operator(A::Union{NDArray,CSRMatrix}, ::Type{T}, n) where {T}
+    eltype(A) == T ||
+        throw(ArgumentError("operator has element type $(eltype(A)), right-hand side $T"))
+    size(A) == (n, n) ||
+        throw(DimensionMismatch("operator has size $(size(A)), expected ($n, $n)"))
+    return nothing
+end
+_krylov_check_operator(A, ::Type, n) = nothing
+
+# Convergence is tested on the squared residual norms the fused tasks reduce
+# into 0-d arrays. Every `every` iterations the one from the iteration before
+# is read; it is done by the time the current iteration has been queued, so
+# the host never waits for the reduction it just launched and the solve can
+# run up to `every` iterations past convergence.
+mutable struct _LaggedCheck
+    threshold::Float64
+    every::Int
+    previous::Union{Nothing,NDArray{Float64,0}}
+end
+
+function _converged!(check::_LaggedCheck, iteration::Int, rr::NDArray{Float64,0})
+    lagged, check.previous = check.previous, rr
+    (lagged === nothing || iteration % check.every != 0) && return false
+    residual = sqrt(nda_read_scalar(lagged))
+    return residual <= check.threshold || !isfinite(residual)
+end
+
+function _krylov_stats(check::_LaggedCheck, iterations::Int, rr::NDArray{Float64,0})
+    residual = sqrt(nda_read_scalar(rr))
+    return KrylovStats(residual <= check.threshold, iterations, residual)
+end
+
+# Initial guess, residual r = b - A x and the convergence test. Reads |b| and
+# |r| once.
+function _krylov_setup(A, b::NDArray{T,1}, x0, rtol, atol, maxiter, check_every) where {T}
+    n = length(b)
+    _krylov_check_operator(A, T, n)
+    maxiter >= 0 || throw(ArgumentError("maxiter must be non-negative, got $maxiter"))
+    check_every >= 1 || throw(ArgumentError("check_every must be positive, got $check_every"))
+    x = if isnothing(x0)
+        cuNumeric.zeros(T, n)
+    else
+        x0 isa NDArray{T,1} || throw(ArgumentError("x0 must be a 1-D NDArray{$T}"))
+        length(x0) == n ||
+            throw(DimensionMismatch("x0 has length $(length(x0)), expected $n"))
+        copy(x0)
+    end
+    r = b - _krylov_apply!(similar(b), A, x)
+    bb, rr = nda_krylov(KRYLOV_DOTS, [b, b, r, r], NDArray[])
+    threshold = max(rtol * sqrt(nda_read_scalar(bb)), Float64(atol))
+    return x, r, rr, _LaggedCheck(threshold, check_every, nothing)
+end
+
+@doc"""
+    cg(A, b; x0=nothing, rtol=sqrt(eps(T)), atol=0, maxiter=length(b),
+       check_every=8, pipelined=false) -> (x, stats::KrylovStats)
+
+Solves `A * x = b` for a symmetric positive definite `A` with the conjugate
+gradient method. `b` is a 1-D `Float32` or `Float64` array and `A` either a
+square `NDArray`, a [`CSRMatrix`](@ref), or any callable `A(q, p)` that
+stores `A * p` in `q` (matrix-free operators).
+
+Each iteration applies `A` once; the vector updates and the dot products they
+feed run as fused tasks that accumulate in `Float64`, and the step sizes stay
+in 0-d arrays that the next task reads, so they are never read back to Julia.
+The fused tasks run on CPU (and OpenMP) processors, also on GPU builds, where
+the vectors are mapped to host memory for them. With `pipelined=true` the
+Ghysels–Vanroose variant is used: one fused task per iteration whose
+reductions overlap the next operator application, at the price of an extra
+operator application up front and slightly less stable recurrences.
+
+Iteration stops once `norm(r) <= max(rtol * norm(b), atol)`. The residual is
+only read back every `check_every` iterations, one iteration late so the
+loop never waits on the reduction it just launched; the solve may therefore
+run up to `check_every` iterations past convergence.
+
+# Examples
+```julia
+x, stats = cuNumeric.cg(A, b; rtol=1e-8)
+x, stats = cuNumeric.cg((q, p) -> laplacian!(q, p), b; pipelined=true)
+```
+"""
+function cg(
+    A,
+    b::NDArray{T,1};
+    x0=nothing,
+    rtol::Real=sqrt(eps(T)),
+    atol::Real=0,
+    maxiter::Integer=length(b),
+    check_every::Integer=8,
+    pipelined::Bool=false,
+) where {T<:SUPPORTED_FLOAT_TYPES}
+    x, r, rr, check = _krylov_setup(A, b, x0, rtol, atol, maxiter, check_every)
+    sqrt(nda_read_scalar(rr)) <= check.threshold && return x, _krylov_stats(check, 0, rr)
+    return pipelined ? _pipecg!(x, r, A, check, maxiter) : _cg!(x, r, rr, A, check, maxiter)
+end
+
+function _cg!(x, r, rr, A, check, maxiter)
+    p = copy(r)
+    q = similar(r)
+    for i in 1:maxiter
+        _krylov_apply!(q, A, p)
+        pq, = nda_krylov(KRYLOV_DOTS, [p, q], NDArray[])
+        rr_new, = nda_krylov(KRYLOV_CG, [x, r, p, q], [rr, pq])
+        nda_krylov(KRYLOV_CG_DIRECTION, [p, r], [rr_new, rr])
+        rr = rr_new
+        _converged!(check, i, rr) && return x, _krylov_stats(check, i, rr)
+    end
+    return x, _krylov_stats(check, maxiter, rr)
+end
+
+function _pipecg!(x, r, A, check, maxiter)
+    w = _krylov_apply!(similar(r), A, r)
+    p, s, z, q = similar(r), similar(r), similar(r), similar(r)
+    gamma, delta = nda_krylov(KRYLOV_DOTS, [r, r, w, r], NDArray[])
+    coeffs = [gamma, delta]
+    for i in 1:maxiter
+        _krylov_apply!(q, A, w)
+        gamma_new, delta, alpha = nda_krylov(KRYLOV_PIPECG, [x, r, w, p, s, z, q], coeffs)
+        coeffs = [gamma_new, delta, gamma, alpha]
+        gamma = gamma_new
+        _converged!(check, i, gamma) && return x, _krylov_stats(check, i, gamma)
+    end
+    return x, _krylov_stats(check, maxiter, gamma)
+end
+
+@doc"""
+    bicgstab(A, b; x0=nothing, rtol=sqrt(eps(T)), atol=0, maxiter=length(b),
+             check_every=8) -> (x, stats::KrylovStats)
+
+Solves `A * x = b` for a general square `A` with BiCGStab. Operators,
+tolerances and the lagged convergence check are as for [`cg`](@ref). Each
+iteration applies `A` twice and runs four fused vector tasks. A breakdown
+(`rhat' * v == 0` or `t' * t == 0` with a nonzero residual) stalls the
+iteration instead of producing NaNs; it shows up as `converged == false`.
+"""
+function bicgstab(
+    A,
+    b::NDArray{T,1};
+    x0=nothing,
+    rtol::Real=sqrt(eps(T)),
+    atol::Real=0,
+    maxiter::Integer=length(b),
+    check_every::Integer=8,
+) where {T<:SUPPORTED_FLOAT_TYPES}
+    x, r, rr, check = _krylov_setup(A, b, x0, rtol, atol, maxiter, check_every)
+    sqrt(nda_read_scalar(rr)) <= check.threshold && return x, _krylov_stats(check, 0, rr)
+    rhat, p = copy(r), copy(r)
+    v, s, t = similar(r), similar(r), similar(r)
+    rho, = nda_krylov(KRYLOV_DOTS, [rhat, r], NDArray[])
+    for i in 1:maxiter
+        _krylov_apply!(v, A, p)
+        rv, = nda_krylov(KRYLOV_DOTS, [rhat, v], NDArray[])
+        nda_krylov(KRYLOV_BICG_S, [s, r, v], [rho, rv])
+        _krylov_apply!(t, A, s)
+        ts, tt = nda_krylov(KRYLOV_DOTS, [t, s, t, t], NDArray[])
+        rho_new, rr = nda_krylov(KRYLOV_BICG_X, [x, r, p, s, t, rhat], [rho, rv, ts, tt])
+        nda_krylov(KRYLOV_BICG_P, [p, r, v], [rho_new, rho, rv, ts, tt])
+        rho = rho_new
+        _converged!(check, i, rr) && return x, _krylov_stats(check, i, rr)
+    end
+    return x, _krylov_stats(check, maxiter, rr)
+end
@@ -46,3 +46,315 @@ end
 function qr(a::NDArray)
     throw(ArgumentError("array type $(eltype(a)) is unsupported in qr"))
 end
+
+"""
+    cuNumeric.cholesky(A; check=true)
+
+Lower Cholesky factor `L` of the Hermitian positive definite `A`, so that
+`A = L * L'`. `A` has shape `(..., n, n)`: leading dimensions are a batch and
+each matrix is factored on its own, with batches split across processors as
+for [`solve`](@ref). Only the lower triangle of `A` is read; the upper
+triangle of `L` is zero.
+
+With `check=true` a `LinearAlgebra.PosDefException` is thrown if any matrix is
+not positive definite, which waits for the factorization to finish. Pass the
+factor to [`cholesky_solve`](@ref) to factor once and solve many times.
+Element types are those of [`solve`](@ref). The factorization runs on CPU (and
+OpenMP) processors; on GPU builds the operands are mapped to host memory for
+it.
+
+```julia
+L = cuNumeric.cholesky(A)
+x = cuNumeric.cholesky_solve(L, b)
+```
+"""
+function cholesky(a::NDArray; check::Bool=true)
+    a = _factor_check_dims(_factor_promote(cholesky, a), "cholesky")
+    l, info = potrf_batched(a)
+    if check
+        status = _first_failure(info)
+        status == 0 || throw(LinearAlgebra.PosDefException(status))
+    end
+    return l
+end
+
+"""
+    cuNumeric.lu(A; check=true)
+
+LU factorization with partial pivoting of `A` (shape `(..., m, n)`), as
+LAPACK `getrf`. Returns `(F, piv)`: `F` holds the unit lower triangular `L`
+below its diagonal and `U` on and above it, and `piv` (`Int32`, shape
+`(..., min(m, n))`) lists, for each row in turn, the 1-based row it was
+swapped with.
+
+With `check=true` a `LinearAlgebra.SingularException` is thrown if a pivot is
+exactly zero; the factorization itself still completes, so `check=false`
+returns it. Pass the factors to [`lu_solve`](@ref) to solve many right-hand
+sides without refactorizing. Like [`cholesky`](@ref), this runs on CPU (and
+OpenMP) processors, also on GPU builds.
+
+```julia
+F, piv = cuNumeric.lu(A)
+x = cuNumeric.lu_solve(F, piv, b)
+```
+"""
+function lu(a::NDArray; check::Bool=true)
+    a = _factor_check_dims(_factor_promote(lu, a), "lu"; square=false)
+    f, piv, info = getrf_batched(a)
+    if check
+        status = _first_failure(info)
+        status == 0 || throw(LinearAlgebra.SingularException(status))
+    end
+    return f, reshape(piv, (size(piv)[1:(end - 2)]..., size(piv)[end]))
+end
+
+"""
+    cuNumeric.trsm(A, B; lower=true, adjoint=false, unit_diagonal=false)
+
+Solves `op(A) * X = B` for the triangular `A` (shape `(..., n, n)`), where
+`op(A)` is `A` or, with `adjoint=true`, `A'`. Only the triangle selected by
+`lower` is read, and `unit_diagonal=true` treats the diagonal as ones. `B` has
+shape `(..., n)` or `(..., n, k)` and the result has the shape of `B`. Runs on
+CPU (and OpenMP) processors, also on GPU builds.
+"""
+function trsm(
+    a::NDArray, b::NDArray; lower::Bool=true, adjoint::Bool=false, unit_diagonal::Bool=false
+)
+    a, b = _factor_operands(trsm, a, b)
+    rhs, vector = _factor_rhs(_factor_check_dims(a, "trsm"), b, "trsm")
+    flags =
+        (lower ? TRSM_LOWER : Int32(0)) | (adjoint ? TRSM_ADJOINT : Int32(0)) |
+        (unit_diagonal ? TRSM_UNIT : Int32(0))
+    return _drop_rhs_dim(trsm_batched(a, rhs, flags), vector)
+end
+
+"""
+    cuNumeric.cholesky_solve(L, B)
+
+Solves `A * X = B` given `L = cuNumeric.cholesky(A)`, with two triangular
+solves and no refactorization. Shapes are as for [`trsm`](@ref).
+"""
+function cholesky_solve(l::NDArray, b::NDArray)
+    l, b = _factor_operands(cholesky_solve, l, b)
+    rhs, vector = _factor_rhs(_factor_check_dims(l, "cholesky_solve"), b, "cholesky_solve")
+    y = trsm_batched(l, rhs, TRSM_LOWER)
+    return _drop_rhs_dim(trsm_batched(l, y, TRSM_LOWER | TRSM_ADJOINT), vector)
+end
+
+"""
+    cuNumeric.lu_solve(F, piv, B)
+
+Solves `A * X = B` given `F, piv = cuNumeric.lu(A)` for square `A`. The row
+interchanges are applied inside the first of the two triangular solves.
+Shapes are as for [`trsm`](@ref).
+"""
+function lu_solve(f::NDArray, piv::NDArray{Int32}, b::NDArray)
+    f, b = _factor_operands(lu_solve, f, b)
+    N = ndims(f)
+    rhs, vector = _factor_rhs(_factor_check_dims(f, "lu_solve"), b, "lu_solve")
+    size(piv) == (size(f)[1:(N - 2)]..., size(f, N)) ||
+        throw(DimensionMismatch("lu_solve: pivots of size $(size(piv)) do not match factors $(size(f))"))
+    swaps = reshape(piv, (size(piv)[1:(end - 1)]..., 1, size(piv)[end]))
+    y = trsm_batched(f, rhs, TRSM_LOWER | TRSM_UNIT, swaps)
+    return _drop_rhs_dim(trsm_batched(f, y, Int32(0)), vector)
+end
+
+"""
+    cuNumeric.batched_mul(A, B)
+    cuNumeric.batched_mul!(C, A, B)
+
+Multiply stacks of matrices: `C[..., :, :] = A[..., :, :] * B[..., :, :]`.
+
+`A` has shape `(..., m, k)` and `B` has shape `(..., k, n)` with the same
+leading (batch) dimensions. The batch is split across processors and each
+task calls BLAS `gemm` once per matrix, so thousands of small products cost
+one task launch per processor instead of one per product.
+
+Element types are `Float32`, `Float64`, `ComplexF32` and `ComplexF64`. Mixed
+inputs promote like `*`. Runs on CPU (and OpenMP) processors.
+"""
+function batched_mul(a::NDArray{A,N}, b::NDArray{B,N}) where {A,B,N}
+    T = __my_promote_type(A, B)
+    N >= 2 || throw(ArgumentError("batched_mul requires at least two-dimensional arrays"))
+    c = nda_empty_array((size(a)[1:(N - 1)]..., size(b, N)), T)
+    return batched_mul!(c, a, b)
+end
+
+function batched_mul!(c::NDArray{T,N}, a::NDArray{A,N}, b::NDArray{B,N}) where {T,A,B,N}
+    T <: SUPPORTED_GEMM_TYPES ||
+        throw(ArgumentError("array type $(T) is unsupported in batched_mul"))
+    _batched_mul_check_dims(c, a, b)
+    if size(a, N) == 0 # empty inner dimension, BLAS would read nothing
+        fill!(c, zero(T))
+        return c
+    end
+    pa = checked_promote_arr(a, T)
+    pb = checked_promote_arr(b, T)
+    nda_batched_matmul!(c, pa, pb)
+    pa === a || destroy!(pa)
+    pb === b || destroy!(pb)
+    return c
+end
+
+"""
+    cuNumeric.gemm!(C, A, B; transA=false, transB=false, alpha=1, beta=0)
+
+Overwrite `C` with `alpha * op(A) * op(B) + beta * C`, where `op` transposes
+its argument when the matching flag is set. Leading dimensions are batch
+dimensions, as in [`batched_mul!`](@ref).
+
+The scaling, the accumulation into `C` and the transposes all happen inside
+one BLAS `gemm` call per matrix, so no transposed copy of `A`/`B` or scaled
+temporary is materialized. When `beta` is zero `C` is not read.
+
+`C` must be `Float32`, `Float64`, `ComplexF32` or `ComplexF64`; `A` and `B`
+promote to its element type. Runs on CPU (and OpenMP) processors.
+
+```julia
+C = cuNumeric.ones(Float64, 3, 3)
+cuNumeric.gemm!(C, A, B; transA=true, alpha=2.0, beta=1.0)  # C = 2AᵀB + C
+```
+"""
+function gemm!(
+    c::NDArray{T,N}, a::NDArray{A,N}, b::NDArray{B,N};
+    transA::Bool=false, transB::Bool=false, alpha::Number=one(T), beta::Number=zero(T),
+) where {T,A,B,N}
+    T <: SUPPORTED_GEMM_TYPES ||
+        throw(ArgumentError("array type $(T) is unsupported in gemm!"))
+    _gemm_check_dims(c, a, transA, b, transB)
+    pa = checked_promote_arr(a, T)
+    pb = checked_promote_arr(b, T)
+    nda_gemm!(c, pa, transA, pb, transB, convert(T, alpha), convert(T, beta))
+    pa === a || destroy!(pa)
+    pb === b || destroy!(pb)
+    return c
+end
+
+"""
+    LinearAlgebra.mul!(C::NDArray, A::NDArray, B::NDArray, α, β)
+
+Five-argument `mul!`: `C = A * B * α + C * β` in a single BLAS `gemm`
+per tile. See [`gemm!`](@ref) for transposed operands.
+"""
+function LinearAlgebra.mul!(
+    c::NDArray{T,2}, a::NDArray{<:Any,2}, b::NDArray{<:Any,2}, alpha::Number, beta::Number
+) where {T<:SUPPORTED_GEMM_TYPES}
+    return gemm!(c, a, b; alpha=alpha, beta=beta)
+end
+
+"""
+    cuNumeric.mixed_mul(A, B, Acc; out=eltype(A))
+    cuNumeric.mixed_mul!(C, A, B, Acc)
+
+Matrix (or batched, see [`batched_mul`](@ref)) product with products summed
+in `Acc` instead of the storage type, and the result rounded once into the
+element type of `C` (`out`).
+
+This keeps low-precision storage usable for long inner dimensions: e.g.
+`Float32` inputs with `Float64` accumulation, or `Float16` inputs with
+`Float32` accumulation, at the memory and bandwidth cost of the narrow type.
+`A` and `B` must share an element type. Storage and output types are
+`Float16`, `Float32` and `Float64`; `Acc` is `Float32` or `Float64`. Runs on
+CPU (and OpenMP) processors.
+
+```julia
+A = cuNumeric.rand(Float32, 4096, 4096)
+B = cuNumeric.rand(Float32, 4096, 4096)
+C = cuNumeric.mixed_mul(A, B, Float64)               # Float32 result
+C64 = cuNumeric.mixed_mul(A, B, Float64; out=Float64)
+```
+"""
+function mixed_mul(a::NDArray{T,N}, b::NDArray{T,N}, ::Type{Acc}; out::Type=T) where {T,N,Acc}
+    N >= 2 || throw(ArgumentError("mixed_mul requires at least two-dimensional arrays"))
+    c = nda_empty_array((size(a)[1:(N - 1)]..., size(b, N)), out)
+    return mixed_mul!(c, a, b, Acc)
+end
+
+function mixed_mul!(c::NDArray{O,N}, a::NDArray{T,N}, b::NDArray{T,N}, ::Type{Acc}) where {O,T,N,Acc}
+    (T <: SUPPORTED_MIXED_GEMM_TYPES && O <: SUPPORTED_MIXED_GEMM_TYPES) ||
+        throw(ArgumentError("mixed_mul! does not support $(T) inputs with a $(O) result"))
+    Acc <: SUPPORTED_ACCUMULATION_TYPES ||
+        throw(ArgumentError("mixed_mul! cannot accumulate in $(Acc)"))
+    _gemm_check_dims(c, a, false, b, false)
+    return nda_matmul_mixed!(c, a, b, Acc)
+end
+
+function mixed_mul!(c::NDArray, a::NDArray, b::NDArray, ::Type{Acc}) where {Acc}
+    throw(ArgumentError("mixed_mul! requires A and B to share an element type"))
+end
+
+"""
+    cuNumeric.einsum(subscripts, operands...)
+
+Einstein summation in numpy notation, e.g. `einsum("ij,jk,kl->il", A, B, C)`.
+Without `->` the output holds the indices used once, in alphabetical order.
+Indices are single letters naming array dimensions in Julia order.
+
+Operands are contracted two at a time in the order that minimizes the total
+multiply-add count (searched exhaustively for up to six operands, greedily
+beyond), and each pairwise contraction runs as one batched `gemm`. The order
+is cached per subscripts and shapes; see [`einsum_path`](@ref).
+
+Multi-operand expressions promote to a common `Float32`, `Float64`,
+`ComplexF32` or `ComplexF64` type. Ellipses and repeated indices within one
+operand (diagonals) are not supported.
+"""
+function einsum(subscripts::AbstractString, operands::NDArray...)
+    isempty(operands) && throw(ArgumentError("einsum requires at least one operand"))
+    T = reduce(__my_promote_type, map(eltype, operands))
+    length(operands) == 1 || T <: SUPPORTED_GEMM_TYPES ||
+        throw(ArgumentError("array type $(T) is unsupported in einsum"))
+    ops = NDArray{T}[checked_promote_arr(op, T) for op in operands]
+    result = nda_einsum(subscripts, ops)
+    for (op, p) in zip(operands, ops)
+        p === op || destroy!(p)
+    end
+    return result
+end
+
+"""
+    cuNumeric.einsum_path(subscripts, shapes...)
+
+The contraction order [`einsum`](@ref) uses for operands of the given
+shapes: a vector of `(i, j)` pairs of positions in the operand list, where
+each step removes both operands and appends their product.
+
+```julia
+cuNumeric.einsum_path("ij,jk,kl->il", (1000, 1000), (1000, 1000), (1000, 10))
+# [(2, 3), (1, 2)]: contract B*C first
+```
+"""
+function einsum_path(subscripts::AbstractString, shapes::Dims...)
+    return nda_einsum_path(subscripts, collect(Dims, shapes))
+end
+
+"""
+    cuNumeric.tensordot(A, B, axes=2)
+    cuNumeric.tensordot(A, B, (A_axes, B_axes))
+
+Sum products over the given axes of `A` and `B`, as `numpy.tensordot`. An
+integer contracts the last `axes` dimensions of `A` with the first `axes` of
+`B`. The result has the free dimensions of `A` followed by those of `B`.
+Runs through [`einsum`](@ref).
+"""
+function tensordot(a::NDArray, b::NDArray, axes::Integer=2)
+    return tensordot(a, b, (collect((ndims(a) - axes + 1):ndims(a)), collect(1:axes)))
+end
+
+function tensordot(a::NDArray, b::NDArray, axes::Tuple{Any,Any})
+    a_axes, b_axes = collect(Int, axes[1]), collect(Int, axes[2])
+    length(a_axes) == length(b_axes) ||
+        throw(DimensionMismatch("tensordot: $(length(a_axes)) axes of A against $(length(b_axes)) of B"))
+    for (i, j) in zip(a_axes, b_axes)
+        size(a, i) == size(b, j) ||
+            throw(DimensionMismatch("tensordot: size(A, $i) = $(size(a, i)) but size(B, $j) = $(size(b, j))"))
+    end
+    T = __my_promote_type(eltype(a), eltype(b))
+    T <: SUPPORTED_GEMM_TYPES ||
+        throw(ArgumentError("array type $(T) is unsupported in tensordot"))
+    pa, pb = checked_promote_arr(a, T), checked_promote_arr(b, T)
+    result = nda_tensordot(pa, pb, Int32.(a_axes .- 1), Int32.(b_axes .- 1))
+    pa === a || destroy!(pa)
+    pb === b || destroy!(pb)
+    return result
+end
@@ -259,6 +259,7 @@ size(arr, 2)
 """
 Base.size(arr::NDArray{<:Any,N}) where {N} = cuNumeric.shape(arr)
 Base.size(arr::NDArray, dim::Int) = Base.size(arr)[dim]
+Base.length(arr::NDArray) = prod(size(arr))
 Base.isempty(arr::NDArray) = any(==(0), size(arr))
 
 @doc"""
@@ -349,17 +350,17 @@ Array(A)
 ```
  """
 ##### REGULAR ARRAY INDEXING ####
-function Base.getindex(arr::NDArray{T,N}, idxs::Vararg{Int,N}) where {T<:SUPPORTED_NUMERIC_TYPES,N}
+function Base.getindex(arr::NDArray{T,N}, idxs::Vararg{Int,N}) where {T<:SUPPORTED_ELEMENT_TYPES,N}
     assertscalar("getindex")
     acc = NDArrayAccessor{T,N}()
     return read(acc, arr.ptr, to_cpp_index(idxs))
 end
 
-function Base.getindex(arr::NDArray{T,0}) where {T<:SUPPORTED_NUMERIC_TYPES}
+# 0-d arrays (e.g. full reductions) are future-backed; reading one waits on
+# that future only.
+function Base.getindex(arr::NDArray{T,0}) where {T<:SUPPORTED_ELEMENT_TYPES}
     assertscalar("getindex")
-    acc = NDArrayAccessor{T,1}()
-    zero_index = StdVector([UInt64(0)]) #! CAN I PREALLOCATE THIS SOMEHOW
-    return read(acc, arr.ptr, zero_index)
+    return nda_read_scalar(arr)
 end
 
 function Base.getindex(arr::NDArray{Bool,N}, idxs::Vararg{Int,N}) where {N}
@@ -370,9 +371,7 @@ end
 
 function Base.getindex(arr::NDArray{Bool,0})
     assertscalar("getindex")
-    acc = NDArrayAccessor{CxxWrap.CxxBool,1}()
-    zero_index = StdVector([UInt64(0)]) #! CAN I PREALLOCATE THIS SOMEHOW
-    return read(acc, arr.ptr, zero_index)
+    return nda_read_scalar(arr)
 end
 
 #! TODO SUPPORT CONVERSION OF VALUES
@@ -391,7 +390,7 @@ function Base.setindex!(arr::NDArray{T,N}, value, idxs::Vararg{Int,N}) where {T,
     return _setindex!(Val{N}(), arr, convert(T, value), idxs...)
 end
 
-function _setindex!(::Val{0}, arr::NDArray{T,0}, value::T) where {T<:SUPPORTED_NUMERIC_TYPES}
+function _setindex!(::Val{0}, arr::NDArray{T,0}, value::T) where {T<:SUPPORTED_ELEMENT_TYPES}
     acc = NDArrayAccessor{T,1}()
     return write(acc, arr.ptr, StdVector(UInt64[0]), value)
 end
@@ -403,7 +402,7 @@ end
 
 function _setindex!(
     ::Val{N}, arr::NDArray{T,N}, value::T, idxs::Vararg{Int,N}
-) where {T<:SUPPORTED_NUMERIC_TYPES,N}
+) where {T<:SUPPORTED_ELEMENT_TYPES,N}
     acc = NDArrayAccessor{T,N}()
     return write(acc, arr.ptr, to_cpp_index(idxs), value)
 end
@@ -517,6 +516,108 @@ end
 
 Base.fill!(arr::NDArray{T}, val::T) where {T} = nda_fill_array(arr, val)
 
+#### INDEX-ARRAY AND MASK INDEXING ####
+# Index arrays stay on the device. Integer indices are Julia linear indices
+# (1-based, column-major); masks select in the same order.
+@doc"""
+    arr[idx::NDArray{<:Integer,1}]
+    arr[idx::NDArray{<:Integer,1}] = vals
+    arr[mask::NDArray{Bool}]
+    arr[mask::NDArray{Bool}] = vals
+
+Gather, scatter and boolean-mask indexing with index arrays that stay in
+Legate stores. `arr[idx]` returns the elements at the linear indices `idx`;
+`arr[mask]` returns those where `mask` (the size of `arr`) is true, in
+column-major order. Assignment takes a scalar or one value per index / true
+element. With repeated indices, one of the assigned values wins.
+
+Bounds checks on `idx` read its minimum and maximum back to the host.
+"""
+function Base.getindex(arr::NDArray{T}, idx::NDArray{<:Base.BitInteger,1}) where {T}
+    flat = _zero_based_indices(arr, idx)
+    out = nda_take(arr, flat, INDEX_CLIP, true)
+    destroy!(flat)
+    return out
+end
+
+function Base.setindex!(arr::NDArray{T}, vals::NDArray{T,1}, idx::NDArray{<:Base.BitInteger,1}) where {T}
+    flat = _zero_based_indices(arr, idx)
+    nda_put!(arr, flat, vals, INDEX_CLIP, true)
+    destroy!(flat)
+    return arr
+end
+
+function Base.setindex!(arr::NDArray{T}, val, idx::NDArray{<:Base.BitInteger,1}) where {T}
+    vals = nda_full_array((length(idx),), convert(T, val))
+    arr[idx] = vals
+    destroy!(vals)
+    return arr
+end
+
+function Base.getindex(arr::NDArray{T,N}, mask::NDArray{Bool,N}) where {T,N}
+    return nda_compress(arr, mask, true)
+end
+
+function Base.setindex!(arr::NDArray{T,N}, vals::NDArray{T,1}, mask::NDArray{Bool,N}) where {T,N}
+    return nda_mask_assign!(arr, mask, vals, true)
+end
+
+function Base.setindex!(arr::NDArray{T,N}, val, mask::NDArray{Bool,N}) where {T,N}
+    return nda_mask_fill!(arr, mask, convert(T, val))
+end
+
+@doc"""
+    cuNumeric.gather_points(arr::NDArray{T,N}, points) -> Vector{T}
+    cuNumeric.scatter_points!(arr::NDArray{T,N}, points, values)
+
+Read or write a list of scattered elements in one task instead of one
+`@allowscalar` access per point. `points` is a vector of `CartesianIndex{N}`
+or an `N × n` integer matrix with one 1-based point per column. Gathering
+waits once for all values; scattering does not wait.
+
+# Examples
+```julia
+probes = [CartesianIndex(1, 5), CartesianIndex(20, 7)]
+vals = cuNumeric.gather_points(u, probes)
+cuNumeric.scatter_points!(u, probes, zeros(2))
+```
+"""
+function gather_points(arr::NDArray{T,N}, points) where {T,N}
+    return nda_gather_points(arr, _point_coords(points, Val(N)))
+end
+
+function scatter_points!(arr::NDArray{T,N}, points, values::AbstractVector) where {T,N}
+    return nda_scatter_points!(arr, _point_coords(points, Val(N)), convert(Vector{T}, values))
+end
+
+function _point_coords(points::AbstractVector{CartesianIndex{N}}, ::Val{N}) where {N}
+    coords = Matrix{Int64}(undef, N, length(points))
+    for (j, I) in enumerate(points), d in 1:N
+        coords[d, j] = I[d] - 1
+    end
+    return coords
+end
+
+function _point_coords(points::AbstractMatrix{<:Integer}, ::Val{N}) where {N}
+    size(points, 1) == N ||
+        throw(DimensionMismatch("points have $(size(points, 1)) coordinates, array has $N dimensions"))
+    return Int64.(points) .- 1
+end
+
+function _zero_based_indices(arr::NDArray, idx::NDArray{I,1}) where {I}
+    if length(idx) > 0
+        lo = @allowscalar minimum(idx)[]
+        hi = @allowscalar maximum(idx)[]
+        lo < 1 && throw(BoundsError(arr, lo))
+        hi > length(arr) && throw(BoundsError(arr, hi))
+    end
+    shifted = idx .- one(I)
+    I === Int64 && return shifted
+    flat = as_type(shifted, Int64)
+    destroy!(shifted)
+    return flat
+end
+
 #### INITIALIZATION OF NDARRAYS ####
 @doc"""
     cuNumeric.fill(val::T, dims::Dims)
@@ -732,6 +833,132 @@ function reshape(arr::NDArray, i::Int...; copy::Val{C}=Val(false)) where {C}
     return reshape(arr, i; copy=Val{C}())
 end
 
+@doc"""
+    cuNumeric.broadcast_to(arr::NDArray, dims::Dims)
+    cuNumeric.broadcast_to(arr::NDArray, dims::Int...)
+
+Return a read-only view of `arr` expanded to `dims` under Julia's broadcasting
+rules: dimensions line up from the front and each must equal the target or
+be 1. Expanded dimensions have stride 0, so no data is copied. Writing into
+the view is not supported.
+
+# Examples
+```@repl
+v = cuNumeric.ones(3)
+cuNumeric.broadcast_to(v, (3, 4))
+```
+"""
+broadcast_to(arr::NDArray, dims::Dims) = nda_broadcast_to(arr, dims)
+broadcast_to(arr::NDArray, dims::Int...) = broadcast_to(arr, dims)
+
+@doc"""
+    cuNumeric.pad(arr::NDArray, widths; mode=:constant, value=zero(eltype(arr)))
+
+Return `arr` with a border added around every dimension. `widths` is one
+integer for every side, a tuple with one width per dimension, or a tuple of
+`(before, after)` pairs. `mode` selects how the border is filled:
+
+- `:constant` uses `value`
+- `:edge` repeats the nearest element of `arr`
+- `:wrap` continues periodically from the opposite side (ghost layers)
+
+The interior is one copy of `arr` and every border region one fill or copy,
+so each output element is written once and no zeroed temporary is made. No
+tile receives the whole source, even for `:wrap`, and it runs on GPUs too.
+
+# Examples
+```@repl
+u = cuNumeric.rand(4, 4)
+cuNumeric.pad(u, 1; mode=:wrap)
+cuNumeric.pad(u, ((1, 0), (0, 2)); value=-1.0)
+```
+"""
+function pad(
+    arr::NDArray{T,N}, widths::NTuple{N,Tuple{Integer,Integer}}; mode::Symbol=:constant,
+    value=zero(T),
+) where {T,N}
+    all(w -> w[1] >= 0 && w[2] >= 0, widths) ||
+        throw(ArgumentError("pad: widths must be non-negative, got $widths"))
+    flat = UInt64[w for pair in widths for w in pair]
+    return nda_pad(arr, flat, _pad_mode(mode), convert(T, value))
+end
+
+function pad(arr::NDArray{<:Any,N}, widths::NTuple{N,Integer}; kwargs...) where {N}
+    return pad(arr, map(w -> (w, w), widths); kwargs...)
+end
+
+function pad(arr::NDArray{<:Any,N}, width::Integer; kwargs...) where {N}
+    return pad(arr, ntuple(_ -> (width, width), N); kwargs...)
+end
+
+function _pad_mode(mode::Symbol)
+    mode === :constant && return PAD_CONSTANT
+    mode === :edge && return PAD_EDGE
+    mode === :wrap && return PAD_WRAP
+    throw(ArgumentError("pad: mode must be :constant, :edge or :wrap, got :$mode"))
+end
+
+# Promote to the common element type and add trailing singleton dimensions,
+# as Base.cat does for e.g. hcat of vectors.
+function _join_operand(arr::NDArray, ::Type{T}, N::Int) where {T}
+    promoted = unchecked_promote_arr(arr, T)
+    ndims(promoted) == N && return promoted
+    dims = ntuple(d -> d <= ndims(promoted) ? size(promoted)[d] : 1, N)
+    reshaped = reshape(promoted, dims)
+    promoted !== arr && destroy!(promoted)
+    return reshaped
+end
+
+@doc"""
+    cat(arrs::NDArray...; dims::Integer)
+    vcat(arrs::NDArray...)
+    hcat(arrs::NDArray...)
+
+Concatenate NDArrays along dimension `dims`. Element types are promoted and
+arrays of lower rank gain trailing singleton dimensions, as in Base. Each
+input is copied straight into its slice of the result.
+"""
+function Base.cat(arrs::NDArray...; dims::Integer)
+    dims >= 1 || throw(ArgumentError("cat: dims must be positive, got $dims"))
+    T = promote_type(map(eltype, arrs)...)
+    N = max(Int(dims), maximum(ndims, arrs))
+    parts = NDArray{T,N}[_join_operand(arr, T, N) for arr in arrs]
+    result = nda_concatenate(parts, Int32(dims - 1))
+    for (part, arr) in zip(parts, arrs)
+        part !== arr && destroy!(part)
+    end
+    return result
+end
+
+Base.vcat(arrs::NDArray...) = cat(arrs...; dims=1)
+Base.hcat(arrs::NDArray...) = cat(arrs...; dims=2)
+
+@doc"""
+    stack(arrs::AbstractVector{<:NDArray}; dims=:)
+    stack(arrs::Tuple{Vararg{NDArray}}; dims=:)
+
+Join equally sized NDArrays along a new dimension `dims` (by default after the
+last one), as Base.stack does for arrays.
+"""
+function Base.stack(arrs::AbstractVector{<:NDArray}; dims=:)
+    isempty(arrs) && throw(ArgumentError("stack: no arrays given"))
+    sz = size(first(arrs))
+    N = length(sz)
+    all(arr -> size(arr) == sz, arrs) ||
+        throw(DimensionMismatch("stack: arrays must share one size"))
+    d = dims isa Colon ? N + 1 : Int(dims)
+    1 <= d <= N + 1 || throw(ArgumentError("stack: dims must be in 1:$(N + 1), got $d"))
+    T = promote_type(map(eltype, arrs)...)
+    parts = NDArray{T,N}[unchecked_promote_arr(arr, T) for arr in arrs]
+    result = nda_stack(parts, Int32(d - 1))
+    for (part, arr) in zip(parts, arrs)
+        part !== arr && destroy!(part)
+    end
+    return result
+end
+
+Base.stack(arrs::Tuple{Vararg{NDArray}}; dims=:) = stack(collect(arrs); dims=dims)
+
 # Ignore the scalar indexing here...
 unwrap(x::NDArray{<:Any,0}) = @allowscalar x[]
 unwrap(x::NDArray{<:Any,1}) = @allowscalar x[][1] # assumes 1 element
@@ -875,3 +1102,27 @@ function h5read(path::String, dataset::String; kwargs...)
     arr = NDArray(ptr, T, Val(N), nothing)
     return la.order === :col && N > 1 ? transpose(arr) : arr
 end
+
+@doc"""
+    physical_footprint(arr::NDArray) -> MemoryFootprint
+    physical_bytes(arr::NDArray) -> Int
+
+Bytes of the instances backing `arr`, by memory kind, as Legate maps the array
+for a task over all of it. Unlike the predicted `eltype(arr)` size times
+`length(arr)`, this includes padding and layout; broadcast dimensions and
+scalar stores cost what they really cost. A view reports the part of its
+parent's instances it covers. Runs a small probe task and waits for it, so
+use it for diagnostics rather than in hot loops. The probe maps `arr` like any
+other task, so measuring can itself move the array or create an instance for
+it (for example the first time a lazily initialized array is touched, or when
+its data lives in another memory than the probe runs in):
+
+```julia
+sort(arrays; by=cuNumeric.physical_bytes, rev=true)  # biggest first
+```
+
+See also [`allocated_footprint`](@ref).
+"""
+physical_footprint(arr::NDArray) = nda_physical_footprint(arr.ptr)
+
+physical_bytes(arr::NDArray) = sum(physical_footprint(arr))
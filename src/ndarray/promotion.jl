@@ -11,8 +11,9 @@ end
 
 unchecked_promote_arr(arr::NDArray{T}, ::Type{T}) where {T} = arr
 unchecked_promote_arr(arr::NDArray{T}, ::Type{S}) where {T,S} = as_type(arr, S)
-# Unfused broadcast leaves Numbers as scalars until promote; always a fresh 0-d array.
-unchecked_promote_arr(x::Number, ::Type{T}) where {T} = NDArray(T(x))
+# Unfused broadcast leaves Numbers as scalars until promote. The 0-d result shares a
+# cached read-only store (see `nda_from_scalar`), so callers only pass it as an input.
+unchecked_promote_arr(x::Number, ::Type{T}) where {T} = nda_from_scalar(T(x))
 
 # Fusion keeps Numbers as scalars in the PTX arg buffer (no 0-d NDArray).
 unchecked_promote_scalar(x::Number, ::Type{T}) where {T} = T(x)
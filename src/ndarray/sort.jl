@@ -0,0 +1,111 @@
+#= Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahal <naderrahhal2026@u.northwestern.edu>
+=#
+
+@doc"""
+    sort(arr::NDArray; dims, rev=false, stable=false)
+
+Sort `arr` along `dims` (which may be omitted for vectors) and return a new
+`NDArray`. `rev=true` sorts in descending order. NaNs sort last in ascending
+order. `stable=true` keeps equal elements in their original order, with
+`rev=true` as well, as `Base.sort` does.
+"""
+function Base.sort(arr::NDArray{T,N}; dims=nothing, rev::Bool=false, stable::Bool=false) where {T,N}
+    return nda_sort(arr, _sort_axis(arr, dims), false, stable, rev)
+end
+
+@doc"""
+    sortperm(arr::NDArray{T,1}; rev=false)
+
+Return the 1-based permutation that sorts the vector `arr`, as an
+`NDArray{Int64,1}`. The sort is stable, so equal elements keep their order
+with either `rev`, matching `Base.sortperm`.
+"""
+function Base.sortperm(arr::NDArray{T,1}; rev::Bool=false) where {T}
+    return argsort(arr; rev=rev, stable=true)
+end
+
+@doc"""
+    cuNumeric.argsort(arr::NDArray; dims, rev=false, stable=false)
+
+Like [`sort`](@ref) but returns the 1-based positions along `dims` of the
+sorted elements instead of the elements themselves.
+"""
+function argsort(arr::NDArray{T,N}; dims=nothing, rev::Bool=false, stable::Bool=false) where {T,N}
+    idx = nda_argsort(arr, _sort_axis(arr, dims), false, stable, rev)
+    out = idx .+ one(eltype(idx))
+    destroy!(idx)
+    return out
+end
+
+@doc"""
+    cuNumeric.partition(arr::NDArray, k::Integer; dims=1)
+    cuNumeric.argpartition(arr::NDArray, k::Integer; dims=1)
+
+Reorder `arr` along `dims` so the element at position `k` is the one a full
+sort would put there, everything before it is no larger and everything after
+it no smaller (numpy's `partition`). `argpartition` returns the 1-based
+positions instead. Both currently run a full sort along `dims`, so they cost
+O(n log n) rather than the O(n) of a selection.
+"""
+function partition(arr::NDArray{T,N}, k::Integer; dims::Integer=1) where {T,N}
+    return nda_partition(arr, k - 1, _sort_axis(arr, dims))
+end
+
+function argpartition(arr::NDArray{T,N}, k::Integer; dims::Integer=1) where {T,N}
+    idx = nda_argpartition(arr, k - 1, _sort_axis(arr, dims))
+    out = idx .+ one(eltype(idx))
+    destroy!(idx)
+    return out
+end
+
+@doc"""
+    cuNumeric.topk(arr::NDArray, k::Integer; rev=true)
+
+Return the `k` largest elements of `arr` (the smallest with `rev=false`) as an
+`NDArray{T,1}`, best first, together with a host `Vector` of their indices:
+`Int`s for a vector, `CartesianIndex`es otherwise. NaN ranks above every
+number and ties go to the element with the lower linear index.
+
+Each processor keeps a heap of its `k` best candidates; only those
+`k × nprocs` candidates are merged, so the array is never sorted.
+"""
+function topk(arr::NDArray{T,N}, k::Integer; rev::Bool=true) where {T,N}
+    1 <= k <= length(arr) || throw(ArgumentError("topk: k must be in 1:$(length(arr)), got $k"))
+    T <: Complex && throw(ArgumentError("topk: complex arrays have no ordering"))
+    values = nda_empty_array((Int(k),), T)
+    indices = nda_empty_array((Int(k),), Int64)
+    nda_topk!(values, indices, arr, k, rev)
+    flat = Array(indices)
+    destroy!(indices)
+    return values, _topk_indices(flat, size(arr))
+end
+
+# The task reports 0-based column-major flat indices, i.e. linear indices minus one.
+_topk_indices(flat::Vector{Int64}, ::Dims{1}) = Int.(flat) .+ 1
+_topk_indices(flat::Vector{Int64}, dims::Dims) = CartesianIndices(dims)[flat .+ 1]
+
+function _sort_axis(arr::NDArray{T,N}, dims) where {T,N}
+    if isnothing(dims)
+        N == 1 || throw(ArgumentError("dims must be given to sort a $N-dimensional NDArray"))
+        return 0
+    end
+    1 <= dims <= N || throw(ArgumentError("dims=$dims out of range for a $N-dimensional NDArray"))
+    return dims - 1
+end
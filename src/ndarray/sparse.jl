@@ -0,0 +1,168 @@
+#= Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+=#
+
+@doc"""
+    cuNumeric.CSRMatrix(rowptr, colind, values, dims)
+    cuNumeric.CSRMatrix(m, n, rowptr::Vector, colind::Vector, values::Vector)
+    cuNumeric.CSRMatrix(A::AbstractMatrix)
+
+Compressed sparse row matrix of size `dims` held in three 1-d `NDArray`s:
+`rowptr` (`m + 1` entries), `colind` and `values` (one entry per stored
+element). Storage is O(nnz) instead of O(m n).
+
+The first form takes device arrays with 0-based `Int64` indices. The second
+takes host vectors in Julia's 1-based convention, and the third stores the
+nonzeros of a host matrix. `rowptr` must start at the first stored entry,
+never decrease and end one past the last, and every column index must lie
+within `dims[2]`; otherwise an `ArgumentError` is thrown.
+
+`A * x`, `A * X` and `mul!(y, A, x)` run as SpMV/SpMM tasks partitioned by
+row blocks; each block only touches the entries of `x` its columns reference.
+Values are `Float32`, `Float64`, `ComplexF32` or `ComplexF64`.
+"""
+mutable struct CSRMatrix{T}
+    # Per-row [start, end] ranges built from rowptr; the form the tasks take.
+    ranges::NDArray_t
+    nbytes::Int64
+    rowptr::NDArray{Int64,1}
+    colind::NDArray{Int64,1}
+    values::NDArray{T,1}
+    dims::NTuple{2,Int}
+
+    function CSRMatrix(
+        rowptr::NDArray{Int64,1}, colind::NDArray{Int64,1}, values::NDArray{T,1}, dims::NTuple{2,Int}
+    ) where {T}
+        T <: SUPPORTED_SPARSE_TYPES ||
+            throw(ArgumentError("array type $(T) is unsupported in CSRMatrix"))
+        length(rowptr) == dims[1] + 1 ||
+            throw(DimensionMismatch("CSRMatrix: rowptr has $(length(rowptr)) entries for $(dims[1]) rows"))
+        length(colind) == length(values) ||
+            throw(DimensionMismatch("CSRMatrix: $(length(colind)) column indices for $(length(values)) values"))
+        _check_csr_indices(rowptr, colind, dims)
+        ranges = nda_csr_row_ranges(rowptr)
+        nbytes = nda_nbytes(ranges)
+        register_alloc!(nbytes)
+        handle = new{T}(ranges, nbytes, rowptr, colind, values, dims)
+        finalizer(_finalize_csr!, handle)
+        return handle
+    end
+end
+
+# A few reductions and two scalar reads, so malformed indices fail here rather
+# than as out-of-bounds accesses inside the SpMV tasks.
+function _check_csr_indices(
+    rowptr::NDArray{Int64,1}, colind::NDArray{Int64,1}, dims::NTuple{2,Int}
+)
+    m, n = dims
+    nnz = length(colind)
+    lo, hi = @allowscalar (rowptr[1], rowptr[m + 1])
+    lo == 0 || throw(ArgumentError("CSRMatrix: rowptr must start at 0, got $lo"))
+    hi == nnz ||
+        throw(ArgumentError("CSRMatrix: rowptr ends at $hi but there are $nnz stored entries"))
+    if m > 1
+        steps = rowptr[2:(m + 1)] .- rowptr[1:m]
+        step = @allowscalar minimum(steps)[]
+        destroy!(steps)
+        step >= 0 || throw(ArgumentError("CSRMatrix: rowptr must be nondecreasing"))
+    end
+    if nnz > 0
+        first_col = @allowscalar minimum(colind)[]
+        last_col = @allowscalar maximum(colind)[]
+        (first_col >= 0 && last_col < n) || throw(
+            ArgumentError("CSRMatrix: column indices span $first_col:$last_col, not in 0:$(n - 1)")
+        )
+    end
+    return nothing
+end
+
+function _finalize_csr!(A::CSRMatrix)
+    ptr = A.ranges
+    ptr == C_NULL && return nothing
+    A.ranges = Ptr{Cvoid}(0)
+    A.nbytes > 0 && register_free!(A.nbytes)
+    A.nbytes = 0
+    _enqueue_free!(ptr)
+    return nothing
+end
+
+function CSRMatrix(
+    m::Integer, n::Integer, rowptr::AbstractVector{<:Integer}, colind::AbstractVector{<:Integer},
+    values::AbstractVector{T},
+) where {T}
+    return CSRMatrix(
+        NDArray(Int64.(rowptr) .- 1), NDArray(Int64.(colind) .- 1), NDArray(collect(values)),
+        (Int(m), Int(n)),
+    )
+end
+
+function CSRMatrix(A::AbstractMatrix{T}) where {T}
+    m, n = size(A)
+    rowptr = Vector{Int64}(undef, m + 1)
+    colind = Int64[]
+    values = T[]
+    rowptr[1] = 1
+    for i in 1:m
+        for j in 1:n
+            v = A[i, j]
+            iszero(v) && continue
+            push!(colind, j)
+            push!(values, v)
+        end
+        rowptr[i + 1] = length(values) + 1
+    end
+    return CSRMatrix(m, n, rowptr, colind, values)
+end
+
+Base.size(A::CSRMatrix) = A.dims
+Base.size(A::CSRMatrix, d::Integer) = d <= 2 ? A.dims[d] : 1
+Base.eltype(::CSRMatrix{T}) where {T} = T
+
+"""
+    cuNumeric.nnz(A::CSRMatrix)
+
+Number of stored entries.
+"""
+nnz(A::CSRMatrix) = length(A.values)
+
+function _check_spmul(y::NDArray, A::CSRMatrix, x::NDArray)
+    size(x, 1) == size(A, 2) ||
+        throw(DimensionMismatch("CSRMatrix is $(size(A)) but x has $(size(x, 1)) rows"))
+    (size(y, 1) == size(A, 1) && (ndims(x) == 1 || size(y, 2) == size(x, 2))) ||
+        throw(DimensionMismatch("output is $(size(y)) for a $(size(A)) matrix times $(size(x))"))
+    return nothing
+end
+
+function LinearAlgebra.mul!(y::NDArray{T,1}, A::CSRMatrix{T}, x::NDArray{T,1}) where {T}
+    _check_spmul(y, A, x)
+    return nda_csr_spmv!(y, A.ranges, A.colind, A.values, x)
+end
+
+function LinearAlgebra.mul!(y::NDArray{T,2}, A::CSRMatrix{T}, x::NDArray{T,2}) where {T}
+    _check_spmul(y, A, x)
+    return nda_csr_spmm!(y, A.ranges, A.colind, A.values, x)
+end
+
+function Base.:(*)(A::CSRMatrix{T}, x::NDArray{X,N}) where {T,X,N}
+    N <= 2 || throw(ArgumentError("CSRMatrix can only multiply vectors and matrices"))
+    px = checked_promote_arr(x, T)
+    y = nda_empty_array(N == 1 ? (size(A, 1),) : (size(A, 1), size(x, 2)), T)
+    mul!(y, A, px)
+    px === x || destroy!(px)
+    return y
+end
@@ -232,7 +232,13 @@ The following unary reduction operations are supported and can be applied direct
 These operations follow standard Julia semantics.
 
 Reduction over specific dimensions is supported via the `dims` keyword argument,
-following the same semantics as Julia's base reduction functions.
+following the same semantics as Julia's base reduction functions. `init` seeds
+the reduction and `mask` (an `NDArray{Bool}` broadcastable to the input) skips
+masked-out elements inside the reduction task. When the result type is wider
+than the input (e.g. `sum` of `Int32`), accumulation happens in the wider type
+without first copying the input. The in-place forms `sum!`, `prod!`,
+`maximum!` and `minimum!` reduce into an existing array and accumulate in its
+element type.
 
 Examples
 --------
@@ -250,6 +256,12 @@ sum(B, dims=2)    # 3×1 result
 
 # Reduce over multiple dimensions
 sum(B, dims=(1,2))  # 1×1 result
+
+# Masked reduction with a starting value
+sum(B; mask=B .> 0.5f0, init=1.0f0)
+
+# Accumulate a Float32 array in Float64
+sum!(cuNumeric.zeros(Float64, 1, 4), B)
 ```
 """
 global const unary_reduction_map = Dict{Function,UnaryRedCode}(
@@ -271,74 +283,94 @@ global const unary_reduction_map = Dict{Function,UnaryRedCode}(
 )
 
 #! IT WOULD BE NICE IF THESE JUST RETURNED SCALARS WHEN APPROPRIATE
-# #*TODO HOW TO GET THESE ACTING ON CERTAIN DIMS
 
-function _unary_reduction_apply(out, op_code, input::NDArray{T}, ::Type{T}) where {T}
-    return nda_unary_reduction(out, op_code, input)
-end
+_reduction_init(::Nothing, ::Type) = nothing
+_reduction_init(init, ::Type{T}) where {T} = convert(T, init)
 
-function _unary_reduction_apply(out, op_code, input::NDArray, ::Type{U}) where {U}
-    promoted = unchecked_promote_arr(input, U)  # always a new array when U ≠ eltype
-    result = nda_unary_reduction(out, op_code, promoted)
-    destroy!(promoted)
-    return result
-end
+_reduction_axes(::Colon) = Int32[]
+_reduction_axes(dims::Integer) = Int32[dims - 1]
+_reduction_axes(dims) = collect(Int32, (d - 1 for d in dims))
 
-function _unary_reduction_axes_apply(op_code, input::NDArray{T}, ::Type{T}, axes) where {T}
-    return nda_unary_reduction_axes(op_code, input, axes, true)
+function _unary_reduction_apply(
+    out, op_code, input::NDArray{T}, ::Type{T}, ::Nothing, ::Nothing
+) where {T}
+    return nda_unary_reduction(out, op_code, input)
 end
 
-function _unary_reduction_axes_apply(op_code, input::NDArray, ::Type{U}, axes) where {U}
-    promoted = unchecked_promote_arr(input, U)  # always a new array when U ≠ eltype
-    result = nda_unary_reduction_axes(op_code, promoted, axes, true)
-    destroy!(promoted)
-    return result
+# A wider accumulator, `init` or `mask` go through the full reduction entry
+# point, which casts/masks inside the task instead of materializing temps.
+function _unary_reduction_apply(out, op_code, input::NDArray, ::Type, init, mask)
+    return nda_unary_reduction_axes!(out, op_code, input, Int32[], false; initial=init, mask=mask)
 end
 
-function _unary_reduction_impl(base_func, op_code, input::NDArray{T}, ::Colon) where {T}
+function _unary_reduction_impl(
+    base_func, op_code, input::NDArray{T}, ::Colon; init=nothing, mask=nothing
+) where {T}
     T_OUT = Base.promote_op(base_func, Vector{T})
     is_wider_type(T_OUT, T) && assertpromotion(base_func, T, T_OUT)
-    out = cuNumeric.zeros(T_OUT)
-    return _unary_reduction_apply(out, op_code, input, T_OUT)
+    out = nda_empty_array((), T_OUT) # the reduction fills in its identity
+    return _unary_reduction_apply(
+        out, op_code, input, T_OUT, _reduction_init(init, T_OUT), mask
+    )
 end
 
-function _unary_reduction_impl(base_func, op_code, input::NDArray{T,N}, dims::Integer) where {T,N}
+function _unary_reduction_impl(
+    base_func, op_code, input::NDArray{T,N}, dims; init=nothing, mask=nothing
+) where {T,N}
     T_OUT = Base.promote_op(base_func, Vector{T})
     is_wider_type(T_OUT, T) && assertpromotion(base_func, T, T_OUT)
-    axes = Int32[dims - 1]
-    return _unary_reduction_axes_apply(op_code, input, T_OUT, axes)
-end
-
-function _unary_reduction_impl(base_func, op_code, input::NDArray{T,N}, dims::Tuple) where {T,N}
-    if length(dims) > 1
-        error(
-            "$(base_func): reducing over multiple dimensions is not yet supported. Got dims=$dims"
-        )
+    axes = _reduction_axes(dims)
+    all(d -> 0 <= d < N, axes) ||
+        throw(ArgumentError("$(base_func): dims=$(dims) out of range for a $(N)-d array"))
+    return nda_unary_reduction_axes(
+        op_code, input, axes, true, T_OUT; initial=_reduction_init(init, T_OUT), mask=mask
+    )
+end
+
+# `r` keeps the reduced dims as singletons (Base `sum!` semantics) and fixes the
+# accumulation type, e.g. `sum!(zeros(Float64, 1, n), A::NDArray{Float32})`.
+function _unary_reduction_into!(base_func, op_code, r::NDArray{U,N}, A::NDArray{T,N}) where {U,T,N}
+    axes = Int32[]
+    for d in 1:N
+        if size(r, d) == 1 && size(A, d) != 1
+            push!(axes, d - 1)
+        elseif size(r, d) != size(A, d)
+            throw(
+                DimensionMismatch("$(base_func): cannot reduce $(size(A)) into $(size(r))")
+            )
+        end
     end
-    # single element tuple
-    T_OUT = Base.promote_op(base_func, Vector{T})
-    is_wider_type(T_OUT, T) && assertpromotion(base_func, T, T_OUT)
-    axes = Int32[dims[1] - 1]
-    return _unary_reduction_axes_apply(op_code, input, T_OUT, axes)
+    if isempty(axes) # nothing to reduce, Base copies `A` into `r`
+        promoted = unchecked_promote_arr(A, U)
+        copyto!(r, promoted)
+        promoted === A || destroy!(promoted)
+        return r
+    end
+    return nda_unary_reduction_axes!(r, op_code, A, axes, true)
 end
 
 # Generate code for all unary reductions.
 for (base_func, op_code) in unary_reduction_map
     @eval begin
-        function $(Symbol(base_func))(input::NDArray{T,N}; dims=Colon()) where {T,N}
-            return _unary_reduction_impl($base_func, $(op_code), input, dims)
+        function $(Symbol(base_func))(
+            input::NDArray{T,N}; dims=Colon(), init=nothing, mask=nothing
+        ) where {T,N}
+            return _unary_reduction_impl($base_func, $(op_code), input, dims; init=init, mask=mask)
+        end
+
+        function Base.$(Symbol(base_func, :!))(r::NDArray, A::NDArray)
+            return _unary_reduction_into!($base_func, $(op_code), r, A)
         end
     end
 end
 
 function _bool_reduction_impl(op_code, input::NDArray{Bool}, ::Colon)
-    out = cuNumeric.zeros(Bool)
+    out = nda_empty_array((), Bool)
     return nda_unary_reduction(out, op_code, input)
 end
 
 function _bool_reduction_impl(op_code, input::NDArray{Bool}, dims)
-    axes = collect(Int32, (d - 1 for d in (dims isa Integer ? (dims,) : dims)))
-    return nda_unary_reduction_axes(op_code, input, axes, true)
+    return nda_unary_reduction_axes(op_code, input, _reduction_axes(dims), true)
 end
 
 function Base.all(input::NDArray{Bool}; dims=Colon())
@@ -355,6 +387,116 @@ function Base.prod(input::NDArray{Bool}; dims=Colon())
     return _unary_reduction_impl(Base.prod, cuNumeric.ALL, input, dims)
 end
 
+global const multi_reduction_map = Dict{Symbol,Int32}(
+    :minimum => Int32(cuNumeric.MIN),
+    :maximum => Int32(cuNumeric.MAX),
+    :sum => Int32(cuNumeric.SUM),
+    :sum_squares => Int32(cuNumeric.SUM_SQUARES),
+    :count_nonzero => Int32(cuNumeric.COUNT_NONZERO),
+    :mean => STAT_MEAN,
+    :var => STAT_SAMPLE_VARIANCE,
+    :var_population => Int32(cuNumeric.VARIANCE),
+)
+
+"""
+    multi_reduce(arr::NDArray, stats::Symbol...)
+
+Compute several statistics of `arr` while reading it only once. Returns a tuple
+of 0-d `NDArray`s in the order of `stats`.
+
+Supported statistics: `:minimum`, `:maximum`, `:sum`, `:sum_squares`,
+`:count_nonzero`, `:mean`, `:var` (corrected, like `StatsBase.var`) and
+`:var_population`. Only `Float16`, `Float32` and `Float64` arrays are
+supported; `Float16` is accumulated in `Float64` like the others and each
+statistic rounded once into the result. Mean and variance use a blocked
+Welford update, and `:minimum`/`:maximum` skip NaNs.
+
+# Examples
+```julia
+lo, hi, μ, σ² = cuNumeric.multi_reduce(A, :minimum, :maximum, :mean, :var)
+```
+"""
+function multi_reduce(
+    arr::NDArray{T}, stats::Symbol...
+) where {T<:Union{SUPPORTED_HALF_TYPES,SUPPORTED_FLOAT_TYPES}}
+    isempty(stats) && throw(ArgumentError("multi_reduce: no statistics requested"))
+    length(arr) == 0 && throw(ArgumentError("multi_reduce: empty array"))
+    codes = Int32[]
+    for s in stats
+        haskey(multi_reduction_map, s) ||
+            throw(ArgumentError("multi_reduce: unknown statistic :$(s)"))
+        push!(codes, multi_reduction_map[s])
+    end
+    outs = NDArray[nda_empty_array((), s === :count_nonzero ? Int64 : T) for s in stats]
+    nda_multi_reduction!(outs, arr, codes)
+    return Tuple(outs)
+end
+
+global const scan_map = Dict{Symbol,Int32}(
+    :sum => SCAN_SUM,
+    :prod => SCAN_PROD,
+    :nansum => SCAN_NANSUM,
+    :nanprod => SCAN_NANPROD,
+)
+
+"""
+    cuNumeric.scan!(out::NDArray, arr::NDArray, op::Symbol; dims, inclusive=true)
+    cuNumeric.scan(arr::NDArray, op::Symbol; dims, inclusive=true)
+
+Cumulative `op` of `arr` along `dims`: `:sum`, `:prod`, or the NaN-skipping
+`:nansum` and `:nanprod`, which treat NaN as 0 and 1. An exclusive scan
+(`inclusive=false`) starts every line at the identity, so element `i` combines
+elements `1:i-1`. `dims` may be omitted for vectors. `out` may be `arr`.
+
+`scan` returns the same element type as `cumsum`/`cumprod` in Base: small
+integers widen to `Int`, `Bool` sums count into `Int` and `Bool` products stay
+`Bool`. `Float16` arrays are scanned in `Float32` and each result is rounded
+back to `Float16`. Each processor scans its own tile; when the scanned
+dimension is split across processors a second pass adds each tile's carry.
+"""
+function scan!(out::NDArray{T,N}, arr::NDArray{T,N}, op::Symbol; dims=nothing,
+    inclusive::Bool=true) where {T,N}
+    haskey(scan_map, op) || throw(ArgumentError("scan: unknown op :$(op)"))
+    size(out) == size(arr) ||
+        throw(DimensionMismatch("scan: output size $(size(out)) != input size $(size(arr))"))
+    return nda_scan!(out, scan_map[op], arr, _scan_axis(arr, dims), inclusive)
+end
+
+function scan(arr::NDArray{T,N}, op::Symbol; dims=nothing, inclusive::Bool=true) where {T,N}
+    haskey(scan_map, op) || throw(ArgumentError("scan: unknown op :$(op)"))
+    axis = _scan_axis(arr, dims)
+    S = op in (:sum, :nansum) ? typeof(Base.add_sum(zero(T), zero(T))) :
+        typeof(Base.mul_prod(one(T), one(T)))
+    src = S === T ? arr : as_type(arr, S)
+    out = nda_empty_array(size(arr), S)
+    nda_scan!(out, scan_map[op], src, axis, inclusive)
+    src === arr || destroy!(src)
+    return out
+end
+
+Base.cumsum(arr::NDArray; dims=nothing) = scan(arr, :sum; dims=dims)
+Base.cumprod(arr::NDArray; dims=nothing) = scan(arr, :prod; dims=dims)
+Base.cumsum!(out::NDArray{T,N}, arr::NDArray{T,N}; dims=nothing) where {T,N} = scan!(out, arr, :sum; dims=dims)
+Base.cumprod!(out::NDArray{T,N}, arr::NDArray{T,N}; dims=nothing) where {T,N} = scan!(out, arr, :prod; dims=dims)
+
+@doc"""
+    cuNumeric.nancumsum(arr::NDArray; dims)
+    cuNumeric.nancumprod(arr::NDArray; dims)
+
+`cumsum`/`cumprod` that treat NaN as 0 and 1 respectively.
+"""
+nancumsum(arr::NDArray; dims=nothing) = scan(arr, :nansum; dims=dims)
+nancumprod(arr::NDArray; dims=nothing) = scan(arr, :nanprod; dims=dims)
+
+function _scan_axis(arr::NDArray{T,N}, dims) where {T,N}
+    if isnothing(dims)
+        N == 1 || throw(ArgumentError("dims must be given to scan a $N-dimensional NDArray"))
+        return 0
+    end
+    1 <= dims <= N || throw(ArgumentError("dims=$dims out of range for a $N-dimensional NDArray"))
+    return dims - 1
+end
+
 #! ONLY ADD ONCE REDUCTIONS RETURN A SCALAR
 # function StatsBase.mean(arr::NDArray{T}) where T
 #     return sum(arr) ./ prod(size(arr))
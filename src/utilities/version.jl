@@ -67,6 +67,7 @@ function versioninfo(io::IO=stdout)
 
     Brodcast Fusion:   $(FUSE_BROADCAST_EXPRS)
     Brodcast Min Ops:  $(FUSE_BROADCAST_MIN_OPS)
+    Brodcast Deferral: $(DEFER_BROADCAST_EXPRS)
 
     Hostname:         $hostname
     Julia Version:    $(VERSION)
@@ -191,3 +191,56 @@ end
         end
     end
 end
+
+@testset "Shape broadcasting" begin
+    @testset for T in (Float32, Float64)
+        A_cpu = my_rand(T, 30, 20)
+        col_cpu = my_rand(T, 30)
+        row_cpu = my_rand(T, 1, 20)
+        A = NDArray(A_cpu)
+        col = NDArray(col_cpu)
+        row = NDArray(row_cpu)
+
+        view = cuNumeric.broadcast_to(col, (30, 20))
+        @test size(view) == (30, 20)
+        @test @allowscalar safe_compare(repeat(col_cpu, 1, 20), view, 0, 0)
+        @test_throws DimensionMismatch cuNumeric.broadcast_to(col, (20, 30))
+
+        allowscalar() do
+            @test safe_compare(A_cpu .* col_cpu, A .* col, atol(T), rtol(T))
+            @test safe_compare(A_cpu .+ row_cpu, A .+ row, atol(T), rtol(T))
+            @test safe_compare(col_cpu .* row_cpu, col .* row, atol(T), rtol(T))
+            @test safe_compare(
+                (A_cpu .- col_cpu) ./ row_cpu, (A .- col) ./ row, atol(T), rtol(T)
+            )
+        end
+    end
+end
+
+@testset "Scalar store cache" begin
+    A_cpu = my_rand(Float64, 16)
+    A = NDArray(A_cpu)
+    before = cuNumeric.scalar_cache_stats()
+    for _ in 1:10
+        half = cuNumeric.nda_from_scalar(0.5)
+        one = cuNumeric.nda_from_scalar(1.0)
+        B = cuNumeric.nda_binary_op!(similar(A), cuNumeric.MULTIPLY, A, half)
+        @test @allowscalar safe_compare(A_cpu .* 0.5, B, atol(Float64), rtol(Float64))
+        foreach(cuNumeric.destroy!, (half, one, B))
+    end
+    after = cuNumeric.scalar_cache_stats()
+    @test after.hits - before.hits >= 18
+    @test after.size <= after.capacity
+
+    # Unrelated literals push the oldest entries out past the capacity.
+    cuNumeric.set_scalar_cache_capacity!(2)
+    for v in (1.5, 2.5, 3.5)
+        cuNumeric.destroy!(cuNumeric.nda_from_scalar(v))
+    end
+    shrunk = cuNumeric.scalar_cache_stats()
+    @test shrunk.size == 2
+    @test shrunk.evictions > after.evictions
+    @test @allowscalar safe_compare(A_cpu .+ 3.5, A .+ 3.5, atol(Float64), rtol(Float64))
+    cuNumeric.set_scalar_cache_capacity!(after.capacity)
+    @test_throws ArgumentError cuNumeric.set_scalar_cache_capacity!(-1)
+end
@@ -0,0 +1,123 @@
+#= Copyright 2025 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSEend-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+=#
+
+#= Purpose of test: checkpoint
+    -- Round-trip arrays through per-tile shard files, with and without
+       compression, and overwrite an existing checkpoint
+    -- Restore from shards cut along other tile boundaries than the reader's
+    -- Damaged shards make restore throw
+=#
+
+# Shard layout (checkpoint.cpp): a header of magic, version, dim, type code,
+# element size, index, count, lo[MAX_DIM], hi[MAX_DIM], chunk count; then one
+# (raw, stored) pair per chunk and the chunks. MAX_DIM is a build option, so
+# it is inferred from an uncompressed 1-D Float64 shard.
+_shard_i64(bytes, offset) = reinterpret(Int64, bytes[(offset + 1):(offset + 8)])[1]
+
+function _shard_max_dim(bytes)
+    for m in 1:16
+        length(bytes) >= 48 + 16m || break
+        lo, hi = _shard_i64(bytes, 40), _shard_i64(bytes, 40 + 8m)
+        chunks = _shard_i64(bytes, 40 + 16m)
+        chunks == (hi >= lo) || continue
+        length(bytes) == 48 + 16m + 16chunks + 8 * max(hi - lo + 1, 0) && return m
+    end
+    return error("unrecognized shard layout")
+end
+
+# Rewrites the shards of the 1-D Float64 array `name` so that they start at
+# the (1-based) indices in `starts`.
+function _retile_shards!(dir, name, starts)
+    files = filter(f -> startswith(f, name * ".g1.") && endswith(f, ".shard"), readdir(dir))
+    shards = [read(joinpath(dir, f)) for f in files]
+    m = _shard_max_dim(first(shards))
+    header_bytes = 48 + 16m
+    pieces = Dict{Int,Vector{Float64}}()
+    for bytes in shards
+        chunks = _shard_i64(bytes, 40 + 16m)
+        chunks == 0 && continue  # empty tile
+        data = bytes[(header_bytes + 16chunks + 1):end]
+        pieces[_shard_i64(bytes, 40)] = reinterpret(Float64, data)
+    end
+    values = reduce(vcat, [pieces[lo] for lo in sort!(collect(keys(pieces)))])
+    foreach(f -> rm(joinpath(dir, f)), files)
+    stops = [starts[2:end] .- 1; length(values)]
+    template = first(shards)[1:header_bytes]
+    for (index, (lo, hi)) in enumerate(zip(starts, stops))
+        header = copy(template)
+        header[25:40] = reinterpret(UInt8, Int64[index - 1, length(starts)])
+        header[41:48] = reinterpret(UInt8, Int64[lo - 1])
+        header[(41 + 8m):(48 + 8m)] = reinterpret(UInt8, Int64[hi - 1])
+        header[(41 + 16m):(48 + 16m)] = reinterpret(UInt8, Int64[1])
+        raw = 8 * (hi - lo + 1)
+        open(joinpath(dir, "$name.g1.$(index - 1).shard"), "w") do io
+            write(io, header, Int64[raw, raw], values[lo:hi])
+        end
+    end
+end
+
+@testset "Checkpoint and restore" begin
+    mktempdir() do dir
+        A_cpu = my_rand(Float64, 64, 48)
+        b_cpu = my_rand(Int32, 1000)
+        c_cpu = zeros(Float32, 8, 8, 8)
+        A = NDArray(A_cpu)
+        b = NDArray(b_cpu)
+        c = NDArray(c_cpu)
+
+        @testset for compress in (false, true)
+            path = joinpath(dir, compress ? "packed" : "raw")
+            cuNumeric.checkpoint(path, "A" => A, "b" => b, "c" => c; compress=compress)
+            @test isfile(joinpath(path, "manifest"))
+
+            A2, b2, c2 = cuNumeric.restore(path, "A", "b", "c")
+            @test size(A2) == size(A_cpu)
+            @test safe_compare(A_cpu, A2, atol(Float64), rtol(Float64))
+            @test safe_compare(b_cpu, b2, atol(Int32), rtol(Int32))
+            @test safe_compare(c_cpu, c2, atol(Float32), rtol(Float32))
+        end
+
+        # Slices and rewrites of an existing name
+        path = joinpath(dir, "slices")
+        cuNumeric.checkpoint(path, Dict("s" => A[5:40, 3:20]))
+        @test safe_compare(
+            A_cpu[5:40, 3:20], cuNumeric.restore(path, "s"), atol(Float64), rtol(Float64)
+        )
+        cuNumeric.checkpoint(path, "s" => A; compress=true)
+        @test safe_compare(A_cpu, cuNumeric.restore(path, "s"), atol(Float64), rtol(Float64))
+        @test count(endswith(".shard"), readdir(path)) ==
+            count(startswith("s.g2."), readdir(path))
+
+        @test_throws ArgumentError cuNumeric.checkpoint(path, "bad name" => A)
+        @test_throws ArgumentError cuNumeric.checkpoint(path, "x" => A, "x" => b)
+        @test_throws ArgumentError cuNumeric.restore(path, "missing")
+
+        # Tiles of the restored array straddle the boundaries of the shards.
+        path = joinpath(dir, "retiled")
+        v_cpu = my_rand(Float64, 1001)
+        cuNumeric.checkpoint(path, "v" => NDArray(v_cpu))
+        _retile_shards!(path, "v", [1, 2, 9, 400, 998])
+        @test Array(cuNumeric.restore(path, "v")) == v_cpu
+
+        # A truncated shard is reported, not restored as garbage.
+        shard = joinpath(path, "v.g1.3.shard")
+        write(shard, read(shard)[1:(end - 8)])
+        @test_throws ErrorException cuNumeric.restore(path, "v")
+    end
+end
@@ -0,0 +1,102 @@
+#= Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+=#
+
+#= Purpose of test: convolve and correlate
+    -- Direct and FFT methods against a host loop for every boundary mode
+    -- numpy "same" conventions, promotion and argument errors
+=#
+
+function reference_correlate(A, w, mode, value)
+    c = div.(size(w), 2)
+    out = zeros(eltype(A), size(A))
+    for I in CartesianIndices(A)
+        acc = zero(eltype(A))
+        for J in CartesianIndices(w)
+            q = Tuple(I) .+ Tuple(J) .- c .- 1
+            if all(1 .<= q .<= size(A))
+                v = A[q...]
+            elseif mode === :constant
+                v = value
+            elseif mode === :edge
+                v = A[clamp.(q, 1, size(A))...]
+            else
+                v = A[mod1.(q, size(A))...]
+            end
+            acc += w[J] * v
+        end
+        out[I] = acc
+    end
+    return out
+end
+
+@testset "convolve and correlate" begin
+    @testset "$T $(size(w_cpu)) $mode $method" for T in (Float32, Float64),
+        w_cpu in (rand(T, 5, 5), rand(T, 4, 3)),
+        mode in (:constant, :edge, :wrap),
+        method in (:direct, :fft)
+
+        tol = T == Float32 ? 1e-4 : 1e-10
+        A_cpu = rand(T, 37, 23)
+        A = NDArray(A_cpu)
+        w = NDArray(w_cpu)
+        value = T(0.25)
+
+        out = cuNumeric.correlate(A, w; mode=mode, value=value, method=method)
+        @test isapprox(Array(out), reference_correlate(A_cpu, w_cpu, mode, value); rtol=tol)
+        out = cuNumeric.convolve(A, w; mode=mode, value=value, method=method)
+        @test isapprox(
+            Array(out), reference_correlate(A_cpu, reverse(w_cpu), mode, value); rtol=tol
+        )
+    end
+
+    # numpy.convolve(a, v, "same") for odd and even kernels
+    a = NDArray([1.0, 2.0, 3.0, 4.0])
+    @test Array(cuNumeric.convolve(a, NDArray([0.0, 1.0, 0.5]))) == [1.0, 2.5, 4.0, 5.5]
+    @test Array(cuNumeric.convolve(a, NDArray([1.0, 2.0]))) == [1.0, 4.0, 7.0, 10.0]
+
+    # 3-d, complex, a kernel wider than the array, and :auto
+    A_cpu = rand(ComplexF64, 6, 5, 4)
+    w_cpu = rand(ComplexF64, 3, 7, 2)
+    for mode in (:edge, :wrap)
+        # correlate conjugates a complex kernel, as numpy and scipy do; convolve does not
+        out = cuNumeric.correlate(NDArray(A_cpu), NDArray(w_cpu); mode=mode)
+        @test isapprox(Array(out), reference_correlate(A_cpu, conj.(w_cpu), mode, 0); rtol=1e-10)
+        out = cuNumeric.convolve(NDArray(A_cpu), NDArray(w_cpu); mode=mode)
+        @test isapprox(Array(out), reference_correlate(A_cpu, reverse(w_cpu), mode, 0); rtol=1e-10)
+    end
+    A_cpu = rand(Float64, 300)
+    w_cpu = rand(Float64, 101)
+    out = cuNumeric.convolve(NDArray(A_cpu), NDArray(w_cpu))
+    @test isapprox(Array(out), reference_correlate(A_cpu, reverse(w_cpu), :constant, 0); rtol=1e-10)
+
+    # Mixed element types promote
+    A_cpu = rand(Float32, 9, 8)
+    out = cuNumeric.correlate(NDArray(A_cpu), NDArray(ones(Float64, 3, 3)))
+    @test eltype(out) == Float64
+    @test isapprox(Array(out), reference_correlate(Float64.(A_cpu), ones(3, 3), :constant, 0))
+
+    A = cuNumeric.ones(4, 4)
+    @test_throws DimensionMismatch cuNumeric.convolve(A, cuNumeric.ones(3))
+    @test_throws ArgumentError cuNumeric.convolve(A, cuNumeric.ones(0, 3))
+    @test_throws ArgumentError cuNumeric.convolve(A, cuNumeric.ones(3, 3); mode=:reflect)
+    @test_throws ArgumentError cuNumeric.convolve(A, cuNumeric.ones(3, 3); method=:winograd)
+    @test_throws ArgumentError cuNumeric.convolve(
+        NDArray(ones(Int32, 4, 4)), NDArray(ones(Int32, 3, 3))
+    )
+end
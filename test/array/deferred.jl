@@ -0,0 +1,105 @@
+#= Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahal <naderrahhal2026@u.northwestern.edu>
+=#
+
+#= Purpose of test: deferred elementwise mode
+    -- Ops recorded by the C wrapper run as one fused host task per subgraph
+    -- Unsupported ops inside a recording still produce correct results
+    -- Non-elementwise ops on pending arrays see the recorded values
+    -- Scalar reads and writes on pending arrays flush the recording first
+=#
+
+bcast(f, args...) = Broadcast.broadcasted(f, args...)
+
+# Evaluates `bc` op by op with the C wrapper recording instead of launching.
+function deferred_eval(bc)
+    return cuNumeric.with_deferred() do
+        cuNumeric.unravel_broadcast_tree(Broadcast.instantiate(bc))
+    end
+end
+
+@testset "Deferred elementwise fusion" begin
+    @testset for T in (Float32, Float64)
+        cpu = [my_rand(T, 24, 17) for _ in 1:5]
+        a, b, c, d, e = NDArray.(cpu)
+
+        launches = cuNumeric.nda_fused_expr_launches()
+        R = deferred_eval(bcast(-, bcast(+, bcast(*, a, b), bcast(*, c, d)), e))
+        @test cuNumeric.nda_fused_expr_launches() == launches + 1
+        expected = cpu[1] .* cpu[2] .+ cpu[3] .* cpu[4] .- cpu[5]
+        @test safe_compare(R, expected, atol(T), rtol(T))
+
+        # Scalars are inlined; a repeated product is computed once.
+        R = deferred_eval(
+            bcast(+, bcast(*, T(2), bcast(sin, a)), bcast(-, bcast(*, a, b), bcast(*, b, a)))
+        )
+        expected = T(2) .* sin.(cpu[1]) .+ (cpu[1] .* cpu[2] .- cpu[2] .* cpu[1])
+        @test safe_compare(R, expected, atol(T), rtol(T))
+
+        # `sign` is not fusible: the recording is flushed around it.
+        R = deferred_eval(bcast(*, bcast(sign, bcast(-, a, b)), bcast(abs, c)))
+        @test safe_compare(R, sign.(cpu[1] .- cpu[2]) .* abs.(cpu[3]), atol(T), rtol(T))
+
+        # Results stay valid after the deferred scope, including sliced inputs.
+        R = deferred_eval(bcast(/, bcast(+, a[2:20, :], b[3:21, :]), T(3)))
+        expected = (cpu[1][2:20, :] .+ cpu[2][3:21, :]) ./ T(3)
+        @test safe_compare(R, expected, atol(T), rtol(T))
+    end
+
+    @testset "Int64" begin
+        cpu = [my_rand(Int64, 30) for _ in 1:3]
+        a, b, c = NDArray.(cpu)
+        R = deferred_eval(bcast(max, bcast(*, a, b), bcast(-, c)))
+        @test Array(R) == max.(cpu[1] .* cpu[2], .-cpu[3])
+    end
+
+    @testset "Non-elementwise ops on pending arrays" begin
+        T = Float64
+        A_cpu, B_cpu, C_cpu = my_rand(T, 16, 16), my_rand(T, 16, 16), my_rand(T, 16, 16)
+        A, B, C = NDArray(A_cpu), NDArray(B_cpu), NDArray(C_cpu)
+        expected = A_cpu .* B_cpu .+ C_cpu
+        S, P, V, M = cuNumeric.with_deferred() do
+            X = cuNumeric.unravel_broadcast_tree(
+                Broadcast.instantiate(bcast(+, bcast(*, A, B), C))
+            )
+            # Each of these reads `X` before the recording is launched.
+            return sum(X), X * C, sort(cuNumeric.reshape(X, 256)), cuNumeric.transpose(X)
+        end
+        @test isapprox(S[], sum(expected); rtol=rtol(T) * 30)
+        @test safe_compare(P, expected * C_cpu, atol(T), rtol(T))
+        @test safe_compare(V, sort(vec(expected)), atol(T), rtol(T))
+        @test safe_compare(M, permutedims(expected), atol(T), rtol(T))
+    end
+
+    @testset "Scalar access to pending arrays" begin
+        T = Float64
+        A_cpu, B_cpu = my_rand(T, 8, 8), my_rand(T, 8, 8)
+        A, B = NDArray(A_cpu), NDArray(B_cpu)
+        expected = A_cpu .* B_cpu
+        X, first_val = cuNumeric.with_deferred() do
+            X = cuNumeric.unravel_broadcast_tree(Broadcast.instantiate(bcast(*, A, B)))
+            v = @allowscalar X[1, 1]
+            @allowscalar X[2, 2] = T(7)
+            return X, v
+        end
+        expected[2, 2] = T(7)
+        @test isapprox(first_val, A_cpu[1, 1] * B_cpu[1, 1]; rtol=rtol(T))
+        @test safe_compare(X, expected, atol(T), rtol(T))
+    end
+end
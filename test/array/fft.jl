@@ -0,0 +1,88 @@
+#= Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+=#
+
+#= Purpose of test: FFT
+    -- fft/ifft/rfft/irfft against a direct DFT, over all and chosen dims
+    -- power-of-two and Bluestein lengths, Float32 and Float64
+    -- plan cache reuse across repeated transforms of one shape
+=#
+
+# Direct DFT along `dim`, sign -1 (forward) or +1 (unscaled inverse).
+function dft_along(x::AbstractArray, dim::Int, sign)
+    n = size(x, dim)
+    F = [cispi(sign * 2 * j * k / n) for k in 0:(n - 1), j in 0:(n - 1)]
+    return mapslices(v -> F * v, complex(float(x)); dims=dim)
+end
+dft(x, dims, sign=-1) = foldl((y, d) -> dft_along(y, d, sign), dims; init=x)
+
+@testset "FFT" begin
+    @testset "$T $(size(x_cpu)) dims=$dims" for T in (Float32, Float64),
+        (x_cpu, dims) in (
+            (rand(T, 16), 1:1),
+            (rand(T, 12, 7), 1:2),
+            (rand(T, 12, 7), 2),
+            (rand(T, 8, 5, 6), (3, 1)),
+        )
+
+        tol = T == Float64 ? 1e-12 : 1e-4
+        x = NDArray(x_cpu)
+        ref = dft(Float64.(x_cpu), dims)
+        n = prod(size(x_cpu, d) for d in dims)
+
+        X = cuNumeric.fft(x, dims)
+        @test eltype(X) == complex(T)
+        @test Array(X) ≈ ref rtol = tol
+        @test Array(cuNumeric.ifft(X, dims)) ≈ x_cpu rtol = tol
+
+        z_cpu = complex.(x_cpu, reverse(x_cpu))
+        Z = cuNumeric.fft(NDArray(z_cpu), dims)
+        @test Array(Z) ≈ dft(ComplexF64.(z_cpu), dims) rtol = tol
+        @test Array(cuNumeric.ifft(NDArray(z_cpu), dims)) ≈ dft(z_cpu, dims, 1) / n rtol = tol
+
+        halved = first(dims)
+        keep = ntuple(d -> d == halved ? (1:(div(size(x_cpu, d), 2) + 1)) : Colon(), ndims(x_cpu))
+        R = cuNumeric.rfft(x, dims)
+        @test Array(R) ≈ ref[keep...] rtol = tol
+        back = cuNumeric.irfft(R, size(x_cpu, halved), dims)
+        @test eltype(back) == T
+        @test Array(back) ≈ x_cpu rtol = tol
+    end
+
+    @testset "plan cache" begin
+        cuNumeric.clear_fft_plan_cache!()
+        x = NDArray(rand(Float64, 30, 4))
+        before = cuNumeric.fft_plan_cache_stats()
+        for _ in 1:5
+            x = cuNumeric.ifft(cuNumeric.fft(x, 1), 1)
+        end
+        stats = cuNumeric.fft_plan_cache_stats()
+        @test stats.misses - before.misses == 2
+        @test stats.hits - before.hits >= 8
+        @test stats.size == 2
+    end
+
+    @testset "argument checks" begin
+        x = NDArray(rand(Float64, 6, 4))
+        @test_throws ArgumentError cuNumeric.fft(x, 3)
+        @test_throws ArgumentError cuNumeric.fft(x, (1, 1))
+        @test_throws ArgumentError cuNumeric.fft(NDArray(rand(Int32, 4)))
+        @test_throws ArgumentError cuNumeric.rfft(cuNumeric.fft(x))
+        @test_throws DimensionMismatch cuNumeric.irfft(cuNumeric.rfft(x), 9)
+    end
+end
@@ -0,0 +1,41 @@
+#= Copyright 2025 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSEend-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+=#
+
+#= Purpose of test: footprint
+    -- Instance bytes reported per array and per memory kind
+=#
+
+@testset "Physical footprint" begin
+    A = cuNumeric.zeros(Float64, 100, 50)
+    predicted = sizeof(Float64) * 100 * 50
+    @test cuNumeric.physical_bytes(A) >= predicted
+    f = cuNumeric.physical_footprint(A)
+    @test f.scalar == 0
+    @test sum(f) == cuNumeric.physical_bytes(A)
+
+    # stride-0 dimensions take no space
+    v = cuNumeric.zeros(Float64, 100)
+    view = cuNumeric.broadcast_to(v, (100, 50))
+    @test 0 < cuNumeric.physical_bytes(view) < predicted
+
+    s = cuNumeric.nda_from_scalar(2.5)
+    @test cuNumeric.physical_footprint(s).scalar == sizeof(Float64)
+
+    @test sum(cuNumeric.allocated_footprint()) > 0
+end
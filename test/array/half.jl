@@ -0,0 +1,64 @@
+#= Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+=#
+
+#= Purpose of test: Float16 storage
+    -- Scalar accessors, conversions and Julia round trips of Float16 arrays
+    -- Fused host expressions and multi_reduce widen Float16 to Float32
+=#
+
+@testset "Float16 arrays" begin
+    T = Float16
+    cpu = rand(T, 33, 7)
+    a = NDArray(cpu)
+    @test eltype(a) == T
+    @test Array(a) == cpu
+
+    z = cuNumeric.zeros(T, 2, 2)
+    allowscalar() do
+        z[1, 2] = T(1.5)
+        @test z[1, 2] === T(1.5)
+        @test z[2, 1] === zero(T)
+    end
+
+    wide = cuNumeric.as_type(a, Float32)
+    @test Array(wide) == Float32.(cpu)
+    @test Array(cuNumeric.as_type(wide, T)) == cpu
+
+    # Fused host path: loads widen to Float32 and the stores round once.
+    b_cpu = rand(T, 33, 7)
+    b = NDArray(b_cpu)
+    launches = cuNumeric.nda_fused_expr_launches()
+    R = cuNumeric.with_deferred() do
+        bc = Broadcast.broadcasted(
+            +, Broadcast.broadcasted(*, a, b), Broadcast.broadcasted(sin, a)
+        )
+        cuNumeric.unravel_broadcast_tree(Broadcast.instantiate(bc))
+    end
+    @test cuNumeric.nda_fused_expr_launches() == launches + 1
+    expected = T.(Float32.(cpu) .* Float32.(b_cpu) .+ sin.(Float32.(cpu)))
+    @test safe_compare(R, expected, atol(T), rtol(T))
+
+    lo, hi, s, μ = cuNumeric.multi_reduce(a, :minimum, :maximum, :sum, :mean)
+    allowscalar() do
+        @test lo[] == minimum(cpu)
+        @test hi[] == maximum(cpu)
+        @test isapprox(s[], T(sum(Float64.(cpu))); rtol=rtol(T))
+        @test isapprox(μ[], T(sum(Float64.(cpu)) / length(cpu)); rtol=rtol(T))
+    end
+end
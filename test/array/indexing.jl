@@ -0,0 +1,99 @@
+#= Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahal <naderrahhal2026@u.northwestern.edu>
+=#
+
+#= Purpose of test: indexing
+    -- gather/scatter with device-resident integer index arrays
+    -- boolean-mask selection and masked assignment
+    -- batched point gather/scatter from host coordinate lists
+=#
+
+@testset "index arrays" begin
+    @testset verbose=true for T in (Int32, Float64, ComplexF32)
+        A_cpu = my_rand(T, 20, 30)
+        A = NDArray(A_cpu)
+        idx_cpu = rand(1:length(A_cpu), 100)
+        @test Array(A[NDArray(idx_cpu)]) == A_cpu[idx_cpu]
+        @test Array(A[NDArray(Int32.(idx_cpu))]) == A_cpu[idx_cpu]
+
+        targets = unique(idx_cpu)
+        vals_cpu = my_rand(T, length(targets))
+        A[NDArray(targets)] = NDArray(vals_cpu)
+        A_cpu[targets] = vals_cpu
+        @test Array(A) == A_cpu
+
+        A[NDArray(targets)] = zero(T)
+        A_cpu[targets] .= zero(T)
+        @test Array(A) == A_cpu
+    end
+
+    x = NDArray(collect(1.0:10.0))
+    @test_throws BoundsError x[NDArray([0, 3])]
+    @test_throws BoundsError x[NDArray([3, 11])]
+    @test_throws DimensionMismatch x[NDArray([1, 2])] = NDArray([1.0])
+end
+
+@testset "boolean masks" begin
+    @testset verbose=true for T in (Int64, Float32)
+        A_cpu = my_rand(T, 25, 16)
+        A = NDArray(A_cpu)
+        mask_cpu = Array(A_cpu .> zero(T))
+        mask = NDArray(mask_cpu)
+        @test Array(A[mask]) == A_cpu[mask_cpu]
+
+        B_cpu = copy(A_cpu)
+        B = NDArray(B_cpu)
+        B[mask] = one(T)
+        B_cpu[mask_cpu] .= one(T)
+        @test Array(B) == B_cpu
+
+        vals_cpu = my_rand(T, count(mask_cpu))
+        A[mask] = NDArray(vals_cpu)
+        A_cpu[mask_cpu] = vals_cpu
+        @test Array(A) == A_cpu
+    end
+
+    empty = NDArray(zeros(Bool, 4, 4))
+    @test length(NDArray(rand(4, 4))[empty]) == 0
+    @test_throws DimensionMismatch NDArray(rand(4, 4))[NDArray(ones(Bool, 4, 4))] = NDArray(rand(3))
+end
+
+@testset "point lists" begin
+    @testset verbose=true for T in (Bool, Int64, Float32, ComplexF64)
+        A_cpu = my_rand(T, 16, 12, 5)
+        A = NDArray(A_cpu)
+        points = unique(rand(CartesianIndices(A_cpu), 200))
+        @test cuNumeric.gather_points(A, points) == A_cpu[points]
+
+        vals = my_rand(T, length(points))
+        cuNumeric.scatter_points!(A, points, vals)
+        A_cpu[points] = vals
+        @test Array(A) == A_cpu
+
+        coords = [1 16; 1 12; 1 5]
+        @test cuNumeric.gather_points(A, coords) == [A_cpu[1, 1, 1], A_cpu[16, 12, 5]]
+    end
+
+    A = cuNumeric.zeros(Float64, 4, 4)
+    @test isempty(cuNumeric.gather_points(A, CartesianIndex{2}[]))
+    @test cuNumeric.scatter_points!(A, CartesianIndex{2}[], Float64[]) === A
+    @test_throws BoundsError cuNumeric.gather_points(A, [CartesianIndex(5, 1)])
+    @test_throws BoundsError cuNumeric.scatter_points!(A, [CartesianIndex(0, 1)], [1.0])
+    @test_throws DimensionMismatch cuNumeric.gather_points(A, [1 2 3])
+end
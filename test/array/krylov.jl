@@ -0,0 +1,82 @@
+#= Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+=#
+
+#= Purpose of test: Krylov solvers
+    -- cg (classic and pipelined) on a dense SPD system and a CSR stencil
+    -- bicgstab on a nonsymmetric system with a matrix-free operator
+    -- lagged convergence reporting and argument checks
+=#
+
+@testset "Krylov solvers" begin
+    n = 64
+    M = rand(Float64, n, n)
+    spd = M' * M + n * I
+    nonsym = M + n * I
+    rhs = rand(Float64, n)
+
+    @testset "cg $T pipelined=$pipelined" for T in (Float32, Float64), pipelined in (false, true)
+        A = NDArray(T.(spd))
+        b = NDArray(T.(rhs))
+        tol = T == Float64 ? 1e-10 : 1e-4
+        x, stats = cuNumeric.cg(A, b; rtol=tol, check_every=4, pipelined=pipelined)
+        @test stats.converged
+        @test stats.iterations <= n
+        @test norm(T.(spd) * Array(x) - T.(rhs)) <= 10 * tol * norm(T.(rhs))
+    end
+
+    @testset "cg with a CSR stencil" begin
+        # 1-D Laplacian: tridiagonal (-1, 2, -1).
+        L = Matrix(Tridiagonal(fill(-1.0, n - 1), fill(2.0, n), fill(-1.0, n - 1)))
+        A = cuNumeric.CSRMatrix(L)
+        x, stats = cuNumeric.cg(A, NDArray(rhs); rtol=1e-10, maxiter=2n)
+        @test stats.converged
+        @test Array(x) ≈ L \ rhs rtol = 1e-8
+    end
+
+    @testset "bicgstab with a matrix-free operator" begin
+        A = NDArray(nonsym)
+        calls = Ref(0)
+        apply! = (q, p) -> (calls[] += 1; cuNumeric.nda_three_dot_arg(A, p, q))
+        x, stats = cuNumeric.bicgstab(apply!, NDArray(rhs); rtol=1e-10, check_every=2)
+        @test stats.converged
+        @test calls[] == 2 * stats.iterations + 1
+        @test Array(x) ≈ nonsym \ rhs rtol = 1e-8
+    end
+
+    @testset "exact solutions stay finite" begin
+        A = NDArray(Matrix{Float64}(I, n, n))
+        for solve in (cuNumeric.cg, cuNumeric.bicgstab)
+            x, stats = solve(A, NDArray(rhs); check_every=3)
+            @test stats.converged
+            @test Array(x) ≈ rhs
+        end
+        x, stats = cuNumeric.cg(A, NDArray(rhs); x0=NDArray(rhs))
+        @test stats.iterations == 0
+    end
+
+    @testset "argument checks" begin
+        b = NDArray(rhs)
+        @test_throws DimensionMismatch cuNumeric.cg(NDArray(rand(n, n + 1)), b)
+        @test_throws ArgumentError cuNumeric.cg(NDArray(rand(Float32, n, n)), b)
+        @test_throws ArgumentError cuNumeric.cg(NDArray(spd), b; check_every=0)
+        @test_throws DimensionMismatch cuNumeric.bicgstab(
+            NDArray(nonsym), b; x0=NDArray(rand(n + 1))
+        )
+    end
+end
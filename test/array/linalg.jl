@@ -261,6 +261,48 @@ end
     end
 end
 
+@testset "cholesky, lu and trsm" begin
+    @testset verbose=true for T in Base.uniontypes(cuNumeric.SUPPORTED_SOLVE_TYPES)
+        n, nb = 70, 3
+        M = [rand(T, n, n) for _ in 1:nb]
+        spd = [m * m' + n * I for m in M]
+        general = [m + n * I for m in M]
+        b_cpu = rand(T, nb, n, 2)
+        tol_a, tol_r = atol(T) * n, rtol(T) * n
+
+        A = cuNumeric.NDArray(spd[1])
+        L = cuNumeric.cholesky(A)
+        @test @allowscalar safe_compare(LinearAlgebra.cholesky(Hermitian(spd[1])).L, L, tol_a, tol_r)
+        x = cuNumeric.cholesky_solve(L, cuNumeric.NDArray(b_cpu[1, :, 1]))
+        @test @allowscalar safe_compare(spd[1] \ b_cpu[1, :, 1], x, tol_a, tol_r)
+
+        # Batched: factor once, solve twice with the same factors.
+        stack3(ms) = permutedims(cat(ms...; dims=3), (3, 1, 2))
+        F, piv = cuNumeric.lu(cuNumeric.NDArray(stack3(general)))
+        @test size(piv) == (nb, n)
+        B = cuNumeric.NDArray(b_cpu)
+        for rhs in (B, 2 .* B)
+            X = Array(cuNumeric.lu_solve(F, piv, rhs))
+            scale = rhs === B ? 1 : 2
+            for k in 1:nb
+                ref = general[k] \ (scale .* b_cpu[k, :, :])
+                @test isapprox(X[k, :, :], ref; atol=tol_a, rtol=tol_r)
+            end
+        end
+        Ls = Array(cuNumeric.cholesky(cuNumeric.NDArray(stack3(spd))))
+        @test all(k -> isapprox(Ls[k, :, :] * Ls[k, :, :]', spd[k]; rtol=tol_r), 1:nb)
+
+        U = cuNumeric.NDArray(Matrix(UpperTriangular(general[1])))
+        y = cuNumeric.trsm(U, cuNumeric.NDArray(b_cpu[1, :, :]); lower=false, adjoint=true)
+        @test @allowscalar safe_compare(UpperTriangular(general[1])' \ b_cpu[1, :, :], y, tol_a, tol_r)
+    end
+
+    @test_throws LinearAlgebra.PosDefException cuNumeric.cholesky(cuNumeric.NDArray([1.0 2.0; 2.0 1.0]))
+    @test_throws LinearAlgebra.SingularException cuNumeric.lu(cuNumeric.NDArray([1.0 2.0; 2.0 4.0]))
+    @test_throws ArgumentError cuNumeric.cholesky(cuNumeric.rand(Float64, 3, 4))
+    @test_throws DimensionMismatch cuNumeric.trsm(cuNumeric.rand(Float64, 3, 3), cuNumeric.rand(Float64, 4))
+end
+
 function check_svd_reconstruction(ref_A::AbstractMatrix, u, s, vh, tol_a, tol_r)
     U = Array(u)
     S = Array(s)
@@ -434,3 +476,203 @@ end
         end
     end
 end
+
+@testset "batched_mul" begin
+    @testset verbose=true for T in Base.uniontypes(cuNumeric.SUPPORTED_GEMM_TYPES)
+        A_cpu = rand(T, 6, 9, 7)
+        B_cpu = rand(T, 6, 7, 5)
+        C_cpu = similar(A_cpu, 6, 9, 5)
+        for i in 1:6
+            C_cpu[i, :, :] = A_cpu[i, :, :] * B_cpu[i, :, :]
+        end
+
+        C = cuNumeric.batched_mul(cuNumeric.NDArray(A_cpu), cuNumeric.NDArray(B_cpu))
+        @test size(C) == (6, 9, 5)
+        @test @allowscalar safe_compare(C_cpu, C, atol(T) * 10, rtol(T) * 10)
+
+        # 4-D, two batch dims
+        A4 = rand(T, 2, 3, 4, 4)
+        B4 = rand(T, 2, 3, 4, 2)
+        C4 = cuNumeric.zeros(T, 2, 3, 4, 2)
+        cuNumeric.batched_mul!(C4, cuNumeric.NDArray(A4), cuNumeric.NDArray(B4))
+        C4_cpu = [A4[i, j, :, :] * B4[i, j, :, :] for i in 1:2, j in 1:3]
+        allowscalar() do
+            for i in 1:2, j in 1:3, r in 1:4, c in 1:2
+                @test isapprox(C4[i, j, r, c], C4_cpu[i, j][r, c]; rtol=rtol(T) * 10)
+            end
+        end
+    end
+
+    A = cuNumeric.rand(Float64, 3, 4, 5)
+    @test_throws DimensionMismatch cuNumeric.batched_mul(A, cuNumeric.rand(Float64, 3, 4, 5))
+    @test_throws DimensionMismatch cuNumeric.batched_mul(A, cuNumeric.rand(Float64, 2, 5, 5))
+    @test_throws ArgumentError cuNumeric.batched_mul(
+        cuNumeric.ones(Int32, 2, 2, 2), cuNumeric.ones(Int32, 2, 2, 2)
+    )
+end
+
+@testset "gemm!" begin
+    @testset verbose=true for T in Base.uniontypes(cuNumeric.SUPPORTED_GEMM_TYPES)
+        α, β = T(2), T(-0.5)
+        A_cpu = rand(T, 40, 30) # used transposed: op(A) is 30×40
+        B_cpu = rand(T, 40, 50)
+        C_cpu = rand(T, 30, 50)
+        C = cuNumeric.NDArray(C_cpu)
+        cuNumeric.gemm!(
+            C, cuNumeric.NDArray(A_cpu), cuNumeric.NDArray(B_cpu); transA=true, alpha=α, beta=β
+        )
+        @test @allowscalar safe_compare(
+            α * transpose(A_cpu) * B_cpu + β * C_cpu, C, atol(T) * 100, rtol(T) * 100
+        )
+
+        # both operands transposed, beta = 0 ignores C's contents
+        Bt_cpu = rand(T, 20, 30)
+        C2 = cuNumeric.ones(T, 40, 20)
+        cuNumeric.gemm!(
+            C2, cuNumeric.NDArray(transpose(A_cpu) |> collect), cuNumeric.NDArray(Bt_cpu);
+            transA=true, transB=true,
+        )
+        @test @allowscalar safe_compare(A_cpu * transpose(Bt_cpu), C2, atol(T) * 100, rtol(T) * 100)
+
+        # five-argument mul!
+        A2_cpu = rand(T, 30, 40)
+        C3 = cuNumeric.NDArray(C_cpu)
+        mul!(C3, cuNumeric.NDArray(A2_cpu), cuNumeric.NDArray(B_cpu), α, β)
+        @test @allowscalar safe_compare(
+            α * A2_cpu * B_cpu + β * C_cpu, C3, atol(T) * 100, rtol(T) * 100
+        )
+
+        # a transposed `out` is read and written through its own strides
+        Ct = cuNumeric.NDArray(collect(transpose(C_cpu)))
+        cuNumeric.gemm!(
+            cuNumeric.transpose(Ct), cuNumeric.NDArray(A2_cpu), cuNumeric.NDArray(B_cpu);
+            alpha=α, beta=β,
+        )
+        @test @allowscalar safe_compare(
+            transpose(α * A2_cpu * B_cpu + β * C_cpu), Ct, atol(T) * 100, rtol(T) * 100
+        )
+    end
+
+    C = cuNumeric.zeros(Float64, 3, 3)
+    @test_throws DimensionMismatch cuNumeric.gemm!(
+        C, cuNumeric.rand(Float64, 3, 4), cuNumeric.rand(Float64, 4, 3); transA=true
+    )
+end
+
+@testset "mixed_mul" begin
+    A_cpu = rand(Float32, 16, 2048)
+    B_cpu = rand(Float32, 2048, 8)
+    ref = Float64.(A_cpu) * Float64.(B_cpu)
+    A, B = cuNumeric.NDArray(A_cpu), cuNumeric.NDArray(B_cpu)
+
+    C64 = cuNumeric.mixed_mul(A, B, Float64; out=Float64)
+    @test eltype(C64) == Float64
+    @test @allowscalar safe_compare(ref, C64, 1e-9, 1e-12)
+
+    # one rounding of the Float64 sum into Float32
+    C32 = cuNumeric.mixed_mul(A, B, Float64)
+    @test eltype(C32) == Float32
+    @test @allowscalar safe_compare(Float32.(ref), C32, 0, eps(Float32))
+
+    # batched
+    A3_cpu = rand(Float32, 3, 5, 64)
+    B3_cpu = rand(Float32, 3, 64, 4)
+    C3 = cuNumeric.zeros(Float64, 3, 5, 4)
+    cuNumeric.mixed_mul!(C3, cuNumeric.NDArray(A3_cpu), cuNumeric.NDArray(B3_cpu), Float64)
+    allowscalar() do
+        for i in 1:3
+            ref3 = Float64.(A3_cpu[i, :, :]) * Float64.(B3_cpu[i, :, :])
+            @test all(isapprox(C3[i, r, c], ref3[r, c]; rtol=1e-12) for r in 1:5, c in 1:4)
+        end
+    end
+
+    @test_throws ArgumentError cuNumeric.mixed_mul(A, B, ComplexF64)
+    @test_throws ArgumentError cuNumeric.mixed_mul(A, cuNumeric.NDArray(Float64.(B_cpu)), Float64)
+    @test_throws DimensionMismatch cuNumeric.mixed_mul(A, A, Float64)
+end
+
+@testset "einsum" begin
+    @testset verbose=true for T in Base.uniontypes(cuNumeric.SUPPORTED_GEMM_TYPES)
+        A_cpu, B_cpu, C_cpu = rand(T, 6, 7), rand(T, 7, 8), rand(T, 8, 5)
+        A, B, C = cuNumeric.NDArray(A_cpu), cuNumeric.NDArray(B_cpu), cuNumeric.NDArray(C_cpu)
+
+        @test @allowscalar safe_compare(
+            A_cpu * B_cpu * C_cpu, cuNumeric.einsum("ij,jk,kl->il", A, B, C),
+            atol(T) * 100, rtol(T) * 100,
+        )
+        # implicit output, transpose, full contraction
+        @test @allowscalar safe_compare(A_cpu * B_cpu, cuNumeric.einsum("ij,jk", A, B), atol(T) * 100, rtol(T) * 100)
+        @test @allowscalar safe_compare(permutedims(A_cpu), cuNumeric.einsum("ij->ji", A), 0, 0)
+        @test @allowscalar isapprox(
+            cuNumeric.einsum("ij,ij->", A, A)[], sum(A_cpu .* A_cpu); rtol=rtol(T) * 100
+        )
+
+        # batched with a summed-out index that only one operand carries
+        X_cpu, Y_cpu = rand(T, 3, 4, 5), rand(T, 3, 5, 2, 6)
+        ref = [sum(X_cpu[b, i, k] * Y_cpu[b, k, j, s] for k in 1:5, s in 1:6) for b in 1:3, i in 1:4, j in 1:2]
+        @test @allowscalar safe_compare(
+            ref, cuNumeric.einsum("bik,bkjs->bij", cuNumeric.NDArray(X_cpu), cuNumeric.NDArray(Y_cpu)),
+            atol(T) * 100, rtol(T) * 100,
+        )
+
+        # tensordot
+        P_cpu, Q_cpu = rand(T, 3, 4, 5), rand(T, 4, 5, 2)
+        ref = [sum(P_cpu[i, a, b] * Q_cpu[a, b, j] for a in 1:4, b in 1:5) for i in 1:3, j in 1:2]
+        P, Q = cuNumeric.NDArray(P_cpu), cuNumeric.NDArray(Q_cpu)
+        @test @allowscalar safe_compare(ref, cuNumeric.tensordot(P, Q), atol(T) * 100, rtol(T) * 100)
+        @test @allowscalar safe_compare(
+            ref, cuNumeric.tensordot(P, Q, ([2, 3], [1, 2])), atol(T) * 100, rtol(T) * 100
+        )
+    end
+
+    # cheapest order: the skinny product first
+    @test cuNumeric.einsum_path("ij,jk,kl->il", (1000, 1000), (1000, 1000), (1000, 10)) == [(2, 3), (1, 2)]
+    @test cuNumeric.einsum_path("ij,jk,kl->il", (10, 1000), (1000, 1000), (1000, 10)) == [(1, 2), (1, 2)]
+
+    A = cuNumeric.rand(Float64, 3, 3)
+    @test_throws ArgumentError cuNumeric.einsum("ii->i", A)
+    @test_throws ArgumentError cuNumeric.einsum("ij,jk->ik", A)
+    @test_throws ArgumentError cuNumeric.einsum("ij,jk->ik", A, cuNumeric.rand(Float64, 4, 3))
+    @test_throws DimensionMismatch cuNumeric.tensordot(A, cuNumeric.rand(Float64, 4, 3), 1)
+end
+
+@testset "CSRMatrix" begin
+    @testset verbose=true for T in Base.uniontypes(cuNumeric.SUPPORTED_SPARSE_TYPES)
+        # 1-D Laplacian plus a dense last row and an empty row
+        n = 50
+        A_cpu = zeros(T, n, n)
+        for i in 1:(n - 2)
+            A_cpu[i, i] = T(2)
+            i > 1 && (A_cpu[i, i - 1] = T(-1))
+            i < n && (A_cpu[i, i + 1] = T(-1))
+        end
+        A_cpu[n, :] = rand(T, n)
+        A = cuNumeric.CSRMatrix(A_cpu)
+        @test size(A) == (n, n)
+        @test cuNumeric.nnz(A) == count(!iszero, A_cpu)
+
+        x_cpu = rand(T, n)
+        y = A * cuNumeric.NDArray(x_cpu)
+        @test @allowscalar safe_compare(A_cpu * x_cpu, y, atol(T) * 10, rtol(T) * 10)
+
+        X_cpu = rand(T, n, 3)
+        Y = cuNumeric.zeros(T, n, 3)
+        mul!(Y, A, cuNumeric.NDArray(X_cpu))
+        @test @allowscalar safe_compare(A_cpu * X_cpu, Y, atol(T) * 10, rtol(T) * 10)
+    end
+
+    # host CSR triplet, rectangular
+    B = cuNumeric.CSRMatrix(2, 3, [1, 3, 4], [1, 3, 2], [1.0, 2.0, 3.0])
+    y = B * cuNumeric.NDArray([1.0, 10.0, 100.0])
+    @test @allowscalar safe_compare([201.0, 30.0], y, 0, 0)
+
+    @test_throws DimensionMismatch B * cuNumeric.NDArray([1.0, 2.0])
+    @test_throws DimensionMismatch cuNumeric.CSRMatrix(3, 3, [1, 2], [1], [1.0])
+    @test_throws ArgumentError cuNumeric.CSRMatrix(2, 2, [1, 2, 3], [1, 2], Int32[1, 2])
+    # malformed row pointers and out-of-range columns
+    @test_throws ArgumentError cuNumeric.CSRMatrix(2, 3, [2, 3, 4], [1, 3, 2], [1.0, 2.0, 3.0])
+    @test_throws ArgumentError cuNumeric.CSRMatrix(2, 3, [1, 3, 3], [1, 3, 2], [1.0, 2.0, 3.0])
+    @test_throws ArgumentError cuNumeric.CSRMatrix(3, 3, [1, 3, 2, 4], [1, 3, 2], [1.0, 2.0, 3.0])
+    @test_throws ArgumentError cuNumeric.CSRMatrix(2, 3, [1, 3, 4], [1, 4, 2], [1.0, 2.0, 3.0])
+    @test_throws ArgumentError cuNumeric.CSRMatrix(2, 3, [1, 3, 4], [0, 3, 2], [1.0, 2.0, 3.0])
+end
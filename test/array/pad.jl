@@ -0,0 +1,99 @@
+#= Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahal <naderrahhal2026@u.northwestern.edu>
+=#
+
+#= Purpose of test: pad, cat and stack
+    -- constant / edge / wrap padding against a host reference
+    -- cat, vcat, hcat and stack against Base
+=#
+
+# Host reference for the :edge and :wrap modes.
+function host_pad(A, widths, mode)
+    out_size = ntuple(d -> size(A, d) + sum(widths[d]), ndims(A))
+    return map(CartesianIndices(out_size)) do I
+        src = ntuple(ndims(A)) do d
+            i = I[d] - widths[d][1]
+            n = size(A, d)
+            mode === :edge ? clamp(i, 1, n) : mod1(i, n)
+        end
+        A[src...]
+    end
+end
+
+@testset "pad" begin
+    @testset for T in (Int32, Float64)
+        A_cpu = my_rand(T, 6, 5)
+        A = NDArray(A_cpu)
+        widths = ((1, 2), (0, 3))
+
+        padded = cuNumeric.pad(A, widths; value=T(7))
+        expected = fill(T(7), 9, 8)
+        expected[2:7, 1:5] = A_cpu
+        @test @allowscalar safe_compare(expected, padded, 0, 0)
+
+        for mode in (:edge, :wrap)
+            @test @allowscalar safe_compare(
+                host_pad(A_cpu, widths, mode), cuNumeric.pad(A, widths; mode=mode), 0, 0
+            )
+        end
+        @test @allowscalar safe_compare(
+            host_pad(A_cpu, ((2, 2), (2, 2)), :wrap), cuNumeric.pad(A, 2; mode=:wrap), 0, 0
+        )
+
+        v_cpu = my_rand(T, 10)
+        @test @allowscalar safe_compare(
+            host_pad(v_cpu, ((3, 1),), :edge), cuNumeric.pad(NDArray(v_cpu), ((3, 1),); mode=:edge), 0, 0
+        )
+        # borders wider than the array wrap around it several times; 3-d regions
+        @test @allowscalar safe_compare(
+            host_pad(v_cpu, ((23, 17),), :wrap), cuNumeric.pad(NDArray(v_cpu), ((23, 17),); mode=:wrap), 0, 0
+        )
+        B_cpu = my_rand(T, 3, 4, 2)
+        for mode in (:edge, :wrap)
+            widths3 = ((2, 1), (0, 5), (3, 3))
+            @test @allowscalar safe_compare(
+                host_pad(B_cpu, widths3, mode), cuNumeric.pad(NDArray(B_cpu), widths3; mode=mode), 0, 0
+            )
+        end
+        @test_throws ArgumentError cuNumeric.pad(A, 1; mode=:reflect)
+    end
+end
+
+@testset "cat and stack" begin
+    A_cpu = my_rand(Float64, 4, 3)
+    B_cpu = my_rand(Float64, 2, 3)
+    C_cpu = my_rand(Float64, 4, 5)
+    v_cpu = my_rand(Float64, 4)
+    A, B, C, v = NDArray(A_cpu), NDArray(B_cpu), NDArray(C_cpu), NDArray(v_cpu)
+
+    allowscalar() do
+        @test safe_compare(vcat(A_cpu, B_cpu), vcat(A, B), 0, 0)
+        @test safe_compare(hcat(A_cpu, C_cpu), hcat(A, C), 0, 0)
+        @test safe_compare(hcat(A_cpu, v_cpu), hcat(A, v), 0, 0)
+        @test safe_compare(cat(A_cpu, A_cpu; dims=3), cat(A, A; dims=3), 0, 0)
+        @test safe_compare(vcat(A_cpu, Int32.(B_cpu .> 0)), vcat(A, NDArray(Int32.(B_cpu .> 0))), 0, 0)
+
+        for dims in (1, 2, 3)
+            @test safe_compare(stack([A_cpu, A_cpu, A_cpu]; dims=dims), stack([A, A, A]; dims=dims), 0, 0)
+        end
+        @test safe_compare(stack((v_cpu, v_cpu)), stack((v, v)), 0, 0)
+    end
+    @test_throws DimensionMismatch vcat(A, C)
+    @test_throws DimensionMismatch stack([A, B])
+end
@@ -0,0 +1,213 @@
+#= Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahal <naderrahhal2026@u.northwestern.edu>
+=#
+
+#= Purpose of test: reductions
+    -- `init` and `mask` keywords on full and axis reductions
+    -- reductions over several (but not all) dims of a 3D array
+    -- `sum!`/`maximum!` into preallocated outputs with a wider accumulator
+    -- several statistics from one pass with `multi_reduce`
+    -- cumulative sums/products along an axis, inclusive and exclusive
+    -- full reductions as 0-d scalar handles chained into later ops
+=#
+
+using StatsBase: mean, var
+
+@testset "masked reductions" begin
+    @testset verbose=true for T in (Float32, Float64)
+        A_cpu = rand(T, 6, 5)
+        A = cuNumeric.NDArray(A_cpu)
+        keep_cpu = A_cpu .> T(0.5)
+        keep = A .> T(0.5)
+
+        allowscalar() do
+            @test isapprox(sum(A; mask=keep)[], sum(A_cpu[keep_cpu]); rtol=rtol(T) * 30)
+            @test isapprox(sum(A; init=T(2))[], sum(A_cpu; init=T(2)); rtol=rtol(T) * 30)
+            @test isapprox(
+                maximum(A; mask=keep, init=T(0))[], maximum(A_cpu[keep_cpu]; init=T(0))
+            )
+
+            masked_cpu = sum(ifelse.(keep_cpu, A_cpu, zero(T)); dims=2)
+            @test safe_compare(
+                masked_cpu, sum(A; dims=2, mask=keep), atol(T) * 5, rtol(T) * 5
+            )
+        end
+    end
+end
+
+@testset "multi-dim reductions" begin
+    A_cpu = rand(Float64, 4, 3, 5)
+    A = cuNumeric.NDArray(A_cpu)
+    allowscalar() do
+        for dims in ((1, 3), (2, 3), (1, 2))
+            @test safe_compare(sum(A_cpu; dims=dims), sum(A; dims=dims), 1e-12, 1e-12)
+            @test safe_compare(
+                maximum(A_cpu; dims=dims), maximum(A; dims=dims), 0.0, 0.0
+            )
+        end
+    end
+end
+
+@testset "in-place reductions" begin
+    A_cpu = rand(Float32, 8, 6)
+    A = cuNumeric.NDArray(A_cpu)
+
+    r = cuNumeric.zeros(Float64, 1, 6)
+    sum!(r, A)
+    r_max = cuNumeric.zeros(Float32, 8, 1)
+    maximum!(r_max, A)
+
+    allowscalar() do
+        @test safe_compare(sum(Float64.(A_cpu); dims=1), r, 1e-10, 1e-10)
+        @test safe_compare(maximum(A_cpu; dims=2), r_max, 0.0, 0.0)
+    end
+    @test_throws DimensionMismatch sum!(cuNumeric.zeros(Float32, 2, 6), A)
+end
+
+@testset "single-pass statistics" begin
+    @testset for T in (Float32, Float64)
+        A_cpu = my_rand(T, 37, 23; L=T(-10), R=T(10))
+        A_cpu[3, 4] = zero(T)
+        A = cuNumeric.NDArray(A_cpu)
+
+        lo, hi, s, ss, nz, μ, σ², σ²p = cuNumeric.multi_reduce(
+            A, :minimum, :maximum, :sum, :sum_squares, :count_nonzero, :mean, :var,
+            :var_population,
+        )
+        n = length(A_cpu)
+        allowscalar() do
+            @test lo[] == minimum(A_cpu)
+            @test hi[] == maximum(A_cpu)
+            @test isapprox(s[], sum(A_cpu); atol=reduction_atol(T, n, 10))
+            @test isapprox(ss[], sum(abs2, A_cpu); rtol=reduction_rtol(T, n))
+            @test nz[] == count(!iszero, A_cpu)
+            @test isapprox(μ[], mean(A_cpu); atol=reduction_atol(T, n, 10))
+            @test isapprox(σ²[], var(A_cpu); rtol=reduction_rtol(T, n))
+            @test isapprox(σ²p[], var(A_cpu; corrected=false); rtol=reduction_rtol(T, n))
+        end
+    end
+
+    # large offset: the naive E[x²] - E[x]² loses every digit here
+    x_cpu = 1.0e8 .+ rand(Float64, 1000)
+    _, σ² = cuNumeric.multi_reduce(cuNumeric.NDArray(x_cpu), :mean, :var)
+    allowscalar() do
+        @test isapprox(σ²[], var(x_cpu); rtol=1e-6)
+    end
+
+    @test_throws ArgumentError cuNumeric.multi_reduce(cuNumeric.zeros(Float64, 4), :median)
+end
+
+@testset "scalar handles" begin
+    A_cpu = rand(Float64, 50)
+    B_cpu = rand(Float64, 50)
+    A = cuNumeric.NDArray(A_cpu)
+    B = cuNumeric.NDArray(B_cpu)
+
+    # nothing below reads a value back until the final `[]`
+    rr = sum(A .* A)
+    pq = sum(A .* B)
+    α = rr ./ pq
+    @test α isa NDArray{Float64,0}
+    C = B .+ α .* A
+    D = α * A
+
+    α_cpu = sum(A_cpu .* A_cpu) / sum(A_cpu .* B_cpu)
+    allowscalar() do
+        @test isapprox(α[], α_cpu; rtol=1e-12)
+        @test safe_compare(B_cpu .+ α_cpu .* A_cpu, C, 1e-12, 1e-12)
+        @test safe_compare(α_cpu * A_cpu, D, 1e-12, 1e-12)
+        @test any(A .> 0.5)[] == any(A_cpu .> 0.5)
+    end
+    @test unwrap(sum(A)) isa Float64
+end
+
+@testset "scans" begin
+    @testset verbose=true for T in (Int32, Int64, Float32, Float64, ComplexF64)
+        x_cpu = my_rand(T, 1000)
+        x = cuNumeric.NDArray(x_cpu)
+        n = length(x_cpu)
+        expected = cumsum(x_cpu)
+        got = cumsum(x)
+        @test eltype(got) == eltype(expected)
+        @test @allowscalar safe_compare(expected, got, reduction_atol(T, n, 1000), reduction_rtol(T, n))
+
+        A_cpu = my_rand(T, 40, 30)
+        A = cuNumeric.NDArray(A_cpu)
+        for d in 1:2
+            @test @allowscalar safe_compare(
+                cumsum(A_cpu; dims=d), cumsum(A; dims=d), reduction_atol(T, 40, 1000), reduction_rtol(T, 40)
+            )
+        end
+    end
+
+    @testset for T in (Float32, Float64)
+        # factors near one keep the running product finite
+        A_cpu = T(0.9) .+ T(0.2) .* rand(T, 50, 20)
+        A = cuNumeric.NDArray(A_cpu)
+        for d in 1:2
+            @test @allowscalar safe_compare(cumprod(A_cpu; dims=d), cumprod(A; dims=d), atol(T), rtol(T) * 50)
+        end
+
+        # exclusive: shifted by one, starting at the identity
+        x_cpu = rand(T, 100)
+        ex = cuNumeric.scan(cuNumeric.NDArray(x_cpu), :sum; inclusive=false)
+        @test @allowscalar safe_compare([zero(T); cumsum(x_cpu)[1:(end - 1)]], ex, atol(T) * 100, rtol(T) * 100)
+
+        # NaN-aware variants skip NaN instead of propagating it
+        x_cpu[[3, 50]] .= T(NaN)
+        x = cuNumeric.NDArray(x_cpu)
+        @test @allowscalar safe_compare(
+            cumsum(replace(x_cpu, T(NaN) => zero(T))), cuNumeric.nancumsum(x), atol(T) * 100, rtol(T) * 100
+        )
+        @test @allowscalar safe_compare(
+            cumprod(replace(x_cpu, T(NaN) => one(T))), cuNumeric.nancumprod(x), atol(T), rtol(T) * 100
+        )
+        @test @allowscalar isnan(cumsum(x)[3])
+    end
+
+    # Bool sums count into Int and Bool products stay Bool, as in Base
+    b_cpu = rand(Bool, 40, 30)
+    b = cuNumeric.NDArray(b_cpu)
+    for d in 1:2
+        got = cumsum(b; dims=d)
+        @test eltype(got) == Int
+        @test Array(got) == cumsum(b_cpu; dims=d)
+        got = cumprod(b; dims=d)
+        @test eltype(got) == Bool
+        @test Array(got) == cumprod(b_cpu; dims=d)
+    end
+
+    # Float16 is accumulated in Float32; tile carries add to rounded partials
+    h_cpu = rand(Float16, 40, 30)
+    h = cuNumeric.NDArray(h_cpu)
+    for d in 1:2
+        got = cumsum(h; dims=d)
+        @test eltype(got) == Float16
+        expected = Float16.(cumsum(Float32.(h_cpu); dims=d))
+        @test safe_compare(expected, got, atol(Float16), rtol(Float16))
+    end
+
+    # in place
+    x = cuNumeric.NDArray(collect(1.0:10.0))
+    cumsum!(x, x)
+    @test @allowscalar safe_compare(cumsum(collect(1.0:10.0)), x, 0, 0)
+
+    @test_throws ArgumentError cumsum(cuNumeric.zeros(Float64, 3, 3))
+    @test_throws ArgumentError cuNumeric.scan(cuNumeric.zeros(Float64, 3), :max)
+end
@@ -143,3 +143,34 @@ end
         end
     end
 end
+
+# Reads `arr` through the same descriptor RunPTXTask packs for @cuda_task
+# arguments, using the device-side offset computation.
+function read_through_descriptor(arr::NDArray{T,N}) where {T,N}
+    ptr, dims, strides = cuNumeric.nda_strided_descriptor(arr)
+    @test dims == size(arr)
+    values = GC.@preserve arr [
+        unsafe_load(ptr, cuNumeric._strided_elem_offset(dims, strides, i) + 1) for
+        i in 1:prod(dims)
+    ]
+    return reshape(values, dims), strides
+end
+
+@testset "Strided descriptors" begin
+    A_cpu = rand(Float64, 12, 9)
+    A = NDArray(A_cpu)
+    v_cpu = rand(Float64, 12)
+    v = NDArray(v_cpu)
+
+    dense, _ = read_through_descriptor(A)
+    @test dense == A_cpu
+
+    slice = A[3:10, 2:7]
+    sliced, _ = read_through_descriptor(slice)
+    @test sliced == A_cpu[3:10, 2:7]
+
+    view = cuNumeric.broadcast_to(v, (12, 5))
+    expanded, strides = read_through_descriptor(view)
+    @test expanded == repeat(v_cpu, 1, 5)
+    @test strides[2] == 0
+end
@@ -0,0 +1,95 @@
+#= Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahal <naderrahhal2026@u.northwestern.edu>
+=#
+
+#= Purpose of test: sort
+    -- sort / sortperm / argsort along an axis against Base
+    -- partition contract and top-k against a full host sort
+=#
+
+@testset "sort" begin
+    @testset verbose=true for T in (Int32, Int64, Float32, Float64)
+        x_cpu = my_rand(T, 1000)
+        x = NDArray(x_cpu)
+        @test @allowscalar safe_compare(sort(x_cpu), sort(x), 0, 0)
+        @test @allowscalar safe_compare(sort(x_cpu; rev=true), sort(x; rev=true), 0, 0)
+        @test Array(sortperm(x)) == sortperm(x_cpu)
+
+        A_cpu = my_rand(T, 20, 30)
+        A = NDArray(A_cpu)
+        for d in 1:2
+            @test @allowscalar safe_compare(sort(A_cpu; dims=d), sort(A; dims=d), 0, 0)
+            @test @allowscalar safe_compare(
+                mapslices(sortperm, A_cpu; dims=d), cuNumeric.argsort(A; dims=d, stable=true), 0, 0
+            )
+        end
+        @test_throws ArgumentError sort(A)
+        @test_throws ArgumentError sort(A; dims=3)
+    end
+
+    # stable keeps ties in input order
+    x = NDArray([3, 1, 3, 1, 2])
+    @test Array(sortperm(x)) == [2, 4, 5, 1, 3]
+    # ... and with rev=true, as Base does
+    @test Array(sortperm(x; rev=true)) == sortperm([3, 1, 3, 1, 2]; rev=true)
+    A_cpu = [2 1 2; 1 1 2; 2 1 1; 1 2 2]
+    for d in 1:2
+        @test Array(cuNumeric.argsort(NDArray(A_cpu); dims=d, rev=true, stable=true)) ==
+            mapslices(v -> sortperm(v; rev=true), A_cpu; dims=d)
+    end
+end
+
+@testset "partition" begin
+    x_cpu = randn(500)
+    k = 137
+    p = Array(cuNumeric.partition(NDArray(x_cpu), k))
+    @test p[k] == sort(x_cpu)[k]
+    @test all(p[1:(k - 1)] .<= p[k]) && all(p[(k + 1):end] .>= p[k])
+    @test x_cpu[Array(cuNumeric.argpartition(NDArray(x_cpu), k))[k]] == p[k]
+    @test_throws ArgumentError cuNumeric.partition(NDArray(x_cpu), 501)
+end
+
+@testset "topk" begin
+    @testset verbose=true for T in (Int64, Float32, Float64)
+        x_cpu = my_rand(T, 10_000)
+        x = NDArray(x_cpu)
+        k = 25
+        vals, idx = cuNumeric.topk(x, k)
+        @test Array(vals) == sort(x_cpu; rev=true)[1:k]
+        @test x_cpu[idx] == Array(vals)
+        vals, idx = cuNumeric.topk(x, k; rev=false)
+        @test Array(vals) == sort(x_cpu)[1:k]
+        @test x_cpu[idx] == Array(vals)
+    end
+
+    A_cpu = randn(64, 48)
+    vals, idx = cuNumeric.topk(NDArray(A_cpu), 10)
+    @test Array(vals) == sort(vec(A_cpu); rev=true)[1:10]
+    @test A_cpu[idx] == Array(vals)
+
+    # NaN ranks first, ties go to the earlier element
+    vals, idx = cuNumeric.topk(NDArray([1.0, NaN, 5.0, 5.0, 2.0]), 3)
+    @test isnan(Array(vals)[1]) && idx == [2, 3, 4]
+    # ... in column-major order for matrices
+    vals, idx = cuNumeric.topk(NDArray([1.0 7.0; 7.0 0.0]), 2)
+    @test Array(vals) == [7.0, 7.0] && idx == [CartesianIndex(2, 1), CartesianIndex(1, 2)]
+
+    @test_throws ArgumentError cuNumeric.topk(NDArray([1.0, 2.0]), 3)
+    @test_throws ArgumentError cuNumeric.topk(NDArray([1.0 + 0im]), 1)
+end
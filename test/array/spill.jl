@@ -0,0 +1,72 @@
+#= Copyright 2025 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSEend-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+=#
+
+#= Purpose of test: spill
+    -- Cold arrays spilled to scratch files stay usable and are filled back
+       on their next use; views and their parents stay resident
+=#
+
+@testset "Spilling cold arrays" begin
+    mktempdir() do dir
+        cuNumeric.enable_spilling!(; dir=dir)
+        try
+            A_cpu = my_rand(Float64, 256, 128)
+            B_cpu = my_rand(Float32, 4096)
+            A = NDArray(A_cpu)
+            B = NDArray(B_cpu)
+            P_cpu = my_rand(Float64, 64, 64)
+            P = NDArray(P_cpu)
+            view = P[9:40, 3:30]
+
+            before = cuNumeric.spill_stats()
+            spilled = cuNumeric.spill_cold!(typemax(Int64))
+            after = cuNumeric.spill_stats()
+            @test spilled >= sizeof(A_cpu) + sizeof(B_cpu)
+            @test after.spills - before.spills >= 2
+            @test after.resident_bytes >= sizeof(A_cpu) + sizeof(B_cpu)
+
+            # the next use fills the array back in
+            C = A .* 2.0
+            @test cuNumeric.spill_stats().fills > after.fills
+            @test safe_compare(A_cpu .* 2.0, C, atol(Float64), rtol(Float64))
+            @test safe_compare(B_cpu, B, atol(Float32), rtol(Float32))
+
+            # P has a live view, so writes through either stay shared
+            @allowscalar view[1, 1] = 42.0
+            @test @allowscalar P[9, 3] == 42.0
+
+            # Same-shape reshapes and ravels alias their source's store
+            # untransformed; neither side may be rebound alone.
+            Q = NDArray(my_rand(Float64, 16, 8))
+            same = cuNumeric.reshape(Q, (16, 8))
+            flat = cuNumeric.ravel(Q)
+            cuNumeric.spill_cold!(typemax(Int64))
+            @allowscalar same[2, 3] = -1.0
+            @allowscalar flat[1] = -2.0
+            @test @allowscalar Q[2, 3] == -1.0
+            @test @allowscalar Q[1, 1] == -2.0
+        finally
+            cuNumeric.disable_spilling!()
+        end
+        @test cuNumeric.spill_stats().resident_bytes == 0
+        @test cuNumeric.spill_stats().tracked == 0
+        @test_throws ArgumentError cuNumeric.enable_spilling!(; dir=joinpath(dir, "missing"))
+        @test_throws ArgumentError cuNumeric.spill_cold!(-1)
+    end
+end
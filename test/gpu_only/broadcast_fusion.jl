@@ -518,11 +518,6 @@ end
     @testset "0-d scalar NDArray (fusion refused, unfused ok)" begin
         # RunPTXBroadcastTask only supports dims in [1, 6]; can_fuse refuses
         # 0-d so `_copyto!` falls back to unfused.
-        #
-        # NOTE: `z1 .+ z2` still errors after a successful `copyto!` because
-        # `Broadcast.copy` for NDArrayStyle{0} unwraps with
-        # `dest[CartesianIndex()]`, which is not implemented. Test via
-        # `copyto!` into an explicit 0-d dest instead.
         z1 = @allowscalar NDArray(T(2))
         z2 = @allowscalar NDArray(T(3))
         @test ndims(z1) == 0
@@ -537,6 +532,11 @@ end
         @test !cuNumeric.can_fuse_linear_broadcast(dest2, bc2)
         copyto!(dest2, bc2)
         @allowscalar @test dest2[] ≈ T(2) * s1 + T(3) atol = atol rtol = rtol
+
+        # `Broadcast.copy` keeps 0-d results as NDArrays
+        z3 = z1 .+ z2
+        @test z3 isa NDArray{T,0}
+        @allowscalar @test z3[] == T(5)
     end
 
     @testset "dest aliases an input" begin
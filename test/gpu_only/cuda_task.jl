@@ -0,0 +1,45 @@
+#= Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ *            Nader Rahal <naderrahhal2026@u.northwestern.edu>
+=#
+
+#= Purpose of test: @cuda_task with arguments of different shapes
+    -- arrays are passed as strided descriptors, without padding copies
+=#
+
+function _head_copy_kernel(a, b)
+    i = (blockIdx().x - 1i32) * blockDim().x + threadIdx().x
+    if i <= length(b)
+        @inbounds b[i] = i <= length(a) ? a[i] : 0.0f0
+    end
+    return nothing
+end
+
+@testset "cuda_task heterogeneous shapes" begin
+    cuNumeric.Experimental(true)
+    a_cpu = rand(Float32, 60)
+    a = NDArray(a_cpu)
+    b = cuNumeric.zeros(Float32, 100)
+
+    task = cuNumeric.@cuda_task _head_copy_kernel(a, b)
+    cuNumeric.@launch task=task threads=128 blocks=1 inputs=a outputs=b
+
+    @test size(a) == (60,) # no padding added to the input
+    expected = vcat(a_cpu, zeros(Float32, 40))
+    @test @allowscalar safe_compare(expected, b, 0, 0)
+end